@@ -0,0 +1,25 @@
+/**
+ * @file BenchmarkPositions.hpp
+ * @brief Defines the corpus of realistic positions used by the benchmarks.
+ */
+
+#pragma once
+#include <array>
+#include <string>
+#include <vector>
+#include "GameStateDTO.hpp"
+
+/**
+ * @struct BenchmarkPosition
+ * @brief A named position with the dice already rolled.
+ */
+struct BenchmarkPosition {
+    std::string name;    ///< Short label shown in benchmark output
+    GameStateDTO state;  ///< Position, player on roll and dice
+};
+
+/**
+ * @brief Gets the benchmark corpus: opening, middle game, bar entry and bear-off.
+ * @return All benchmark positions, in a stable order
+ */
+const std::vector<BenchmarkPosition>& benchmarkPositions();
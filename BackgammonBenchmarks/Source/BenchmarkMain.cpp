@@ -0,0 +1,179 @@
+/**
+ * @file BenchmarkMain.cpp
+ * @brief Microbenchmarks for the rules engine hot paths.
+ *
+ * Every benchmark runs over the position corpus (see BenchmarkPositions.hpp)
+ * and reports ns/op plus heap allocations per operation ("allocs/op").
+ * Use --benchmark_format=json or --benchmark_out=<file> to compare runs.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <benchmark/benchmark.h>
+#include "BenchmarkPositions.hpp"
+#include "Board.hpp"
+#include "Game.hpp"
+
+namespace {
+    std::atomic<long long> g_allocations{ 0 };  ///< Heap allocations since process start
+
+    /**
+     * @brief Tracks allocations for the duration of one benchmark.
+     */
+    class AllocationScope {
+    public:
+        AllocationScope() : m_start(g_allocations.load(std::memory_order_relaxed)) {}
+
+        /**
+         * @brief Publishes the allocation count as a per-iteration counter.
+         */
+        void report(benchmark::State& state) const {
+            const double allocs = static_cast<double>(g_allocations.load(std::memory_order_relaxed) - m_start);
+            state.counters["allocs/op"] = benchmark::Counter(allocs, benchmark::Counter::kAvgIterations);
+        }
+
+    private:
+        long long m_start;  ///< Allocation count when the scope was created
+    };
+
+    const BenchmarkPosition& positionFor(benchmark::State& state) {
+        const BenchmarkPosition& pos = benchmarkPositions()[static_cast<std::size_t>(state.range(0))];
+        state.SetLabel(pos.name);
+        return pos;
+    }
+
+    HeadlessGame gameFor(const BenchmarkPosition& pos) {
+        HeadlessGame game;
+        game.loadState(pos.state);
+        return game;
+    }
+
+    /// First legal move in a position, found through the public API
+    bool firstLegalMove(const HeadlessGame& game, int& from, int& to) {
+        for (int i = 0; i <= Game::BAR_INDEX; ++i) {
+            if (!game.canSelectPoint(i)) continue;
+            const std::vector<int> targets = game.getLegalTargets(i);
+            if (!targets.empty()) {
+                from = i;
+                to = targets.front();
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+/// Cost of copying a game before every move; subtract from BM_MakeMove
+static void BM_GameCopy(benchmark::State& state) {
+    const HeadlessGame base = gameFor(positionFor(state));
+    HeadlessGame game;
+    AllocationScope allocs;
+    for (auto _ : state) {
+        game = base;
+        benchmark::DoNotOptimize(game);
+    }
+    allocs.report(state);
+}
+
+static void BM_MakeMove(benchmark::State& state) {
+    const HeadlessGame base = gameFor(positionFor(state));
+    int from = 0;
+    int to = 0;
+    if (!firstLegalMove(base, from, to)) {
+        state.SkipWithError("position has no legal move");
+        return;
+    }
+
+    HeadlessGame game;
+    AllocationScope allocs;
+    for (auto _ : state) {
+        game = base;
+        benchmark::DoNotOptimize(game.makeMove(from, to));
+    }
+    allocs.report(state);
+}
+
+static void BM_GetLegalTargets(benchmark::State& state) {
+    const HeadlessGame game = gameFor(positionFor(state));
+    AllocationScope allocs;
+    for (auto _ : state) {
+        std::size_t total = 0;
+        for (int i = 0; i <= Game::BAR_INDEX; ++i) {
+            total += game.getLegalTargets(i).size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    allocs.report(state);
+}
+
+static void BM_HasMovesAvailable(benchmark::State& state) {
+    const HeadlessGame game = gameFor(positionFor(state));
+    AllocationScope allocs;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game.hasMovesAvailable());
+    }
+    allocs.report(state);
+}
+
+static void BM_CanSelectPoint(benchmark::State& state) {
+    const HeadlessGame game = gameFor(positionFor(state));
+    AllocationScope allocs;
+    for (auto _ : state) {
+        int selectable = 0;
+        for (int i = 0; i <= Game::BAR_INDEX; ++i) {
+            selectable += game.canSelectPoint(i) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(selectable);
+    }
+    allocs.report(state);
+}
+
+static void BM_GetState(benchmark::State& state) {
+    const HeadlessGame game = gameFor(positionFor(state));
+    AllocationScope allocs;
+    for (auto _ : state) {
+        GameStateDTO s = game.getState();
+        benchmark::DoNotOptimize(s);
+    }
+    allocs.report(state);
+}
+
+static void BM_BoardCopy(benchmark::State& state) {
+    Board board;
+    Board copy;
+    AllocationScope allocs;
+    for (auto _ : state) {
+        copy = board;
+        benchmark::DoNotOptimize(copy);
+    }
+    allocs.report(state);
+}
+
+/// Registers a benchmark once per corpus position
+#define BACKGAMMON_POSITION_BENCHMARK(fn) \
+    BENCHMARK(fn)->DenseRange(0, static_cast<int>(benchmarkPositions().size()) - 1)
+
+BACKGAMMON_POSITION_BENCHMARK(BM_GameCopy);
+BACKGAMMON_POSITION_BENCHMARK(BM_MakeMove);
+BACKGAMMON_POSITION_BENCHMARK(BM_GetLegalTargets);
+BACKGAMMON_POSITION_BENCHMARK(BM_HasMovesAvailable);
+BACKGAMMON_POSITION_BENCHMARK(BM_CanSelectPoint);
+BACKGAMMON_POSITION_BENCHMARK(BM_GetState);
+BENCHMARK(BM_BoardCopy);
+
+BENCHMARK_MAIN();
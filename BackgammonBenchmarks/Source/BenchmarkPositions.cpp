@@ -0,0 +1,21 @@
+/**
+ * @file BenchmarkPositions.cpp
+ * @brief Implementation of the benchmark position corpus.
+ */
+
+#include "BenchmarkPositions.hpp"
+
+const std::vector<BenchmarkPosition>& benchmarkPositions() {
+    //                                                        0   1   2   3   4   5   6   7   8   9  10  11  12  13  14  15  16  17  18  19  20  21  22  23
+    static const std::vector<BenchmarkPosition> positions = {
+        { "opening", GameStateDTO::fromColumns({  2,  0,  0,  0,  0, -5,  0, -3,  0,  0,  0,  5, -5,  0,  0,  0,  3,  0,  5,  0,  0,  0,  0, -2 },
+                                               0, 0, 0, 0, Color::WHITE, 3, 1) },
+        { "middle",  GameStateDTO::fromColumns({  1,  0, -2, -2,  0, -4,  0, -2,  0,  0,  0,  3, -3,  0,  0,  0,  3,  2,  2,  2,  2,  0, -1, -1 },
+                                               0, 0, 0, 0, Color::WHITE, 6, 4) },
+        { "bar",     GameStateDTO::fromColumns({ -2, -2, -2,  0, -3, -3,  0,  0,  0,  0,  0,  3, -3,  0,  0,  0,  3,  0,  4,  3,  0,  0,  0,  0 },
+                                               2, 0, 0, 0, Color::WHITE, 4, 6) },
+        { "bearoff", GameStateDTO::fromColumns({ -3, -3, -3, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  3,  3,  2,  1,  1 },
+                                               0, 0, 3, 0, Color::WHITE, 6, 2) },
+    };
+    return positions;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Executor.hpp
+ * @brief Defines the thread pool on which game coroutines are multiplexed.
+ */
+
+#pragma once
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class Executor
+ * @brief Small fixed-size thread pool resuming suspended coroutines.
+ *
+ * Thousands of games can share a handful of threads: a game only occupies a
+ * thread while it is actually computing, and suspends while it waits for a
+ * player.
+ */
+class Executor {
+public:
+    /**
+     * @brief Constructor starting the worker threads.
+     * @param threadCount Number of threads (0 = hardware concurrency)
+     */
+    explicit Executor(unsigned threadCount = 0);
+
+    /**
+     * @brief Destructor finishing queued work and joining all threads.
+     */
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /**
+     * @brief Queues a coroutine to be resumed on a pool thread.
+     * @param handle Suspended coroutine
+     */
+    void post(std::coroutine_handle<> handle);
+
+    /**
+     * @brief Awaiter moving the awaiting coroutine onto a pool thread.
+     */
+    struct ScheduleAwaiter {
+        Executor* executor;  ///< Target executor
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const { executor->post(handle); }
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Suspends the caller and resumes it on a pool thread.
+     * @return Awaiter for co_await
+     */
+    ScheduleAwaiter schedule() noexcept {
+        return ScheduleAwaiter{ this };
+    }
+
+    /**
+     * @brief Gets the number of pool threads.
+     * @return Thread count
+     */
+    unsigned threadCount() const;
+
+private:
+    /**
+     * @brief Loop run by every pool thread.
+     */
+    void run();
+
+    std::mutex m_mutex;                              ///< Guards the queue and the stop flag
+    std::condition_variable m_wake;                  ///< Signals new work or shutdown
+    std::deque<std::coroutine_handle<>> m_queue;     ///< Coroutines ready to resume
+    bool m_stopping;                                 ///< Set by the destructor
+    std::vector<std::thread> m_threads;              ///< Pool threads
+};
@@ -0,0 +1,29 @@
+/**
+ * @file GameDriver.hpp
+ * @brief Defines the coroutine that runs a complete game between two agents.
+ */
+
+#pragma once
+#include "IGame.hpp"
+#include "IPlayerAgent.hpp"
+#include "Task.hpp"
+
+/// Consecutive rejected moves after which an agent forfeits the game
+inline constexpr int MAX_REJECTED_MOVES = 16;
+
+/**
+ * @brief Plays a complete game through the IGame interface.
+ *
+ * Runs the opening rolls (repeating ties), then alternates turns: roll the
+ * dice, pass if nothing can be moved, otherwise ask the current player's
+ * agent for moves until the turn switches. Moves the engine rejects are
+ * requested again, up to MAX_REJECTED_MOVES in a row; an agent that keeps
+ * proposing illegal moves forfeits, and the game is left unfinished. The game
+ * object must not be touched by anyone else while the driver owns it.
+ *
+ * @param game Game to drive
+ * @param white Agent playing white
+ * @param black Agent playing black
+ * @return The winner, or the opponent of an agent that forfeited
+ */
+Task<Color> runGame(IGame& game, IPlayerAgent& white, IPlayerAgent& black);
@@ -0,0 +1,58 @@
+/**
+ * @file HeuristicBot.hpp
+ * @brief Defines the HeuristicBot agent that plays the best play by HeuristicEvaluator.
+ */
+
+#pragma once
+#include "Executor.hpp"
+#include "GameStateDTO.hpp"
+#include "IPlayerAgent.hpp"
+#include "Play.hpp"
+
+class OpeningBook;
+
+/**
+ * @class HeuristicBot
+ * @brief Agent choosing whole plays, consulting an opening book before searching.
+ *
+ * At the start of each turn the bot looks the position up in the book and
+ * otherwise runs HeuristicEvaluator::bestPlay. The chosen play is then handed
+ * out one checker move per chooseMove() call. If the game is not in the
+ * state the plan expects, the bot plans again.
+ */
+class HeuristicBot : public IPlayerAgent {
+public:
+    /**
+     * @brief Constructor for the bot.
+     * @param book Optional opening book (must outlive the bot)
+     * @param executor Optional executor to think on
+     */
+    explicit HeuristicBot(const OpeningBook* book = nullptr, Executor* executor = nullptr);
+
+    /**
+     * @brief Chooses the next move of the best play.
+     * @param game Game to move in
+     * @return A legal move, or std::nullopt if none exists
+     */
+    Task<std::optional<AgentMove>> chooseMove(const IGame& game) override;
+
+    /**
+     * @brief Gets the number of turns whose play came from the book.
+     * @return Book hits
+     */
+    unsigned bookHits() const;
+
+private:
+    /**
+     * @brief Plans the play for the current turn.
+     * @param game Game at the start of the turn or in the middle of an unplanned turn
+     */
+    void plan(const IGame& game);
+
+    const OpeningBook* m_book;   ///< Opening book (may be null)
+    Executor* m_executor;        ///< Executor to think on (may be null)
+    Play m_play;                 ///< Planned play
+    int m_next;                  ///< Index of the next move of m_play
+    GameStateDTO m_expected;     ///< State in which the next planned move is made
+    unsigned m_bookHits;         ///< Turns played from the book
+};
@@ -0,0 +1,41 @@
+/**
+ * @file IPlayerAgent.hpp
+ * @brief Defines the IPlayerAgent interface for players driven by the asynchronous game driver.
+ */
+
+#pragma once
+#include <optional>
+#include "IGame.hpp"
+#include "Task.hpp"
+
+/**
+ * @struct AgentMove
+ * @brief A single checker move chosen by an agent.
+ */
+struct AgentMove {
+    int fromIndex;  ///< Source column (0-23 or Game::BAR_INDEX)
+    int toIndex;    ///< Destination column (0-23 or bear-off value)
+};
+
+/**
+ * @interface IPlayerAgent
+ * @brief A player whose decisions may take time (bot search, network, UI clicks).
+ *
+ * chooseMove() is a coroutine: an agent may suspend for as long as it needs
+ * without blocking a thread. The game is not modified while a move is being
+ * chosen, so the agent may read it from any thread.
+ */
+class IPlayerAgent {
+public:
+    /**
+     * @brief Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~IPlayerAgent() = default;
+
+    /**
+     * @brief Chooses the next move for the current player.
+     * @param game Game to move in (dice already rolled)
+     * @return The move to play, or std::nullopt to pass the rest of the turn
+     */
+    virtual Task<std::optional<AgentMove>> chooseMove(const IGame& game) = 0;
+};
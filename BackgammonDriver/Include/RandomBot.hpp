@@ -0,0 +1,37 @@
+/**
+ * @file RandomBot.hpp
+ * @brief Defines the RandomBot agent that plays a uniformly random legal move.
+ */
+
+#pragma once
+#include <random>
+#include "Executor.hpp"
+#include "IPlayerAgent.hpp"
+
+/**
+ * @class RandomBot
+ * @brief Agent choosing uniformly among all legal single moves.
+ *
+ * If an executor is given, the bot hops onto it before "thinking", which is
+ * how a real search bot would offload work from the driving thread.
+ */
+class RandomBot : public IPlayerAgent {
+public:
+    /**
+     * @brief Constructor for the bot.
+     * @param seed Random seed
+     * @param executor Optional executor to think on
+     */
+    explicit RandomBot(unsigned seed, Executor* executor = nullptr);
+
+    /**
+     * @brief Chooses a random legal move.
+     * @param game Game to move in
+     * @return A legal move, or std::nullopt if none exists
+     */
+    Task<std::optional<AgentMove>> chooseMove(const IGame& game) override;
+
+private:
+    std::mt19937 m_rng;    ///< Random generator
+    Executor* m_executor;  ///< Executor to think on (may be null)
+};
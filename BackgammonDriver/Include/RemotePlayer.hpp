@@ -0,0 +1,63 @@
+/**
+ * @file RemotePlayer.hpp
+ * @brief Defines the RemotePlayer agent whose moves are submitted from outside (UI, network).
+ */
+
+#pragma once
+#include <coroutine>
+#include <mutex>
+#include <optional>
+#include "Executor.hpp"
+#include "IPlayerAgent.hpp"
+
+/**
+ * @class RemotePlayer
+ * @brief Agent that suspends until a move is submitted by another component.
+ *
+ * A UI click handler or network reader calls submit() from any thread; the
+ * waiting game coroutine is then resumed on the executor. Invalid moves are
+ * rejected by the driver, which asks again until MAX_REJECTED_MOVES in a row
+ * forfeit the game.
+ */
+class RemotePlayer : public IPlayerAgent {
+public:
+    /**
+     * @brief Constructor for the agent.
+     * @param executor Executor on which the game is resumed after a submission
+     */
+    explicit RemotePlayer(Executor& executor);
+
+    /**
+     * @brief Waits for the next submitted move.
+     * @param game Game to move in
+     * @return The submitted move, or std::nullopt for a pass
+     */
+    Task<std::optional<AgentMove>> chooseMove(const IGame& game) override;
+
+    /**
+     * @brief Delivers a move (or a pass) to the waiting game.
+     *
+     * If no game is waiting yet the move is kept for the next chooseMove().
+     *
+     * @param move Move to play, or std::nullopt to pass
+     */
+    void submit(std::optional<AgentMove> move);
+
+private:
+    /**
+     * @brief Awaiter suspending until submit() is called.
+     */
+    struct SubmissionAwaiter {
+        RemotePlayer* player;  ///< Owning agent
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        std::optional<AgentMove> await_resume();
+    };
+
+    Executor& m_executor;                      ///< Executor resuming the game
+    std::mutex m_mutex;                        ///< Guards the members below
+    std::coroutine_handle<> m_waiting;         ///< Game waiting for a move (may be null)
+    bool m_hasSubmission;                      ///< Whether m_submission holds an undelivered move
+    std::optional<AgentMove> m_submission;     ///< Last submitted move
+};
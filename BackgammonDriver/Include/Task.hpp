@@ -0,0 +1,160 @@
+/**
+ * @file Task.hpp
+ * @brief Defines the Task coroutine type used by the asynchronous game driver.
+ */
+
+#pragma once
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+/**
+ * @class Task
+ * @brief Lazily started coroutine that produces a value when awaited.
+ *
+ * A Task does not run until it is co_awaited. When it completes it resumes
+ * its awaiter directly (symmetric transfer), so long chains of awaits never
+ * grow the stack. Exceptions are not used by the engine; an escaping
+ * exception terminates the process.
+ *
+ * @tparam T Result type (void for no result)
+ */
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+    /**
+     * @brief Promise state shared by Task<T> and Task<void>.
+     */
+    struct TaskPromiseBase {
+        std::coroutine_handle<> continuation;  ///< Coroutine awaiting this task
+
+        /**
+         * @brief Resumes the awaiting coroutine when the task finishes.
+         */
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+
+            template <typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+                std::coroutine_handle<> next = h.promise().continuation;
+                return next ? next : std::noop_coroutine();
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    /**
+     * @brief Promise of a value-returning task.
+     */
+    template <typename T>
+    struct TaskPromise : TaskPromiseBase {
+        std::optional<T> value;  ///< Result, set by co_return
+
+        Task<T> get_return_object() noexcept;
+        void return_value(T v) { value = std::move(v); }
+        T takeResult() { return std::move(*value); }
+    };
+
+    /**
+     * @brief Promise of a task without a result.
+     */
+    template <>
+    struct TaskPromise<void> : TaskPromiseBase {
+        Task<void> get_return_object() noexcept;
+        void return_void() noexcept {}
+        void takeResult() noexcept {}
+    };
+}
+
+template <typename T>
+class Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /**
+     * @brief Constructor taking ownership of a coroutine frame.
+     * @param handle Coroutine handle
+     */
+    explicit Task(Handle handle) noexcept : m_handle(handle) {}
+
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (m_handle) m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /**
+     * @brief Destructor destroying the coroutine frame.
+     */
+    ~Task() {
+        if (m_handle) m_handle.destroy();
+    }
+
+    /**
+     * @brief Awaiter starting the task and resuming the caller with its result.
+     */
+    struct Awaiter {
+        Handle handle;  ///< Awaited task
+
+        bool await_ready() const noexcept { return !handle || handle.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        T await_resume() { return handle.promise().takeResult(); }
+    };
+
+    /**
+     * @brief Starts the task when co_awaited.
+     * @return Awaiter yielding the task result
+     */
+    Awaiter operator co_await() && noexcept {
+        return Awaiter{ m_handle };
+    }
+
+private:
+    Handle m_handle;  ///< Owned coroutine frame
+};
+
+namespace detail {
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object() noexcept {
+        return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+        return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+    }
+}
+
+/**
+ * @struct DetachedTask
+ * @brief Fire-and-forget coroutine that starts immediately and frees itself when done.
+ */
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
@@ -0,0 +1,57 @@
+/**
+ * @file Executor.cpp
+ * @brief Implementation of the coroutine thread pool.
+ */
+
+#include "Executor.hpp"
+
+#include <string>
+#include "Tracing.hpp"
+
+Executor::Executor(unsigned threadCount) : m_stopping(false) {
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+
+    m_threads.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back([this, i]() {
+            Tracer::setThreadName("executor " + std::to_string(i));
+            run();
+        });
+    }
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& t : m_threads) t.join();
+}
+
+void Executor::post(std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(handle);
+    }
+    m_wake.notify_one();
+}
+
+unsigned Executor::threadCount() const {
+    return static_cast<unsigned>(m_threads.size());
+}
+
+void Executor::run() {
+    for (;;) {
+        std::coroutine_handle<> next;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+            if (m_queue.empty()) return;
+            next = m_queue.front();
+            m_queue.pop_front();
+        }
+        next.resume();
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file GameDriver.cpp
+ * @brief Implementation of the asynchronous game loop.
+ */
+
+#include "GameDriver.hpp"
+#include "Tracing.hpp"
+
+Task<Color> runGame(IGame& game, IPlayerAgent& white, IPlayerAgent& black) {
+    do {
+        game.start();
+        game.rollOpeningDice();
+        game.rollOpeningDice();
+    } while (game.getOpeningDiceWhite() == game.getOpeningDiceBlack());
+
+    game.startGameAfterOpening();
+
+    while (game.getPhase() == GamePhase::IN_PROGRESS) {
+        const Color mover = game.getCurrentPlayer();
+        IPlayerAgent& agent = (mover == Color::WHITE) ? white : black;
+
+        // Spans stay out of co_await: the game may resume on another executor thread
+        bool canMove = false;
+        {
+            BG_TRACE_SCOPE("driver:roll");
+            game.rollDice();
+            canMove = game.hasMovesAvailable();
+        }
+        if (!canMove) {
+            game.passTurn();
+            continue;
+        }
+
+        int rejected = 0;
+        while (game.getPhase() == GamePhase::IN_PROGRESS && game.getCurrentPlayer() == mover) {
+            std::optional<AgentMove> move = co_await agent.chooseMove(game);
+            if (!move) {
+                game.passTurn();
+                break;
+            }
+            MoveResult result = MoveResult::SUCCESS;
+            {
+                BG_TRACE_SCOPE("driver:move");
+                result = game.makeMove(move->fromIndex, move->toIndex);
+            }
+            if (result == MoveResult::SUCCESS) {
+                rejected = 0;
+            }
+            else if (++rejected >= MAX_REJECTED_MOVES) {
+                // An agent stuck on an illegal move would otherwise be asked forever
+                co_return (mover == Color::WHITE) ? Color::BLACK : Color::WHITE;
+            }
+        }
+    }
+
+    co_return (game.getBorneOffCount(Color::WHITE) == 15) ? Color::WHITE : Color::BLACK;
+}
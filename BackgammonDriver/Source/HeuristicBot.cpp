@@ -0,0 +1,62 @@
+/**
+ * @file HeuristicBot.cpp
+ * @brief Implementation of the HeuristicBot agent.
+ */
+
+#include "HeuristicBot.hpp"
+
+#include "Game.hpp"
+#include "HeuristicEvaluator.hpp"
+#include "OpeningBook.hpp"
+
+namespace {
+    bool sameState(const GameStateDTO& a, const GameStateDTO& b) {
+        return a.pieceCounts == b.pieceCounts && a.colors == b.colors && a.barWhite == b.barWhite &&
+               a.barBlack == b.barBlack && a.borneOffWhite == b.borneOffWhite &&
+               a.borneOffBlack == b.borneOffBlack && a.currentPlayer == b.currentPlayer &&
+               a.dice1 == b.dice1 && a.dice2 == b.dice2;
+    }
+}
+
+HeuristicBot::HeuristicBot(const OpeningBook* book, Executor* executor)
+    : m_book(book), m_executor(executor), m_next(0), m_bookHits(0) {
+}
+
+Task<std::optional<AgentMove>> HeuristicBot::chooseMove(const IGame& game) {
+    const GameStateDTO state = game.getState();
+    if (m_next >= m_play.count || !sameState(state, m_expected)) {
+        if (m_executor) co_await m_executor->schedule();
+        plan(game);
+    }
+    if (m_next >= m_play.count) co_return std::nullopt;
+
+    const CheckerMove move = m_play.moves[m_next++];
+
+    // Remember the state the following move of the plan is made in
+    HeadlessGame next;
+    next.loadState(state);
+    next.makeMove(move.fromIndex, move.toIndex);
+    m_expected = next.getState();
+
+    co_return AgentMove{ move.fromIndex, move.toIndex };
+}
+
+unsigned HeuristicBot::bookHits() const {
+    return m_bookHits;
+}
+
+void HeuristicBot::plan(const IGame& game) {
+    m_play = Play{};
+    m_next = 0;
+    m_expected = game.getState();
+
+    float equity = 0.0f;
+    if (m_book && m_book->lookup(game, m_play, equity)) {
+        ++m_bookHits;
+        return;
+    }
+
+    HeadlessGame copy;
+    copy.loadState(m_expected);
+    if (!HeuristicEvaluator::bestPlay(copy, m_play, equity)) m_play = Play{};
+}
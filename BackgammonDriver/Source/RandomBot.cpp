@@ -0,0 +1,28 @@
+/**
+ * @file RandomBot.cpp
+ * @brief Implementation of the RandomBot agent.
+ */
+
+#include "RandomBot.hpp"
+
+#include <vector>
+#include "Game.hpp"
+
+RandomBot::RandomBot(unsigned seed, Executor* executor) : m_rng(seed), m_executor(executor) {
+}
+
+Task<std::optional<AgentMove>> RandomBot::chooseMove(const IGame& game) {
+    if (m_executor) co_await m_executor->schedule();
+
+    std::vector<AgentMove> moves;
+    for (int from = 0; from <= Game::BAR_INDEX; ++from) {
+        if (!game.canSelectPoint(from)) continue;
+        for (int to : game.getLegalTargets(from)) {
+            moves.push_back(AgentMove{ from, to });
+        }
+    }
+
+    if (moves.empty()) co_return std::nullopt;
+    std::uniform_int_distribution<std::size_t> pick(0, moves.size() - 1);
+    co_return moves[pick(m_rng)];
+}
@@ -0,0 +1,39 @@
+/**
+ * @file RemotePlayer.cpp
+ * @brief Implementation of the RemotePlayer agent.
+ */
+
+#include "RemotePlayer.hpp"
+
+#include <utility>
+
+RemotePlayer::RemotePlayer(Executor& executor) : m_executor(executor), m_hasSubmission(false) {
+}
+
+Task<std::optional<AgentMove>> RemotePlayer::chooseMove(const IGame&) {
+    co_return co_await SubmissionAwaiter{ this };
+}
+
+void RemotePlayer::submit(std::optional<AgentMove> move) {
+    std::coroutine_handle<> waiting;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_submission = move;
+        m_hasSubmission = true;
+        waiting = std::exchange(m_waiting, {});
+    }
+    if (waiting) m_executor.post(waiting);
+}
+
+bool RemotePlayer::SubmissionAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    std::lock_guard<std::mutex> lock(player->m_mutex);
+    if (player->m_hasSubmission) return false;
+    player->m_waiting = handle;
+    return true;
+}
+
+std::optional<AgentMove> RemotePlayer::SubmissionAwaiter::await_resume() {
+    std::lock_guard<std::mutex> lock(player->m_mutex);
+    player->m_hasSubmission = false;
+    return player->m_submission;
+}
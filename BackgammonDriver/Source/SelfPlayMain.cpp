@@ -0,0 +1,173 @@
+/**
+ * @file SelfPlayMain.cpp
+ * @brief Runs many bot-vs-bot games concurrently on a small executor pool.
+ *
+ * Usage: BackgammonSelfPlay [--games N] [--threads N] [--seed N] [--bot random|heuristic] [--book FILE]
+ *                           [--trace FILE] [--record FILE]
+ *
+ * --bot selects the agents (random by default). --book gives heuristic bots
+ * an opening book (see BackgammonBook) and implies --bot heuristic.
+ * --record stores every game in a game record file (see GameRecordStream.hpp).
+ * --trace writes a Chrome trace of the run (requires a build with
+ * BACKGAMMON_TRACING); open it in chrome://tracing or ui.perfetto.dev.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <cstdlib>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Executor.hpp"
+#include "Game.hpp"
+#include "GameDriver.hpp"
+#include "GameRecordStream.hpp"
+#include "GameRecorder.hpp"
+#include "HeuristicBot.hpp"
+#include "OpeningBook.hpp"
+#include "RandomBot.hpp"
+#include "Tracing.hpp"
+
+namespace {
+    /**
+     * @brief Creates one agent of the selected kind.
+     */
+    std::unique_ptr<IPlayerAgent> makeAgent(bool heuristic, unsigned seed, Executor& executor, const OpeningBook* book) {
+        if (heuristic) return std::make_unique<HeuristicBot>(book, &executor);
+        return std::make_unique<RandomBot>(seed, &executor);
+    }
+
+    /**
+     * @struct SelfPlayGame
+     * @brief One concurrently running game and its two bots.
+     */
+    struct SelfPlayGame {
+        SelfPlayGame(unsigned seed, Executor& executor, bool record, bool heuristic, const OpeningBook* book)
+            : white(makeAgent(heuristic, seed * 2 + 1, executor, book)),
+              black(makeAgent(heuristic, seed * 2 + 2, executor, book)),
+              recorder(observedGame), recording(record) {
+            if (recording) {
+                observedGame.addObserver(&recorder);
+                recorder.setGameId(seed);
+            }
+        }
+
+        /**
+         * @brief Gets the engine the game is played on.
+         */
+        IGame& game() {
+            return recording ? static_cast<IGame&>(observedGame) : static_cast<IGame&>(headlessGame);
+        }
+
+        HeadlessGame headlessGame;  ///< Rules engine when not recording
+        Game observedGame;          ///< Rules engine feeding the recorder
+        std::unique_ptr<IPlayerAgent> white;  ///< White agent
+        std::unique_ptr<IPlayerAgent> black;  ///< Black agent
+        GameRecorder recorder;      ///< Builds the game record when recording
+        bool recording;             ///< True if the game is recorded
+    };
+
+    DetachedTask playOne(Executor& executor, SelfPlayGame& slot, std::atomic<int>& whiteWins, std::latch& done) {
+        co_await executor.schedule();
+        const Color winner = co_await runGame(slot.game(), *slot.white, *slot.black);
+        if (winner == Color::WHITE) ++whiteWins;
+        done.count_down();
+    }
+}
+
+/**
+ * @brief Main entry point of the self-play driver.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return Process exit code
+ */
+int main(int argc, char* argv[]) {
+    int games = 1000;
+    unsigned threads = 0;
+    unsigned seed = 1;
+    std::string tracePath;
+    std::string recordPath;
+    std::string botKind = "random";
+    std::string bookPath;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc) games = std::atoi(argv[++i]);
+        else if (arg == "--threads" && i + 1 < argc) threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (arg == "--seed" && i + 1 < argc) seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (arg == "--trace" && i + 1 < argc) tracePath = argv[++i];
+        else if (arg == "--record" && i + 1 < argc) recordPath = argv[++i];
+        else if (arg == "--bot" && i + 1 < argc) botKind = argv[++i];
+        else if (arg == "--book" && i + 1 < argc) bookPath = argv[++i];
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--games N] [--threads N] [--seed N] [--bot random|heuristic]"
+                      << " [--book FILE] [--trace FILE] [--record FILE]\n";
+            return 2;
+        }
+    }
+    if (games <= 0 || (botKind != "random" && botKind != "heuristic")) return 2;
+    const bool heuristic = botKind == "heuristic" || !bookPath.empty();
+    if (!tracePath.empty()) Tracer::setEnabled(true);
+
+    OpeningBook book;
+    if (!bookPath.empty() && !book.open(bookPath)) {
+        std::cerr << bookPath << " is not a valid opening book\n";
+        return 1;
+    }
+
+    Executor executor(threads);
+    std::vector<std::unique_ptr<SelfPlayGame>> slots;
+    slots.reserve(static_cast<std::size_t>(games));
+    for (int g = 0; g < games; ++g) {
+        slots.push_back(std::make_unique<SelfPlayGame>(seed + static_cast<unsigned>(g), executor, !recordPath.empty(),
+                                                       heuristic, book.isOpen() ? &book : nullptr));
+    }
+
+    std::atomic<int> whiteWins{ 0 };
+    std::latch done(games);
+
+    const auto begin = std::chrono::steady_clock::now();
+    for (auto& slot : slots) {
+        playOne(executor, *slot, whiteWins, done);
+    }
+    done.wait();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << games << " games on " << executor.threadCount() << " threads in " << seconds << " s ("
+              << (games / seconds) << " games/s); white won " << whiteWins << "\n";
+
+    if (book.isOpen()) {
+        unsigned hits = 0;
+        for (const auto& slot : slots) {
+            for (const IPlayerAgent* agent : { slot->white.get(), slot->black.get() }) {
+                hits += static_cast<const HeuristicBot*>(agent)->bookHits();
+            }
+        }
+        std::cout << hits << " turns played from the opening book\n";
+    }
+
+    if (!tracePath.empty()) {
+        Tracer::setEnabled(false);
+        if (!Tracer::writeFile(tracePath)) {
+            std::cerr << "Could not write " << tracePath << "\n";
+            return 1;
+        }
+        std::cout << "trace written to " << tracePath << " (" << Tracer::droppedCount() << " spans dropped)\n";
+    }
+
+    if (!recordPath.empty()) {
+        std::ofstream file(recordPath, std::ios::binary | std::ios::trunc);
+        GameRecordWriter writer(file);
+        for (const auto& slot : slots) writer.append(slot->recorder.record());
+        if (!writer.finish()) {
+            std::cerr << "Could not write " << recordPath << "\n";
+            return 1;
+        }
+        std::cout << writer.recordCount() << " games recorded to " << recordPath << " ("
+                  << static_cast<double>(file.tellp()) / games << " bytes/game)\n";
+    }
+    return 0;
+}
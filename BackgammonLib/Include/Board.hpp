@@ -6,6 +6,7 @@
 #pragma once
 #include <array>
 #include "Column.hpp"
+#include "PositionId.hpp"
 
 /**
  * @class Board
@@ -22,6 +23,15 @@ public:
      */
     Board();
 
+    /**
+     * @brief Constructor creating a board from a position key.
+     * @param key Position key (see PositionId)
+     * @param onRoll Color of the player on roll when the key was made
+     *
+     * An invalid key leaves every column, bar and bear-off count empty.
+     */
+    Board(const PositionKey& key, Color onRoll);
+
     /**
      * @brief Destructor for the Board.
      */
@@ -73,6 +83,20 @@ public:
      */
     void incrementBorneOffCount(int playerIndex);
 
+    /**
+     * @brief Sets the bar count for a player.
+     * @param playerIndex Player index (0 for WHITE, 1 for BLACK)
+     * @param count Number of pieces on the bar
+     */
+    void setBarCount(int playerIndex, int count);
+
+    /**
+     * @brief Sets the bear-off count for a player.
+     * @param playerIndex Player index (0 for WHITE, 1 for BLACK)
+     * @param count Number of pieces borne off
+     */
+    void setBorneOffCount(int playerIndex, int count);
+
 private:
     std::array<Column, 24> m_columns;  ///< The 24 columns (points) on the board
     int m_barCount[2];                 ///< Number of pieces on the bar for each player
@@ -0,0 +1,95 @@
+/**
+ * @file CommandHistory.hpp
+ * @brief Defines the CommandHistory class providing undo and redo of game actions.
+ */
+
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "GameCommand.hpp"
+#include "IGame.hpp"
+
+/**
+ * @class CommandHistory
+ * @brief Executes game commands and keeps them in a ring buffer for undo and redo.
+ *
+ * The ring is allocated once by the constructor and stores the commands by
+ * value, so recording, undoing and redoing an action never allocates and
+ * takes constant time. When the ring is full, recording a command forgets
+ * the oldest one. Executing a new command discards the commands that could
+ * have been redone.
+ *
+ * All game changes must go through the history for undo to be exact; start
+ * a new game with clear(). Undo restores a memento, which observers of a
+ * Game see as onStateRestored(); redo executes the command again and sends
+ * its usual notifications.
+ */
+class CommandHistory {
+public:
+    /// Commands kept by default
+    static constexpr std::size_t DEFAULT_CAPACITY = 256;
+
+    /**
+     * @brief Constructor.
+     * @param capacity Maximum number of commands kept (at least 1)
+     */
+    explicit CommandHistory(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Executes a command and records it if it changed the game.
+     * @param game Game to change
+     * @param command Command to execute
+     * @return Result of the command
+     */
+    MoveResult execute(IGame& game, const GameCommand& command);
+
+    /**
+     * @brief Undoes the last executed command.
+     * @param game Game the command was executed on
+     * @return False if there is nothing to undo
+     */
+    bool undo(IGame& game);
+
+    /**
+     * @brief Executes the last undone command again.
+     * @param game Game the command was undone on
+     * @return False if there is nothing to redo or the command no longer applies
+     */
+    bool redo(IGame& game);
+
+    /**
+     * @brief Forgets all commands.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of commands that can be undone.
+     * @return Undo depth
+     */
+    std::size_t undoCount() const;
+
+    /**
+     * @brief Gets the number of commands that can be redone.
+     * @return Redo depth
+     */
+    std::size_t redoCount() const;
+
+    /**
+     * @brief Gets the maximum number of commands kept.
+     * @return Ring capacity
+     */
+    std::size_t capacity() const;
+
+private:
+    /**
+     * @brief Gets the ring slot of the i-th kept command, counted from the oldest.
+     * @param i Position from the oldest command
+     * @return Slot in m_ring
+     */
+    std::size_t slot(std::size_t i) const;
+
+    std::vector<GameCommand> m_ring;  ///< Command slots, allocated once
+    std::size_t m_oldest;             ///< Slot of the oldest kept command
+    std::size_t m_undoable;           ///< Commands that can be undone
+    std::size_t m_redoable;           ///< Undone commands after them that can be redone
+};
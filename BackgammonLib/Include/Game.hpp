@@ -4,14 +4,16 @@
  */
 
 #pragma once
+#include <memory_resource>
 #include <vector>
 #include "IGame.hpp"
 #include "IGameObserver.hpp"
+#include "ObserverPolicy.hpp"
 #include "Board.hpp"
 #include "GameStateDTO.hpp"
 
 /**
- * @class Game
+ * @class BasicGame
  * @brief Concrete implementation of the IGame interface for Backgammon.
  *
  * This class implements all the game rules for Backgammon including:
@@ -21,8 +23,15 @@
  * - Bearing off pieces when all are in the home board
  * - Win detection
  * - Observer pattern for UI notifications
+ *
+ * The observer storage is a compile-time policy (see ObserverPolicy.hpp).
+ * Use the Game alias for interactive builds and HeadlessGame for simulation,
+ * where notifications are compiled away.
+ *
+ * @tparam ObserverPolicy ObserverList or NoObservers
  */
-class Game : public IGame {
+template <typename ObserverPolicy>
+class BasicGame : public IGame {
 public:
     /**
      * @brief Special index constant representing the bar.
@@ -32,12 +41,23 @@ public:
     /**
      * @brief Constructor creating a new game instance.
      */
-    Game();
+    BasicGame();
+
+    /**
+     * @brief Constructor setting up a position from its key.
+     *
+     * A valid key puts the game in progress with onRoll to roll; an invalid
+     * key leaves the game not started on an empty board.
+     *
+     * @param key Position key (see PositionId)
+     * @param onRoll Color of the player on roll
+     */
+    BasicGame(const PositionKey& key, Color onRoll);
 
     /**
      * @brief Destructor for the Game.
      */
-    ~Game() override;
+    ~BasicGame() override;
 
 	/**
 	 * @brief Starts a new game with the standard starting position.
@@ -46,6 +66,15 @@ public:
 	 */
 	void start() override;
 
+    /**
+     * @brief Returns the game to its freshly constructed state.
+     *
+     * Unlike start(), no notification is sent and all observers are
+     * unregistered. Used by GamePool to recycle game objects; containers
+     * keep their capacity.
+     */
+    void reset();
+
 	/**
 	 * @brief Gets the current phase of the game.
 	 * @return The current GamePhase
@@ -65,6 +94,17 @@ public:
      */
     void rollDice() override;
 
+    /**
+     * @brief Sets the dice to the given values as if they had been rolled.
+     *
+     * Used to replay recorded games and to walk the game tree. Only valid
+     * during IN_PROGRESS phase; values outside 1-6 are ignored.
+     *
+     * @param d1 Value of the first die (1-6)
+     * @param d2 Value of the second die (1-6)
+     */
+    void rollDice(int d1, int d2) override;
+
     /**
      * @brief Gets the current dice values.
      * @return Array with two die values (0 if used or not rolled)
@@ -85,6 +125,20 @@ public:
      */
     MoveResult makeMove(int fromIndex, int toIndex) override;
 
+    /**
+     * @brief Makes all checker moves of a turn at once.
+     *
+     * Moves are applied to the board one by one without notifications and
+     * rolled back if any of them is illegal, if the turn would end before
+     * the last one, or if dice that could still be used are left over.
+     * Observers then get a single onPlayMade() instead of one onMoveMade()
+     * per checker.
+     *
+     * @param play Moves of the turn (empty to pass when nothing can be moved)
+     * @return MoveResult indicating success or failure reason
+     */
+    MoveResult makePlay(const Play& play) override;
+
     /**
      * @brief Rolls one die for each player to determine who starts.
      *
@@ -92,6 +146,17 @@ public:
      */
     void rollOpeningDice() override;
 
+    /**
+     * @brief Rolls the opening die of the player in turn with a given value.
+     *
+     * Behaves like rollOpeningDice() but uses the given value instead of a
+     * random one, for replaying recorded or imported games. Values outside
+     * 1-6 are ignored.
+     *
+     * @param value Die value (1-6)
+     */
+    void rollOpeningDice(int value) override;
+
     /**
      * @brief Gets white player's opening die value.
      * @return Opening die value for white
@@ -150,6 +215,41 @@ public:
 	 */
     GameStateDTO getState() const override;
 
+    /**
+     * @brief Replaces the current game state, e.g. to set up a position for analysis.
+     *
+     * The dice count as rolled when either die is non-zero. No observers are
+     * notified.
+     *
+     * @param state State to load
+     * @param phase Phase to enter
+     */
+    void loadState(const GameStateDTO& state, GamePhase phase = GamePhase::IN_PROGRESS);
+
+    /**
+     * @brief Saves the complete state of the game.
+     * @return Memento to pass to restoreMemento()
+     */
+    GameMemento saveMemento() const override;
+
+    /**
+     * @brief Puts the game back into a saved state and sends onStateRestored().
+     * @param memento State saved by saveMemento()
+     */
+    void restoreMemento(const GameMemento& memento) override;
+
+    /**
+     * @brief Gets the number of observer notifications sent so far.
+     * @return Notification count, also counted without observers
+     */
+    std::uint64_t notificationCount() const override;
+
+    /**
+     * @brief Gets the key of the current checker layout, seen from the current player.
+     * @return Position key
+     */
+    PositionKey positionKey() const;
+
     /**
      * @brief Checks if a point can be selected for moving.
      * @param index Column index
@@ -164,6 +264,17 @@ public:
      */
     std::vector<int> getLegalTargets(int fromIndex) const override;
 
+    /**
+     * @brief Gets all legal destination columns for a piece into a caller-owned list.
+     *
+     * The list is cleared first; its allocator (e.g. a SessionArena) is used
+     * for any growth.
+     *
+     * @param fromIndex Source column index
+     * @param targets Receives the legal destination indices
+     */
+    void getLegalTargets(int fromIndex, std::pmr::vector<int>& targets) const;
+
 	/**
 	 * @brief Adds an observer for game events.
 	 * @param observer Observer to add
@@ -182,7 +293,8 @@ private:
     Color m_currentPlayer;                  ///< Current player's turn
     std::array<int, 2> m_dice;              ///< Current dice values
     bool m_diceRolled;                      ///< Whether dice have been rolled this turn
-    std::vector<IGameObserver *> m_observers; ///< Registered observers
+    ObserverPolicy m_observers;             ///< Registered observers
+    std::uint64_t m_notifications;          ///< Notifications sent, restored with mementos
 
     int m_openingDiceWhite;  ///< White's opening die value
     int m_openingDiceBlack;  ///< Black's opening die value
@@ -205,11 +317,22 @@ private:
      */
     void notifyMoveMade(int fromIndex, int toIndex, MoveResult result);
 
+    /**
+     * @brief Notifies all observers that a whole play was made.
+     * @param play Moves of the play
+     */
+    void notifyPlayMade(const Play& play);
+
     /**
      * @brief Notifies all observers that the turn changed.
      */
     void notifyTurnChanged();
 
+    /**
+     * @brief Notifies all observers that a saved state was restored.
+     */
+    void notifyStateRestored();
+
     /**
      * @brief Notifies all observers that the game finished.
      * @param winner Winning player color
@@ -221,6 +344,37 @@ private:
      */
     void switchTurn();
 
+    /**
+     * @brief Validates a single checker move and applies it to the board.
+     *
+     * Consumes the die used. Neither notifies observers nor changes the
+     * turn; the board is left untouched unless the result is SUCCESS.
+     *
+     * @param fromIndex Source column (0-23 or BAR_INDEX)
+     * @param toIndex Destination column (0-23 or special bear-off value)
+     * @return MoveResult indicating success or failure reason
+     */
+    MoveResult applyMove(int fromIndex, int toIndex);
+
+    /**
+     * @brief Checks whether the current player has borne off all pieces.
+     * @return True if the current player has won
+     */
+    bool hasWon() const;
+
+    /**
+     * @brief Checks whether the current player's turn is over after a move.
+     * @return True if both dice are used or no legal move is left
+     */
+    bool isTurnOver() const;
+
+    /**
+     * @brief Stores rolled dice and notifies observers (shared by both rollDice overloads).
+     * @param d1 First die
+     * @param d2 Second die
+     */
+    void applyDice(int d1, int d2);
+
 	/**
 	 * @brief Rolls a single die (1-6).
 	 * @return Random value 1-6
@@ -271,4 +425,21 @@ private:
      * @return True if all pieces are home
      */
     bool hasAllPiecesHome(Color player) const;
+
+    /**
+     * @brief Appends all legal destination columns for a piece to a list.
+     * @param fromIndex Source column index
+     * @param targets List receiving the destinations
+     */
+    template <typename TargetList>
+    void appendLegalTargets(int fromIndex, TargetList& targets) const;
 };
+
+/// Game engine with full IGameObserver support (used by the UI).
+using Game = BasicGame<ObserverList>;
+
+/// Game engine without observer support, for headless simulation and self-play.
+using HeadlessGame = BasicGame<NoObservers>;
+
+extern template class BasicGame<ObserverList>;
+extern template class BasicGame<NoObservers>;
@@ -0,0 +1,218 @@
+/**
+ * @file GameArchive.hpp
+ * @brief Defines the indexed game archive file and its memory-mapped reader.
+ *
+ * File layout:
+ *   "BGA1"
+ *   encoded GameRecords, uncompressed and back to back
+ *   index: one entry per game [u64 record offset][u32 header size][u32 event count]
+ *   trailer: [u64 index offset][u64 game count]["BGAI"][u32 reserved]
+ * All integers are little-endian. The trailer is found from the end of the
+ * file, so game K and event M of game K are located with plain arithmetic.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "GameRecord.hpp"
+#include "MappedFile.hpp"
+
+/**
+ * @class GameArchiveWriter
+ * @brief Writes an archive file game by game and appends the index on finish().
+ */
+class GameArchiveWriter {
+public:
+    /**
+     * @brief Constructor creating (or truncating) the archive file.
+     * @param path Archive file
+     */
+    explicit GameArchiveWriter(const std::string& path);
+
+    /**
+     * @brief Destructor finishing the archive if finish() was not called.
+     */
+    ~GameArchiveWriter();
+
+    GameArchiveWriter(const GameArchiveWriter&) = delete;
+    GameArchiveWriter& operator=(const GameArchiveWriter&) = delete;
+
+    /**
+     * @brief Checks whether the file could be created.
+     * @return True if writing is possible
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends one game.
+     * @param record Game to store
+     */
+    void append(const GameRecord& record);
+
+    /**
+     * @brief Writes the index and trailer and closes the file.
+     * @return False if any write failed
+     */
+    bool finish();
+
+private:
+    /**
+     * @struct IndexEntry
+     * @brief Location of one game in the file.
+     */
+    struct IndexEntry {
+        std::uint64_t offset;       ///< Offset of the encoded record
+        std::uint32_t headerSize;   ///< Bytes before the first event
+        std::uint32_t eventCount;   ///< Number of events
+    };
+
+    std::ofstream m_out;                   ///< Archive file
+    std::uint64_t m_offset;                ///< Current write offset
+    std::vector<IndexEntry> m_index;       ///< Index of all appended games
+    std::vector<std::uint8_t> m_scratch;   ///< Encoding buffer
+    bool m_finished;                       ///< True once the index was written
+};
+
+/**
+ * @class GameView
+ * @brief Zero-copy view of one game inside a mapped archive.
+ *
+ * Valid as long as the GameArchive it came from stays open. A default
+ * constructed view is empty and invalid; it is what GameArchive::game()
+ * returns for an index past the end.
+ */
+class GameView {
+public:
+    /**
+     * @brief Constructor for an empty, invalid view.
+     */
+    GameView() : m_record(nullptr), m_size(0), m_headerSize(0), m_eventCount(0) {}
+
+    /**
+     * @brief Constructor.
+     * @param record Encoded record inside the mapping
+     * @param size Size of the encoded record
+     * @param headerSize Offset of the first event
+     * @param eventCount Number of events
+     */
+    GameView(const std::uint8_t* record, std::size_t size, std::size_t headerSize, std::size_t eventCount)
+        : m_record(record), m_size(size), m_headerSize(headerSize), m_eventCount(eventCount) {}
+
+    /**
+     * @brief Checks whether the view refers to a game.
+     * @return False for a view of a game index past the end
+     */
+    bool isValid() const { return m_record != nullptr; }
+
+    /**
+     * @brief Gets the number of events.
+     * @return Event count (0 for an invalid view)
+     */
+    std::size_t eventCount() const { return m_eventCount; }
+
+    /**
+     * @brief Decodes one event in O(1).
+     * @param index Event index; must be < eventCount()
+     * @return Decoded event, or a 0-0 roll that GameEvent::isValid() rejects if index is out of range
+     */
+    GameEvent event(std::size_t index) const {
+        if (index >= m_eventCount) return GameEvent{ GameEventType::ROLL, 0, 0 };
+        const std::uint8_t* p = m_record + m_headerSize + index * GameEvent::ENCODED_SIZE;
+        return GameEvent::decode(static_cast<std::uint16_t>(p[0] | (p[1] << 8)));
+    }
+
+    /**
+     * @brief Decodes the record header (id, start position, result) without its events.
+     * @param header Receives the header fields
+     * @return False if the record is corrupt or the view is invalid
+     */
+    bool header(GameRecord& header) const {
+        if (!isValid()) return false;
+        std::size_t count = 0, headerSize = 0;
+        return header.decodeHeader(m_record, m_size, count, headerSize);
+    }
+
+    /**
+     * @brief Copies the whole game into a GameRecord.
+     * @param record Receives the game
+     * @return False if the record is corrupt or the view is invalid
+     */
+    bool decode(GameRecord& record) const {
+        if (!isValid()) return false;
+        std::size_t consumed = 0;
+        return record.decode(m_record, m_size, consumed);
+    }
+
+    /**
+     * @brief Replays the first events of the game straight from the mapped bytes.
+     * @tparam GameT Game or HeadlessGame
+     * @param game Game to drive (its previous state is discarded)
+     * @param eventLimit Number of events to apply (clamped to eventCount())
+     * @return False if the record is corrupt or an event was rejected
+     */
+    template <typename GameT>
+    bool replay(GameT& game, std::size_t eventLimit = SIZE_MAX) const {
+        GameRecord start;
+        if (!header(start)) return false;
+        if (start.standardStart) game.start();
+        else game.loadState(start.startPosition);
+
+        const std::size_t count = eventLimit < m_eventCount ? eventLimit : m_eventCount;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!GameRecord::applyEvent(game, event(i))) return false;
+        }
+        return true;
+    }
+
+private:
+    const std::uint8_t* m_record;  ///< Encoded record
+    std::size_t m_size;            ///< Encoded size
+    std::size_t m_headerSize;      ///< Offset of the first event
+    std::size_t m_eventCount;      ///< Number of events
+};
+
+/**
+ * @class GameArchive
+ * @brief Read-only, memory-mapped access to an archive file.
+ */
+class GameArchive {
+public:
+    /**
+     * @brief Maps an archive and validates its trailer and index.
+     * @param path Archive file
+     * @return False if the file is missing or not a valid archive (the archive is then closed)
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmaps the archive.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether an archive is open.
+     * @return True after a successful open()
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Gets the number of games.
+     * @return Game count (0 when not open)
+     */
+    std::size_t gameCount() const;
+
+    /**
+     * @brief Gets a view of game K in O(1).
+     * @param index Game index; must be < gameCount()
+     * @return View into the mapped file, or an invalid view if index is out of range
+     */
+    GameView game(std::size_t index) const;
+
+private:
+    MappedFile m_file;                   ///< Mapped archive
+    const std::uint8_t* m_index = nullptr; ///< First index entry
+    std::size_t m_gameCount = 0;         ///< Number of games
+};
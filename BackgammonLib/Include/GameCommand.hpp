@@ -0,0 +1,210 @@
+/**
+ * @file GameCommand.hpp
+ * @brief Defines the game action commands and the GameCommand variant holding any of them.
+ */
+
+#pragma once
+#include <variant>
+#include "IGame.hpp"
+#include "MoveResult.hpp"
+#include "Play.hpp"
+
+/**
+ * @class RollOpeningDiceCommand
+ * @brief Rolls the opening die of the player in turn.
+ *
+ * A command created without a value rolls randomly the first time it is
+ * executed and keeps the result, so executing it again after an undo
+ * (a redo) rolls the same value.
+ */
+class RollOpeningDiceCommand {
+public:
+    /**
+     * @brief Constructor.
+     * @param value Die value (1-6), or 0 to roll randomly
+     */
+    explicit RollOpeningDiceCommand(int value = 0) : m_value(value) {}
+
+    /**
+     * @brief Rolls the die.
+     * @param game Game to change
+     * @return SUCCESS, GAME_NOT_STARTED outside the opening roll, or INVALID_MOVE for a value outside 1-6
+     */
+    MoveResult execute(IGame& game);
+
+    /**
+     * @brief Puts the game back into its state before execute().
+     * @param game Game to change
+     */
+    void undo(IGame& game) const { game.restoreMemento(m_before); }
+
+private:
+    int m_value;           ///< Rolled value (0 until rolled)
+    GameMemento m_before;  ///< State before execute()
+};
+
+/**
+ * @class StartAfterOpeningCommand
+ * @brief Starts the main game once the opening rolls decided who begins.
+ */
+class StartAfterOpeningCommand {
+public:
+    /**
+     * @brief Starts the main game.
+     * @param game Game to change
+     * @return SUCCESS, or GAME_NOT_STARTED if the opening rolls are not done
+     */
+    MoveResult execute(IGame& game);
+
+    /**
+     * @brief Puts the game back into its state before execute().
+     * @param game Game to change
+     */
+    void undo(IGame& game) const { game.restoreMemento(m_before); }
+
+private:
+    GameMemento m_before;  ///< State before execute()
+};
+
+/**
+ * @class RollDiceCommand
+ * @brief Rolls the dice of the player on roll.
+ *
+ * Like RollOpeningDiceCommand, a random roll is kept for redo.
+ */
+class RollDiceCommand {
+public:
+    /**
+     * @brief Constructor.
+     * @param d1 First die (1-6), or 0 together with d2 to roll randomly
+     * @param d2 Second die (1-6)
+     */
+    explicit RollDiceCommand(int d1 = 0, int d2 = 0) : m_d1(d1), m_d2(d2) {}
+
+    /**
+     * @brief Rolls the dice.
+     * @param game Game to change
+     * @return SUCCESS, GAME_NOT_STARTED outside the IN_PROGRESS phase, or INVALID_MOVE for a die outside 1-6
+     */
+    MoveResult execute(IGame& game);
+
+    /**
+     * @brief Puts the game back into its state before execute().
+     * @param game Game to change
+     */
+    void undo(IGame& game) const { game.restoreMemento(m_before); }
+
+private:
+    int m_d1;              ///< First die (0 until rolled)
+    int m_d2;              ///< Second die (0 until rolled)
+    GameMemento m_before;  ///< State before execute()
+};
+
+/**
+ * @class MoveCommand
+ * @brief Moves one checker (IGame::makeMove).
+ */
+class MoveCommand {
+public:
+    /**
+     * @brief Constructor.
+     * @param fromIndex Source column (0-23 or the bar index)
+     * @param toIndex Destination column (0-23 or bear-off value)
+     */
+    MoveCommand(int fromIndex, int toIndex) : m_move{ static_cast<std::int8_t>(fromIndex), static_cast<std::int8_t>(toIndex) } {}
+
+    /**
+     * @brief Makes the move.
+     * @param game Game to change
+     * @return Result of IGame::makeMove
+     */
+    MoveResult execute(IGame& game);
+
+    /**
+     * @brief Puts the game back into its state before execute().
+     * @param game Game to change
+     */
+    void undo(IGame& game) const { game.restoreMemento(m_before); }
+
+private:
+    CheckerMove m_move;    ///< Move to make
+    GameMemento m_before;  ///< State before execute()
+};
+
+/**
+ * @class PlayCommand
+ * @brief Makes all checker moves of a turn at once (IGame::makePlay).
+ */
+class PlayCommand {
+public:
+    /**
+     * @brief Constructor.
+     * @param play Moves of the turn (empty to pass when nothing can be moved)
+     */
+    explicit PlayCommand(const Play& play) : m_play(play) {}
+
+    /**
+     * @brief Makes the play.
+     * @param game Game to change
+     * @return Result of IGame::makePlay
+     */
+    MoveResult execute(IGame& game);
+
+    /**
+     * @brief Puts the game back into its state before execute().
+     * @param game Game to change
+     */
+    void undo(IGame& game) const { game.restoreMemento(m_before); }
+
+private:
+    Play m_play;           ///< Moves to make
+    GameMemento m_before;  ///< State before execute()
+};
+
+/**
+ * @class PassCommand
+ * @brief Passes the turn to the opponent.
+ */
+class PassCommand {
+public:
+    /**
+     * @brief Passes the turn.
+     * @param game Game to change
+     * @return SUCCESS, or GAME_NOT_STARTED outside the IN_PROGRESS phase
+     */
+    MoveResult execute(IGame& game);
+
+    /**
+     * @brief Puts the game back into its state before execute().
+     * @param game Game to change
+     */
+    void undo(IGame& game) const { game.restoreMemento(m_before); }
+
+private:
+    GameMemento m_before;  ///< State before execute()
+};
+
+/**
+ * @brief Any game action, stored by value without heap allocation.
+ *
+ * Each command saves the game's state before it changes it, so undo() is a
+ * single restore however complex the action was. Random rolls are kept in
+ * the command, which makes executing it again after an undo a redo.
+ */
+using GameCommand = std::variant<RollOpeningDiceCommand, StartAfterOpeningCommand, RollDiceCommand,
+                                 MoveCommand, PlayCommand, PassCommand>;
+
+/**
+ * @brief Executes whichever command a GameCommand holds.
+ * @param command Command to execute
+ * @param game Game to change
+ * @return SUCCESS if the game was changed, otherwise the reason it was not
+ */
+MoveResult executeCommand(GameCommand& command, IGame& game);
+
+/**
+ * @brief Undoes whichever command a GameCommand holds.
+ * @param command Command executed last on the game
+ * @param game Game to change
+ */
+void undoCommand(const GameCommand& command, IGame& game);
@@ -0,0 +1,191 @@
+/**
+ * @file GameJournal.hpp
+ * @brief Defines the append-only game journal with group-commit durability.
+ *
+ * A journal is a sequence of segment files named
+ * <prefix>.<first LSN as 16 hex digits>.log. Each segment holds fixed-size
+ * entries [u32 session][u8 op][i8 a][i8 b][u8 check], little-endian. Entries
+ * are numbered by log sequence numbers (LSNs) starting at 1; an entry's LSN
+ * is the segment's first LSN plus its position in the segment.
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Game.hpp"
+
+/**
+ * @enum JournalOp
+ * @brief State-changing operation recorded in a journal entry.
+ */
+enum class JournalOp : std::uint8_t {
+    CREATE = 1,              ///< Session created
+    CLOSE = 2,               ///< Session destroyed
+    START = 3,               ///< IGame::start()
+    OPENING_ROLL = 4,        ///< Opening die a rolled (white's first, then black's)
+    START_AFTER_OPENING = 5, ///< IGame::startGameAfterOpening()
+    ROLL = 6,                ///< Dice a and b rolled
+    MOVE = 7,                ///< Successful move from a to b
+    PASS = 8                 ///< IGame::passTurn()
+};
+
+/**
+ * @struct JournalEntry
+ * @brief One journaled operation on one session.
+ *
+ * Dice are stored as rolled, so replaying an entry is deterministic.
+ */
+struct JournalEntry {
+    /// Size of an encoded entry
+    static constexpr std::size_t ENCODED_SIZE = 8;
+
+    std::uint32_t session = 0;        ///< Session the operation applies to
+    JournalOp op = JournalOp::START;  ///< Operation
+    std::int8_t a = 0;                ///< First argument (die or source column)
+    std::int8_t b = 0;                ///< Second argument (die or destination column)
+
+    /**
+     * @brief Encodes the entry.
+     * @param out Destination of ENCODED_SIZE bytes
+     */
+    void encode(std::uint8_t* out) const;
+
+    /**
+     * @brief Decodes an entry and verifies its check byte.
+     * @param in Source of ENCODED_SIZE bytes
+     * @param entry Decoded entry
+     * @return False for a torn or corrupt entry
+     */
+    static bool decode(const std::uint8_t* in, JournalEntry& entry);
+
+    /**
+     * @brief Replays a game operation on a game.
+     * @param game Game to update
+     * @return False for CREATE and CLOSE, which are not game operations, and for dice outside 1-6
+     */
+    bool apply(HeadlessGame& game) const;
+};
+
+/**
+ * @class GameJournal
+ * @brief Appends journal entries and makes them durable in batches.
+ *
+ * append() only copies the entry into a memory buffer and returns its LSN.
+ * A background thread writes everything buffered so far with one write and
+ * one fsync, then wakes all callers of waitDurable() whose entries were in
+ * the batch. Under load many appends share one fsync (group commit).
+ *
+ * A failed write or fsync is final: the durable LSN stops advancing and
+ * append() rejects every later entry until the journal is reopened.
+ */
+class GameJournal {
+public:
+    /**
+     * @brief Constructor creating a closed journal.
+     */
+    GameJournal();
+
+    /**
+     * @brief Destructor closing the journal.
+     */
+    ~GameJournal();
+
+    GameJournal(const GameJournal&) = delete;
+    GameJournal& operator=(const GameJournal&) = delete;
+
+    /**
+     * @brief Starts a new segment and the background writer.
+     * @param prefix Path prefix of the segment files
+     * @param firstLsn LSN of the first entry to append (one past the last recovered entry)
+     * @return False if the segment could not be created
+     */
+    bool open(const std::string& prefix, std::uint64_t firstLsn);
+
+    /**
+     * @brief Makes all appended entries durable and stops the background writer.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether the journal is open.
+     * @return True after a successful open()
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends an entry. Thread-safe.
+     * @param entry Entry to append
+     * @return LSN of the entry (0 if the journal is closed or has failed)
+     */
+    std::uint64_t append(const JournalEntry& entry);
+
+    /**
+     * @brief Blocks until an entry is on disk.
+     * @param lsn LSN returned by append()
+     * @return False if writing failed or the journal was closed first
+     */
+    bool waitDurable(std::uint64_t lsn);
+
+    /**
+     * @brief Gets the LSN up to which all entries are on disk.
+     * @return Durable LSN (0 before the first batch)
+     */
+    std::uint64_t durableLsn() const;
+
+    /**
+     * @brief Gets the LSN of the last appended entry.
+     * @return Last LSN (firstLsn - 1 before the first append)
+     */
+    std::uint64_t lastLsn() const;
+
+    /**
+     * @brief Closes the current segment and continues in a new one.
+     * @return LSN of the last entry in the closed segments
+     */
+    std::uint64_t rotate();
+
+    /**
+     * @brief Reads all intact entries of a journal.
+     *
+     * Reading stops at the first torn entry or gap between segments.
+     *
+     * @param prefix Path prefix of the segment files
+     * @param firstLsn Receives the LSN of entries[0] (1 if there are no segments)
+     * @param entries Receives the entries in LSN order
+     */
+    static void readAll(const std::string& prefix, std::uint64_t& firstLsn, std::vector<JournalEntry>& entries);
+
+    /**
+     * @brief Deletes the segments that only hold entries before an LSN.
+     * @param prefix Path prefix of the segment files
+     * @param lsn First LSN that must be kept (the segment starting at a rotate() boundary + 1)
+     */
+    static void removeSegmentsBefore(const std::string& prefix, std::uint64_t lsn);
+
+private:
+    /**
+     * @brief Background writer loop.
+     */
+    void run();
+
+    std::string m_prefix;                ///< Path prefix of the segment files
+    std::FILE* m_file;                   ///< Current segment (background writer only)
+    std::thread m_writer;                ///< Background writer
+    mutable std::mutex m_mutex;          ///< Guards everything below
+    std::condition_variable m_wake;      ///< Wakes the writer
+    std::condition_variable m_durable;   ///< Wakes waitDurable() and rotate()
+    std::vector<std::uint8_t> m_pending; ///< Encoded entries not yet written
+    std::uint64_t m_lastLsn;             ///< Last appended LSN
+    std::uint64_t m_durableLsn;          ///< Last LSN on disk
+    std::uint64_t m_rotatedAt;           ///< Boundary of the last rotation
+    bool m_rotateRequested;              ///< Rotation pending
+    bool m_stop;                         ///< Writer should exit
+    bool m_failed;                       ///< A write or sync failed
+    bool m_open;                         ///< True while open
+};
@@ -0,0 +1,107 @@
+/**
+ * @file GamePool.hpp
+ * @brief Defines the GamePool class, a slab-allocated recycler for game objects.
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class GamePool
+ * @brief Hands out game objects from slabs and recycles them instead of freeing them.
+ *
+ * Objects are allocated in slabs of a fixed number of elements and are never
+ * returned to the heap while the pool lives. Releasing a handle calls reset()
+ * on the object and puts it back on the free list, so creating and destroying
+ * games at a high rate does not touch malloc after warm-up.
+ *
+ * The pool is not thread-safe; give each worker thread its own pool. The pool
+ * must outlive every handle it has handed out.
+ *
+ * @tparam T Default-constructible type with a reset() member (e.g. HeadlessGame)
+ */
+template <typename T>
+class GamePool {
+public:
+    /**
+     * @brief Deleter returning an object to its pool.
+     */
+    struct Releaser {
+        GamePool* pool = nullptr;  ///< Owning pool
+
+        /**
+         * @brief Returns the object to the pool.
+         * @param object Object to recycle
+         */
+        void operator()(T* object) const {
+            if (pool) pool->release(object);
+        }
+    };
+
+    /// Owning handle to a pooled object
+    using Handle = std::unique_ptr<T, Releaser>;
+
+    /**
+     * @brief Constructor for an empty pool.
+     * @param slabSize Number of objects allocated at once when the pool runs dry
+     */
+    explicit GamePool(std::size_t slabSize = 64) : m_slabSize(slabSize > 0 ? slabSize : 1) {}
+
+    GamePool(const GamePool&) = delete;
+    GamePool& operator=(const GamePool&) = delete;
+
+    /**
+     * @brief Takes an object from the pool, growing it by one slab if needed.
+     * @return Handle that recycles the object when destroyed
+     */
+    Handle acquire() {
+        if (m_free.empty()) grow();
+        T* object = m_free.back();
+        m_free.pop_back();
+        return Handle(object, Releaser{ this });
+    }
+
+    /**
+     * @brief Gets the total number of objects owned by the pool.
+     * @return Objects in use plus objects available
+     */
+    std::size_t capacity() const {
+        return m_slabs.size() * m_slabSize;
+    }
+
+    /**
+     * @brief Gets the number of objects ready to be acquired.
+     * @return Size of the free list
+     */
+    std::size_t available() const {
+        return m_free.size();
+    }
+
+private:
+    /**
+     * @brief Allocates one more slab and adds its objects to the free list.
+     */
+    void grow() {
+        m_slabs.push_back(std::make_unique<T[]>(m_slabSize));
+        T* slab = m_slabs.back().get();
+        m_free.reserve(capacity());
+        for (std::size_t i = m_slabSize; i > 0; --i) {
+            m_free.push_back(&slab[i - 1]);
+        }
+    }
+
+    /**
+     * @brief Resets an object and puts it back on the free list.
+     * @param object Object to recycle
+     */
+    void release(T* object) {
+        object->reset();
+        m_free.push_back(object);
+    }
+
+    std::size_t m_slabSize;                   ///< Objects per slab
+    std::vector<std::unique_ptr<T[]>> m_slabs; ///< All allocated slabs
+    std::vector<T*> m_free;                    ///< Objects ready for reuse
+};
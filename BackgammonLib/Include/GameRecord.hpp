@@ -0,0 +1,159 @@
+/**
+ * @file GameRecord.hpp
+ * @brief Defines the compact binary record of one complete game.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Game.hpp"
+
+/**
+ * @enum GameEventType
+ * @brief Kinds of events stored in a game record.
+ */
+enum class GameEventType : std::uint8_t {
+    OPENING_ROLL = 0,  ///< Both opening dice (a = white, b = black); repeated on ties
+    ROLL = 1,          ///< Regular roll of the player on turn (a, b = dice)
+    MOVE = 2,          ///< One checker move (a = from index, b = to index)
+    PASS = 3           ///< Player on turn rolled but could not move
+};
+
+/**
+ * @struct GameEvent
+ * @brief One recorded game event, stored as a fixed 16-bit code.
+ *
+ * Code layout: bits 15-14 hold the type. Rolls keep the dice in bits 5-3 and
+ * 2-0; moves keep the source index (0-23, 25 for the bar) in bits 9-5 and
+ * the destination index + 1 (bear-off -1 and 24 included) in bits 4-0.
+ */
+struct GameEvent {
+    GameEventType type = GameEventType::PASS;  ///< Event kind
+    std::int8_t a = 0;                         ///< First value (die or source index)
+    std::int8_t b = 0;                         ///< Second value (die or destination index)
+
+    /// Size of an encoded event in bytes
+    static constexpr std::size_t ENCODED_SIZE = 2;
+
+    /**
+     * @brief Packs the event into its 16-bit code.
+     * @return Event code
+     */
+    std::uint16_t encode() const;
+
+    /**
+     * @brief Unpacks an event code.
+     * @param code Event code produced by encode()
+     * @return Decoded event
+     */
+    static GameEvent decode(std::uint16_t code);
+
+    /**
+     * @brief Checks that the values are possible for the event type.
+     *
+     * Codes read from files can hold dice 0 and 7 or indices past the board,
+     * which the rules engine must never see.
+     *
+     * @return True for dice 1-6 and moves between real board indices
+     */
+    bool isValid() const;
+};
+
+/**
+ * @struct GameRecord
+ * @brief Everything needed to reproduce one game exactly.
+ *
+ * Encoded layout: [u8 flags][varint game id][varint event count]
+ * [custom start position when not a standard start][u16 LE events...].
+ * Events are fixed-size so event M of an encoded record can be located
+ * directly once the header has been read.
+ */
+struct GameRecord {
+    /// Size of an encoded custom start position
+    static constexpr std::size_t POSITION_SIZE = 29;
+
+    std::uint64_t gameId = 0;            ///< Caller-defined id (e.g. self-play seed)
+    bool standardStart = true;           ///< True if the game began with start() and opening rolls
+    GameStateDTO startPosition;          ///< Starting layout and player when standardStart is false
+    bool finished = false;               ///< True if the game reached GamePhase::FINISHED
+    Color winner = Color::NONE;          ///< Winner when finished
+    std::vector<GameEvent> events;       ///< Events in play order
+
+    /**
+     * @brief Appends the encoded record to a buffer.
+     * @param out Destination buffer
+     */
+    void encode(std::vector<std::uint8_t>& out) const;
+
+    /**
+     * @brief Decodes a record from the front of a buffer.
+     * @param data Buffer start
+     * @param size Bytes available
+     * @param consumed Receives the number of bytes used
+     * @return False if the data is truncated or corrupt
+     */
+    bool decode(const std::uint8_t* data, std::size_t size, std::size_t& consumed);
+
+    /**
+     * @brief Decodes only the header of an encoded record, leaving events empty.
+     *
+     * The events follow at data + headerSize, GameEvent::ENCODED_SIZE bytes each.
+     *
+     * @param data Buffer start
+     * @param size Bytes available (including the events)
+     * @param eventCount Receives the number of events
+     * @param headerSize Receives the offset of the first event
+     * @return False if the data is truncated or corrupt
+     */
+    bool decodeHeader(const std::uint8_t* data, std::size_t size, std::size_t& eventCount, std::size_t& headerSize);
+
+    /**
+     * @brief Replays the record on a game from its starting position.
+     * @tparam GameT Game or HeadlessGame
+     * @param game Game to drive (its previous state is discarded)
+     * @return False if an event was rejected by the rules engine
+     */
+    template <typename GameT>
+    bool replay(GameT& game) const {
+        if (standardStart) game.start();
+        else game.loadState(startPosition);
+
+        for (const GameEvent& e : events) {
+            if (!applyEvent(game, e)) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Applies one event to a game.
+     * @tparam GameT Game or HeadlessGame
+     * @param game Game to drive
+     * @param event Event to apply
+     * @return False if the event is not legal in the current state
+     */
+    template <typename GameT>
+    static bool applyEvent(GameT& game, const GameEvent& event) {
+        if (!event.isValid()) return false;
+        switch (event.type) {
+        case GameEventType::OPENING_ROLL:
+            if (game.getPhase() != GamePhase::OPENING_ROLL_WHITE) game.start();
+            game.rollOpeningDice(event.a);
+            game.rollOpeningDice(event.b);
+            return game.getPhase() == GamePhase::OPENING_ROLL_COMPARE;
+        case GameEventType::ROLL:
+            if (game.getPhase() == GamePhase::OPENING_ROLL_COMPARE) game.startGameAfterOpening();
+            if (game.getPhase() != GamePhase::IN_PROGRESS) return false;
+            game.rollDice(event.a, event.b);
+            return true;
+        case GameEventType::MOVE:
+            return game.makeMove(event.a, event.b) == MoveResult::SUCCESS;
+        case GameEventType::PASS:
+            if (game.getPhase() == GamePhase::OPENING_ROLL_COMPARE) game.startGameAfterOpening();
+            if (game.getPhase() != GamePhase::IN_PROGRESS) return false;
+            game.passTurn();
+            return true;
+        }
+        return false;
+    }
+};
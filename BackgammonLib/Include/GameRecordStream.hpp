@@ -0,0 +1,112 @@
+/**
+ * @file GameRecordStream.hpp
+ * @brief Defines the streaming writer and reader for files of game records.
+ *
+ * File layout: the magic "BGR1", then blocks of
+ * [u8 codec][varint record count][varint raw size][varint stored size][data].
+ * A block holds consecutive encoded GameRecords and is stored raw or zlib
+ * compressed (when the library is built with BACKGAMMON_HAVE_ZLIB).
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+#include "GameRecord.hpp"
+
+/**
+ * @class GameRecordWriter
+ * @brief Appends game records to a stream in compressed blocks.
+ */
+class GameRecordWriter {
+public:
+    /// Raw bytes collected before a block is compressed and written
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    /**
+     * @brief Constructor writing the file header.
+     * @param out Destination stream (binary mode)
+     * @param compress False to store blocks uncompressed
+     */
+    explicit GameRecordWriter(std::ostream& out, bool compress = true);
+
+    /**
+     * @brief Destructor flushing the last block.
+     */
+    ~GameRecordWriter();
+
+    GameRecordWriter(const GameRecordWriter&) = delete;
+    GameRecordWriter& operator=(const GameRecordWriter&) = delete;
+
+    /**
+     * @brief Appends one record.
+     * @param record Record to write
+     */
+    void append(const GameRecord& record);
+
+    /**
+     * @brief Writes the pending block and flushes the stream.
+     * @return False if the stream reported an error
+     */
+    bool finish();
+
+    /**
+     * @brief Gets the number of records appended so far.
+     * @return Record count
+     */
+    std::uint64_t recordCount() const;
+
+private:
+    /**
+     * @brief Compresses and writes the pending block.
+     */
+    void flushBlock();
+
+    std::ostream& m_out;                  ///< Destination stream
+    bool m_compress;                      ///< Try zlib on each block
+    std::vector<std::uint8_t> m_block;    ///< Encoded records of the pending block
+    std::vector<std::uint8_t> m_scratch;  ///< Compression buffer
+    std::uint64_t m_blockRecords;         ///< Records in the pending block
+    std::uint64_t m_totalRecords;         ///< Records appended in total
+};
+
+/**
+ * @class GameRecordReader
+ * @brief Reads game records back from a stream written by GameRecordWriter.
+ */
+class GameRecordReader {
+public:
+    /**
+     * @brief Constructor checking the file header.
+     * @param in Source stream (binary mode)
+     */
+    explicit GameRecordReader(std::istream& in);
+
+    /**
+     * @brief Reads the next record.
+     * @param record Receives the record
+     * @return False at the end of the stream or on error (see failed())
+     */
+    bool next(GameRecord& record);
+
+    /**
+     * @brief Checks whether reading stopped because of corrupt or unsupported data.
+     * @return True on error, false after a clean end of stream
+     */
+    bool failed() const;
+
+private:
+    /**
+     * @brief Loads and decompresses the next block.
+     * @return False at the end of the stream or on error
+     */
+    bool loadBlock();
+
+    std::istream& m_in;                 ///< Source stream
+    std::vector<std::uint8_t> m_block;  ///< Decompressed current block
+    std::vector<std::uint8_t> m_stored; ///< Stored bytes of the current block
+    std::size_t m_position;             ///< Read offset in m_block
+    std::uint64_t m_blockRecords;       ///< Records left in the current block
+    bool m_failed;                      ///< Error flag
+};
@@ -0,0 +1,79 @@
+/**
+ * @file GameRecorder.hpp
+ * @brief Defines the GameRecorder observer that turns a live game into a GameRecord.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "GameRecord.hpp"
+#include "IGameObserver.hpp"
+
+class GameRecordWriter;
+
+/**
+ * @class GameRecorder
+ * @brief Observer building a GameRecord from the notifications of a Game.
+ *
+ * Register it with Game::addObserver (HeadlessGame sends no notifications).
+ * Turn changes made by the engine itself (after the move or play that ends
+ * a turn, or when the opening is decided) need no event; every other turn
+ * change, with or without a roll and after any number of moves, is
+ * recorded as a pass. After an undo (onStateRestored) the events that led
+ * past the restored state are dropped, so redone actions are recorded again.
+ * When a writer is given, each finished game is appended to it once; undoing
+ * and replaying the end of a game does not write it again.
+ */
+class GameRecorder : public IGameObserver {
+public:
+    /**
+     * @brief Constructor.
+     * @param game Game being recorded (used to read the phase)
+     * @param writer Optional sink receiving every finished record
+     */
+    explicit GameRecorder(const IGame& game, GameRecordWriter* writer = nullptr);
+
+    /**
+     * @brief Starts a record from a custom position instead of start().
+     *
+     * Call after Game::loadState, before the first roll.
+     *
+     * @param position Starting layout and player
+     */
+    void beginFromPosition(const GameStateDTO& position);
+
+    /**
+     * @brief Sets the id stored in the next records.
+     * @param gameId Caller-defined id
+     */
+    void setGameId(std::uint64_t gameId);
+
+    /**
+     * @brief Gets the record of the current (or last finished) game.
+     * @return Current record
+     */
+    const GameRecord& record() const;
+
+    void onGameStarted() override;
+    void onDiceRolled(Color player, int d1, int d2) override;
+    void onMoveMade(Color player, int fromIndex, int toIndex, MoveResult result) override;
+    void onPlayMade(Color player, const Play& play) override;
+    void onTurnChanged(Color currentPlayer) override;
+    void onStateRestored() override;
+    void onGameFinished(Color winner) override;
+
+private:
+    /**
+     * @brief Remembers the event count reached by the notification just received.
+     */
+    void markNotification();
+
+    const IGame& m_game;          ///< Observed game
+    GameRecordWriter* m_writer;   ///< Sink for finished records (may be null)
+    GameRecord m_record;          ///< Record being built
+    bool m_engineTurnChange;      ///< The next turn change is the engine's (turn-ending move or decided opening)
+    bool m_written;               ///< The finished record was passed to the writer
+    std::uint64_t m_firstNotification;   ///< IGame::notificationCount() when the record began
+    std::vector<std::size_t> m_eventsAt; ///< Event count after each notification since m_firstNotification
+};
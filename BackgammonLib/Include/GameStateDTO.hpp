@@ -32,4 +32,34 @@ struct GameStateDTO {
 
     int openingDiceWhite = 0;  ///< White player's opening die value
     int openingDiceBlack = 0;  ///< Black player's opening die value
+
+    /**
+     * @brief Builds a state from signed column counts, e.g. for fixed test and tool positions.
+     * @param columns Checkers per column (positive white, negative black)
+     * @param barWhite White checkers on the bar
+     * @param barBlack Black checkers on the bar
+     * @param offWhite White checkers borne off
+     * @param offBlack Black checkers borne off
+     * @param player Player on roll
+     * @param d1 First die (0 if not rolled)
+     * @param d2 Second die (0 if not rolled)
+     * @return State with no opening dice
+     */
+    static GameStateDTO fromColumns(const std::array<int, 24>& columns, int barWhite, int barBlack,
+                                    int offWhite, int offBlack, Color player, int d1 = 0, int d2 = 0) {
+        GameStateDTO s;
+        for (int i = 0; i < 24; ++i) {
+            const int c = columns[i];
+            s.pieceCounts[i] = c < 0 ? -c : c;
+            s.colors[i] = c > 0 ? Color::WHITE : (c < 0 ? Color::BLACK : Color::NONE);
+        }
+        s.barWhite = barWhite;
+        s.barBlack = barBlack;
+        s.borneOffWhite = offWhite;
+        s.borneOffBlack = offBlack;
+        s.currentPlayer = player;
+        s.dice1 = d1;
+        s.dice2 = d2;
+        return s;
+    }
 };
@@ -0,0 +1,66 @@
+/**
+ * @file HeuristicEvaluator.hpp
+ * @brief Defines the HeuristicEvaluator class, a fast hand-tuned position evaluator.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "Game.hpp"
+#include "Play.hpp"
+
+/**
+ * @struct RankedPlay
+ * @brief A play and the evaluation of the position it leads to.
+ */
+struct RankedPlay {
+    Play play;           ///< Checker moves of the play (empty for a pass)
+    float equity = 0.0f; ///< Evaluation for the player who made the play
+};
+
+/**
+ * @class HeuristicEvaluator
+ * @brief Scores positions from a weighted sum of simple features.
+ *
+ * Features are the pip count difference, blots within direct range of an
+ * opposing checker, made points in the home board and on the bar point,
+ * the longest prime, anchors in the opponent's home board, checkers on the
+ * bar and checkers borne off. The sum is squashed into (-1, 1) and used as
+ * a cubeless equity estimate. It is meant for bots and book building, not
+ * for accurate analysis.
+ */
+class HeuristicEvaluator {
+public:
+    /**
+     * @brief Evaluates a position for one player, regardless of who is on roll.
+     * @param game Game holding the position
+     * @param player Player whose prospects are scored
+     * @return Estimated equity in (-1, 1); exactly 1 or -1 once a side has borne off all checkers
+     */
+    static float evaluate(const IGame& game, Color player);
+
+    /**
+     * @brief Finds the play with the best evaluation for the player on roll.
+     * @param game Game in IN_PROGRESS phase with the dice rolled
+     * @param play Receives the best play (empty if the player must pass)
+     * @param equity Receives the evaluation of the position after the play
+     * @return False if the game is not waiting for a play
+     */
+    static bool bestPlay(const HeadlessGame& game, Play& play, float& equity);
+
+    /**
+     * @brief Ranks the plays for the player on roll, best first.
+     *
+     * The cancel flag is checked before every candidate is evaluated, so a
+     * caller on another thread can abandon a search it no longer needs.
+     *
+     * @param game Game in IN_PROGRESS phase with the dice rolled
+     * @param maxPlays Number of plays to keep
+     * @param ranked Receives up to maxPlays plays, ordered like bestPlay() picks them
+     * @param cancel Optional flag that aborts the search once set
+     * @return False if the game is not waiting for a play or the search was cancelled
+     */
+    static bool rankPlays(const HeadlessGame& game, std::size_t maxPlays, std::vector<RankedPlay>& ranked,
+                          const std::atomic<bool>* cancel = nullptr);
+};
@@ -7,6 +7,8 @@
 #include "Color.hpp"
 #include "MoveResult.hpp"
 #include "GameStateDTO.hpp"
+#include "Play.hpp"
+#include <cstdint>
 #include <vector>
 
 class IGameObserver;
@@ -24,6 +26,19 @@ enum class GamePhase {
 	FINISHED              ///< Game has finished
 };
 
+/**
+ * @struct GameMemento
+ * @brief Everything needed to put a game back into an earlier state.
+ *
+ * Saved by commands before they change the game, so they can be undone.
+ */
+struct GameMemento {
+	GameStateDTO state;                        ///< Board, dice, player on roll and opening dice
+	GamePhase phase = GamePhase::NOT_STARTED;  ///< Phase of the game
+	bool diceRolled = false;                   ///< Whether the dice on the board may still be played
+	std::uint64_t notifications = 0;           ///< IGame::notificationCount() when saved
+};
+
 /**
  * @interface IGame
  * @brief Abstract interface for the Backgammon game logic.
@@ -66,6 +81,17 @@ public:
 	 */
 	virtual void rollDice() = 0;
 
+	/**
+	 * @brief Sets the dice to the given values as if they had been rolled.
+	 *
+	 * Can only be called during the IN_PROGRESS phase. Values outside 1-6
+	 * are ignored.
+	 *
+	 * @param d1 Value of the first die (1-6)
+	 * @param d2 Value of the second die (1-6)
+	 */
+	virtual void rollDice(int d1, int d2) = 0;
+
 	/**
 	 * @brief Gets the current dice values.
 	 * @return Array containing the two die values (0 if not rolled or already used)
@@ -86,6 +112,15 @@ public:
 	 */
 	virtual void rollOpeningDice() = 0;
 
+	/**
+	 * @brief Rolls the opening die of the player in turn with a given value.
+	 *
+	 * Values outside 1-6 are ignored.
+	 *
+	 * @param value Die value (1-6)
+	 */
+	virtual void rollOpeningDice(int value) = 0;
+
 	/**
 	 * @brief Gets the opening die value for the white player.
 	 * @return White's opening die value
@@ -121,6 +156,20 @@ public:
 	 */
 	virtual MoveResult makeMove(int fromIndex, int toIndex) = 0;
 
+	/**
+	 * @brief Makes all checker moves of a turn at once.
+	 *
+	 * The play is validated as a whole against the roll: every move must be
+	 * legal in turn, and the play must use the dice the way the turn would
+	 * end after single moves (an empty play passes when nothing can be
+	 * moved). Either all moves are applied, followed by the change of turn
+	 * or the end of the game, or the game is left untouched.
+	 *
+	 * @param play Moves of the turn in the order they are played
+	 * @return SUCCESS, or the reason the play was rejected
+	 */
+	virtual MoveResult makePlay(const Play& play) = 0;
+
 	/**
 	 * @brief Gets the number of pieces on a specific column.
 	 * @param index Column index (0-23)
@@ -180,6 +229,32 @@ public:
 	 * @return Vector of legal destination indices
 	 */
 	virtual std::vector<int> getLegalTargets(int fromIndex) const = 0;
+
+	/**
+	 * @brief Saves the complete state of the game.
+	 * @return Memento to pass to restoreMemento()
+	 */
+	virtual GameMemento saveMemento() const = 0;
+
+	/**
+	 * @brief Puts the game back into a saved state.
+	 *
+	 * Observers get onStateRestored() afterwards.
+	 *
+	 * @param memento State saved by saveMemento()
+	 */
+	virtual void restoreMemento(const GameMemento& memento) = 0;
+
+	/**
+	 * @brief Gets the number of observer notifications sent so far.
+	 *
+	 * Saved in mementos and put back by restoreMemento(), so an observer can
+	 * tell which of its earlier notifications an undo took back.
+	 * onStateRestored() itself is not counted.
+	 *
+	 * @return Notification count
+	 */
+	virtual std::uint64_t notificationCount() const = 0;
 };
 
 
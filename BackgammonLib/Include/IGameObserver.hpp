@@ -6,6 +6,7 @@
 #pragma once
 #include "Color.hpp"
 #include "MoveResult.hpp"
+#include "Play.hpp"
 
 /**
  * @interface IGameObserver
@@ -44,12 +45,29 @@ public:
 	 */
 	virtual void onMoveMade(Color player, int fromIndex, int toIndex, MoveResult result) {}
 
+	/**
+	 * @brief Called once when a whole play has been made with IGame::makePlay().
+	 *
+	 * No onMoveMade() is sent for the individual moves of the play.
+	 *
+	 * @param player The player who made the play
+	 * @param play The moves of the play (empty for a pass)
+	 */
+	virtual void onPlayMade(Color player, const Play& play) {}
+
 	/**
 	 * @brief Called when the turn changes to another player.
 	 * @param currentPlayer The player whose turn it now is
 	 */
 	virtual void onTurnChanged(Color currentPlayer) {}
 
+	/**
+	 * @brief Called after IGame::restoreMemento() replaced the whole state, e.g. on undo.
+	 *
+	 * No other notification is sent for the restore; read the new state from the game.
+	 */
+	virtual void onStateRestored() {}
+
 	/**
 	 * @brief Called when the game has finished.
 	 * @param winner The color of the winning player
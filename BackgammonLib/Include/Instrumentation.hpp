@@ -0,0 +1,166 @@
+/**
+ * @file Instrumentation.hpp
+ * @brief Defines the opt-in call counters and latency histograms of the game engine.
+ *
+ * The layer is compiled in only when BACKGAMMON_INSTRUMENTATION is defined
+ * (CMake option of the same name). Otherwise BG_INSTRUMENT expands to nothing
+ * and the engine carries no timing code at all; the export functions still
+ * exist and report empty metrics.
+ */
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @enum InstrumentedOp
+ * @brief Engine operations with their own counters and histogram.
+ */
+enum class InstrumentedOp : std::uint8_t {
+    MAKE_MOVE,             ///< IGame::makeMove
+    GET_LEGAL_TARGETS,     ///< IGame::getLegalTargets (both overloads)
+    HAS_MOVES_AVAILABLE,   ///< IGame::hasMovesAvailable
+    GET_STATE,             ///< IGame::getState
+    ROLL_DICE,             ///< IGame::rollDice (both overloads)
+    NOTIFY_GAME_STARTED,   ///< onGameStarted fan-out
+    NOTIFY_DICE_ROLLED,    ///< onDiceRolled fan-out
+    NOTIFY_MOVE_MADE,      ///< onMoveMade fan-out
+    NOTIFY_TURN_CHANGED,   ///< onTurnChanged fan-out
+    NOTIFY_GAME_FINISHED,  ///< onGameFinished fan-out
+    MAKE_PLAY,             ///< IGame::makePlay
+    NOTIFY_PLAY_MADE,      ///< onPlayMade fan-out
+    NOTIFY_STATE_RESTORED, ///< onStateRestored fan-out
+    COUNT                  ///< Number of operations
+};
+
+/**
+ * @struct OpMetrics
+ * @brief Point-in-time copy of the metrics of one operation.
+ *
+ * Histogram bucket i counts calls that took (2^(i-1), 2^i] nanoseconds, so
+ * 2^i is an inclusive upper bound as in Prometheus' le label. Bucket 0 holds
+ * calls of at most one nanosecond; the last bucket holds everything longer
+ * than 2^(BUCKET_COUNT-2) nanoseconds.
+ */
+struct OpMetrics {
+    static constexpr std::size_t BUCKET_COUNT = 40;  ///< Buckets up to about 18 minutes
+
+    std::uint64_t calls = 0;                           ///< Number of completed calls
+    std::uint64_t totalNanoseconds = 0;                ///< Sum of all call durations
+    std::array<std::uint64_t, BUCKET_COUNT> buckets{}; ///< Log2 latency histogram
+};
+
+/**
+ * @class Instrumentation
+ * @brief Process-wide registry of per-operation metrics.
+ *
+ * Recording is lock-free (relaxed atomic increments) and safe from any
+ * thread. Calls that are nested (e.g. hasMovesAvailable inside makeMove) are
+ * counted for both operations, so durations are inclusive.
+ */
+class Instrumentation {
+public:
+    /// True when the engine was built with BACKGAMMON_INSTRUMENTATION
+#ifdef BACKGAMMON_INSTRUMENTATION
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+
+    /**
+     * @enum Format
+     * @brief Export formats.
+     */
+    enum class Format {
+        JSON,       ///< One JSON object with every operation
+        PROMETHEUS  ///< Prometheus text exposition format (histograms in seconds)
+    };
+
+    /**
+     * @brief Records one completed call.
+     * @param op Operation
+     * @param nanoseconds Duration of the call
+     */
+    static void record(InstrumentedOp op, std::uint64_t nanoseconds);
+
+    /**
+     * @brief Copies the current metrics of an operation.
+     * @param op Operation
+     * @return Metrics snapshot
+     */
+    static OpMetrics snapshot(InstrumentedOp op);
+
+    /**
+     * @brief Clears every counter and histogram.
+     */
+    static void reset();
+
+    /**
+     * @brief Gets the export name of an operation (e.g. "make_move").
+     * @param op Operation
+     * @return Static name string
+     */
+    static const char* name(InstrumentedOp op);
+
+    /**
+     * @brief Writes all metrics in the given format.
+     * @param out Destination stream
+     * @param format Export format
+     */
+    static void write(std::ostream& out, Format format);
+
+    /**
+     * @brief Writes all metrics to a file, replacing it atomically.
+     *
+     * The data is written to "<path>.tmp" and renamed over path, so readers
+     * such as a Prometheus textfile collector never see a partial file.
+     *
+     * @param path Destination file
+     * @param format Export format
+     * @return False if the file could not be written
+     */
+    static bool writeFile(const std::string& path, Format format);
+};
+
+/**
+ * @class ScopedOpTimer
+ * @brief Records the lifetime of a scope as one call of an operation.
+ */
+class ScopedOpTimer {
+public:
+    /**
+     * @brief Constructor starting the clock.
+     * @param op Operation to record
+     */
+    explicit ScopedOpTimer(InstrumentedOp op) : m_op(op), m_begin(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Destructor recording the elapsed time.
+     */
+    ~ScopedOpTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - m_begin;
+        Instrumentation::record(m_op, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedOpTimer(const ScopedOpTimer&) = delete;
+    ScopedOpTimer& operator=(const ScopedOpTimer&) = delete;
+
+private:
+    InstrumentedOp m_op;                                 ///< Operation being timed
+    std::chrono::steady_clock::time_point m_begin;       ///< Start of the scope
+};
+
+#define BG_INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define BG_INSTRUMENT_CONCAT(a, b) BG_INSTRUMENT_CONCAT_INNER(a, b)
+
+/// Times the rest of the enclosing scope as one call of op (no-op unless BACKGAMMON_INSTRUMENTATION)
+#ifdef BACKGAMMON_INSTRUMENTATION
+#define BG_INSTRUMENT(op) const ScopedOpTimer BG_INSTRUMENT_CONCAT(bgOpTimer_, __LINE__)(op)
+#else
+#define BG_INSTRUMENT(op) ((void)0)
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Defines the MappedFile class, a read-only memory mapping of a whole file.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Maps a file read-only into memory (mmap on POSIX, file mapping on Windows).
+ *
+ * Pages are loaded by the OS on first access, so opening a multi-gigabyte
+ * file is cheap and only the parts that are read cost I/O.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Constructor creating an unmapped instance.
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor unmapping the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file, replacing any previous mapping.
+     * @param path File to map
+     * @return False if the file could not be opened or mapped
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmaps the file.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a file is mapped.
+     * @return True after a successful open()
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Gets the first byte of the mapping.
+     * @return Mapped bytes (null for an empty file)
+     */
+    const std::uint8_t* data() const;
+
+    /**
+     * @brief Gets the size of the mapping.
+     * @return File size in bytes
+     */
+    std::size_t size() const;
+
+private:
+    const std::uint8_t* m_data;  ///< Start of the mapping
+    std::size_t m_size;          ///< Mapped size
+    bool m_open;                 ///< True while a file is mapped
+#ifdef _WIN32
+    void* m_file;                ///< File handle
+    void* m_mapping;             ///< File mapping handle
+#endif
+};
@@ -0,0 +1,49 @@
+/**
+ * @file MatchImporter.hpp
+ * @brief Defines the MatchImporter class converting .mat match transcripts into game records.
+ */
+
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include "GameRecord.hpp"
+
+/**
+ * @class MatchImporter
+ * @brief Zero-copy parser for .mat-style match transcripts (as exported by gnubg or Jellyfish).
+ *
+ * Text is processed as string_views into the caller's buffer (typically a
+ * MappedFile), one game at a time, so independent games can be imported on
+ * several threads. Every game is replayed through a HeadlessGame with
+ * makeMove / passTurn and is only accepted if the engine agrees with every
+ * move; accepted games come out as GameRecords.
+ *
+ * The player in the left column plays white. Points are numbered from the
+ * mover's side (25 = bar, 0 = off) and mapped to column indices. Cube
+ * actions are skipped; a game ending in a dropped double is kept as an
+ * unfinished record. Because this engine lets doubles play two checker moves,
+ * games where a double is played four times are rejected.
+ */
+class MatchImporter {
+public:
+    /**
+     * @brief Splits a transcript into the text of its games.
+     *
+     * Each piece starts at a "Game N" line and runs up to the next one; text
+     * before the first game (the match header) is skipped.
+     *
+     * @param text Whole transcript
+     * @return Views into text, one per game
+     */
+    static std::vector<std::string_view> splitGames(std::string_view text);
+
+    /**
+     * @brief Parses and validates one game.
+     * @param gameText Text of one game as returned by splitGames
+     * @param record Receives the game record
+     * @param error Receives the reason when the game is rejected
+     * @return True if the game was imported
+     */
+    static bool importGame(std::string_view gameText, GameRecord& record, std::string& error);
+};
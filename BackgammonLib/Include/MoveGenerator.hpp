@@ -0,0 +1,47 @@
+/**
+ * @file MoveGenerator.hpp
+ * @brief Defines the MoveGenerator class enumerating complete plays for a roll.
+ */
+
+#pragma once
+#include <vector>
+#include "Game.hpp"
+#include "Play.hpp"
+
+/**
+ * @struct GeneratedPlay
+ * @brief A complete play and the game after it has been made.
+ */
+struct GeneratedPlay {
+    Play play;           ///< Checker moves of the play (empty for a pass)
+    HeadlessGame after;  ///< Game after the play, with the turn handed over
+};
+
+/**
+ * @class MoveGenerator
+ * @brief Enumerates every distinct play available after the dice have been rolled.
+ *
+ * Plays are found by walking canSelectPoint / getLegalTargets / makeMove on
+ * copies of the game, so they follow exactly the rules implemented by Game.
+ * Plays leading to the same position are reported once.
+ */
+class MoveGenerator {
+public:
+    /**
+     * @brief Generates all distinct plays for the player on roll.
+     *
+     * If nothing can be moved, a single empty play (a pass) is returned.
+     *
+     * @param game Game in IN_PROGRESS phase with the dice rolled
+     * @return Distinct plays with their resulting games
+     */
+    static std::vector<GeneratedPlay> generatePlays(const HeadlessGame& game);
+
+    /**
+     * @brief Checks whether two games have the same checker layout.
+     * @param a First game
+     * @param b Second game
+     * @return True if columns, bars and borne-off counts match
+     */
+    static bool samePosition(const HeadlessGame& a, const HeadlessGame& b);
+};
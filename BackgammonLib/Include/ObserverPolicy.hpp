@@ -0,0 +1,89 @@
+/**
+ * @file ObserverPolicy.hpp
+ * @brief Defines the observer storage policies used to parameterize the game engine.
+ */
+
+#pragma once
+#include <algorithm>
+#include <vector>
+#include "IGameObserver.hpp"
+
+/**
+ * @class ObserverList
+ * @brief Observer policy that keeps a list of registered observers and notifies each of them.
+ *
+ * This is the policy used by the interactive Game (e.g. BackgammonUI), where
+ * every state change has to reach the registered IGameObserver instances.
+ */
+class ObserverList {
+public:
+    /**
+     * @brief Registers an observer (ignored if null or already registered).
+     * @param observer Observer to add
+     */
+    void add(IGameObserver* observer) {
+        if (!observer) return;
+        if (std::find(m_observers.begin(), m_observers.end(), observer) == m_observers.end()) {
+            m_observers.push_back(observer);
+        }
+    }
+
+    /**
+     * @brief Unregisters an observer.
+     * @param observer Observer to remove
+     */
+    void remove(IGameObserver* observer) {
+        auto it = std::remove(m_observers.begin(), m_observers.end(), observer);
+        m_observers.erase(it, m_observers.end());
+    }
+
+    /**
+     * @brief Unregisters all observers.
+     */
+    void clear() {
+        m_observers.clear();
+    }
+
+    /**
+     * @brief Invokes a callable for every registered observer.
+     * @param notify Callable taking an IGameObserver*
+     */
+    template <typename Fn>
+    void forEach(Fn&& notify) const {
+        for (auto* o : m_observers) notify(o);
+    }
+
+private:
+    std::vector<IGameObserver*> m_observers; ///< Registered observers
+};
+
+/**
+ * @class NoObservers
+ * @brief Observer policy for headless builds that discards all notifications.
+ *
+ * Every member is an empty inline function, so notification code in the
+ * engine is compiled away entirely when this policy is selected.
+ */
+class NoObservers {
+public:
+    /**
+     * @brief Ignores the observer.
+     */
+    void add(IGameObserver*) {}
+
+    /**
+     * @brief Ignores the observer.
+     */
+    void remove(IGameObserver*) {}
+
+    /**
+     * @brief Does nothing.
+     */
+    void clear() {}
+
+    /**
+     * @brief Does nothing; the callable is never invoked.
+     */
+    template <typename Fn>
+    void forEach(Fn&&) const {}
+};
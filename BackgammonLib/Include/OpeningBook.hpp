@@ -0,0 +1,114 @@
+/**
+ * @file OpeningBook.hpp
+ * @brief Defines the precomputed opening book and its memory-mapped reader.
+ *
+ * File layout:
+ *   "BGOB" [u32 version][u32 entry count][u32 entry size]
+ *   entries sorted by key and dice byte:
+ *     [10 position key][u8 dice: high << 4 | low][u8 move count]
+ *     [4 x (u8 from, u8 to)][f32 equity]
+ * All integers are little-endian. Moves are stored in the numbering of the
+ * player on roll (1-24 own points, 25 the bar, 0 borne off), so one entry
+ * serves both colors, just like the position key.
+ */
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "IGame.hpp"
+#include "MappedFile.hpp"
+#include "Play.hpp"
+#include "PositionId.hpp"
+
+/**
+ * @struct OpeningBookEntry
+ * @brief One book position and roll with its best play, as passed to OpeningBook::write.
+ */
+struct OpeningBookEntry {
+    PositionKey key{};              ///< Position seen from the player on roll
+    int die1 = 0;                   ///< First die
+    int die2 = 0;                   ///< Second die
+    Color onRoll = Color::WHITE;    ///< Player whose column indices play uses
+    Play play;                      ///< Best play in column indices
+    float equity = 0.0f;            ///< Equity after the play for the player on roll
+};
+
+/**
+ * @class OpeningBook
+ * @brief Read-only table of best plays for early-game positions.
+ *
+ * The file is memory-mapped and searched by binary search over its
+ * fixed-size entries, so opening a book is instant and a lookup touches a
+ * handful of pages.
+ */
+class OpeningBook {
+public:
+    /// Size of one entry in the file
+    static constexpr std::size_t ENTRY_SIZE = 24;
+
+    /**
+     * @brief Writes a book file. Entries are sorted; for duplicates the first one is kept.
+     * @param path Book file
+     * @param entries Book contents
+     * @return False if the file could not be written
+     */
+    static bool write(const std::string& path, const std::vector<OpeningBookEntry>& entries);
+
+    /**
+     * @brief Constructor creating a closed book.
+     */
+    OpeningBook();
+
+    /**
+     * @brief Maps a book file.
+     * @param path Book file
+     * @return False if the file could not be mapped or is not a book
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmaps the book.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a book is open.
+     * @return True after a successful open()
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Gets the number of entries.
+     * @return Entry count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Looks up the best play for a position and roll.
+     * @param key Position key seen from the player on roll
+     * @param onRoll Player on roll (selects the column indices of play)
+     * @param die1 First die
+     * @param die2 Second die
+     * @param play Receives the best play
+     * @param equity Receives the equity after the play
+     * @return False if the position and roll are not in the book
+     */
+    bool lookup(const PositionKey& key, Color onRoll, int die1, int die2, Play& play, float& equity) const;
+
+    /**
+     * @brief Looks up the best play for the current turn of a game.
+     *
+     * Only succeeds at the start of a turn, before either die has been used.
+     *
+     * @param game Game with the dice rolled
+     * @param play Receives the best play
+     * @param equity Receives the equity after the play
+     * @return False if the position and roll are not in the book
+     */
+    bool lookup(const IGame& game, Play& play, float& equity) const;
+
+private:
+    MappedFile m_file;      ///< Mapped book file
+    std::size_t m_count;    ///< Number of entries
+};
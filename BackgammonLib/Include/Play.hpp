@@ -0,0 +1,47 @@
+/**
+ * @file Play.hpp
+ * @brief Defines the Play structure describing all checker moves of one turn.
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+/**
+ * @struct CheckerMove
+ * @brief A single checker move as passed to IGame::makeMove.
+ */
+struct CheckerMove {
+    std::int8_t fromIndex = 0;  ///< Source column (0-23 or BAR_INDEX)
+    std::int8_t toIndex = 0;    ///< Destination column (0-23 or bear-off value)
+};
+
+/**
+ * @struct Play
+ * @brief The sequence of checker moves a player makes in one turn.
+ *
+ * An empty play means the player passes.
+ */
+struct Play {
+    /// Maximum number of checker moves in one turn
+    static constexpr int MAX_MOVES = 4;
+
+    std::array<CheckerMove, MAX_MOVES> moves{};  ///< Moves in the order they are played
+    std::uint8_t count = 0;                      ///< Number of valid entries in moves
+
+    /**
+     * @brief Appends a move to the play.
+     * @param fromIndex Source column
+     * @param toIndex Destination column
+     */
+    void push(int fromIndex, int toIndex) {
+        moves[count++] = CheckerMove{ static_cast<std::int8_t>(fromIndex), static_cast<std::int8_t>(toIndex) };
+    }
+
+    /**
+     * @brief Removes the last move.
+     */
+    void pop() {
+        --count;
+    }
+};
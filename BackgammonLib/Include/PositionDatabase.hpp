@@ -0,0 +1,161 @@
+/**
+ * @file PositionDatabase.hpp
+ * @brief Defines the on-disk store of analyzed positions.
+ *
+ * A database consists of two files:
+ *   <path>.dat  append-only records: "BGPD" [u32 version], then fixed
+ *               RECORD_SIZE records (little-endian)
+ *   <path>.idx  open-addressing hash table mapping a key to its latest
+ *               record, used through a shared read/write memory mapping
+ * The index is a cache of the data file in native byte order. It is rebuilt
+ * from the data file whenever it is missing or does not cover the whole
+ * data file, e.g. after a crash.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Play.hpp"
+#include "PositionId.hpp"
+
+/**
+ * @struct PositionAnalysis
+ * @brief Analysis result of one position and roll.
+ */
+struct PositionAnalysis {
+    float equity = 0.0f;          ///< Cubeless equity for the player on roll
+    float winChance = 0.0f;       ///< Probability that the player on roll wins
+    float gammonChance = 0.0f;    ///< Probability that the player on roll wins a gammon
+    Play bestPlay;                ///< Best play for the roll (empty before the roll or when no move exists)
+    std::uint8_t depth = 0;       ///< Search depth of the analysis in plies
+    std::uint64_t timestamp = 0;  ///< Time of the analysis in seconds since the Unix epoch
+};
+
+/**
+ * @class PositionDatabase
+ * @brief Persistent map from position key and roll to analysis results.
+ *
+ * lookup() is lock-free and may run on any number of threads while another
+ * thread calls store(). Writers are serialized by an internal mutex.
+ * store() appends a record and then publishes it in the index with a
+ * release store, so a reader either sees the complete new record or the
+ * previous one. When the index fills up, a table of twice the size is built
+ * next to it and swapped in; readers still probing the old table keep it
+ * alive until they finish.
+ */
+class PositionDatabase {
+public:
+    /// Size of one record in the data file
+    static constexpr std::size_t RECORD_SIZE = 48;
+
+    /// Index capacity of a new database (slots, power of two)
+    static constexpr std::uint64_t INITIAL_CAPACITY = 1024;
+
+    /**
+     * @brief Constructor creating a closed database.
+     */
+    PositionDatabase();
+
+    /**
+     * @brief Destructor closing the database.
+     */
+    ~PositionDatabase();
+
+    PositionDatabase(const PositionDatabase&) = delete;
+    PositionDatabase& operator=(const PositionDatabase&) = delete;
+
+    /**
+     * @brief Opens a database, creating its files if needed.
+     *
+     * A partially written record at the end of the data file is discarded.
+     * Must not be called while other threads use the database.
+     *
+     * @param path Path without extension
+     * @return False if the files could not be opened or are not database files
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Closes the database. Must not be called while other threads use it.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a database is open.
+     * @return True after a successful open()
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Looks up the latest analysis of a position.
+     * @param key Position key (see PositionId)
+     * @param die1 First die (0 before the roll)
+     * @param die2 Second die (0 before the roll)
+     * @param analysis Receives the analysis
+     * @return False if the position is not in the database
+     */
+    bool lookup(const PositionKey& key, int die1, int die2, PositionAnalysis& analysis) const;
+
+    /**
+     * @brief Stores an analysis, replacing any previous one for the same position and roll.
+     * @param key Position key (see PositionId)
+     * @param die1 First die (0 before the roll)
+     * @param die2 Second die (0 before the roll)
+     * @param analysis Analysis to store
+     * @return False if writing failed
+     */
+    bool store(const PositionKey& key, int die1, int die2, const PositionAnalysis& analysis);
+
+    /**
+     * @brief Gets the number of distinct positions and rolls stored.
+     * @return Entry count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Writes the data file and index through to disk.
+     * @return False if syncing failed
+     */
+    bool flush();
+
+private:
+    struct Index;
+
+    /**
+     * @brief Builds an index file of the given capacity from the current index or the data file.
+     * @param capacity Slot count (power of two)
+     * @param fromDataFile True to scan the data file instead of copying the current index
+     * @return New index, or null on failure
+     */
+    std::shared_ptr<Index> buildIndex(std::uint64_t capacity, bool fromDataFile);
+
+    /**
+     * @brief Points the index entry of a position and roll at a record, adding the entry if needed (writer only).
+     * @param index Index to update
+     * @param match Key bytes followed by the dice byte, as stored at the start of a record
+     * @param record Record number
+     */
+    void publish(Index& index, const std::uint8_t* match, std::uint64_t record);
+
+    /**
+     * @brief Reads one record from the data file.
+     * @param record Record number
+     * @param bytes Receives RECORD_SIZE bytes
+     * @return False if reading failed
+     */
+    bool readRecord(std::uint64_t record, std::uint8_t* bytes) const;
+
+    std::string m_path;                    ///< Path without extension
+    std::shared_ptr<Index> m_index;        ///< Current index (accessed with std::atomic_load/store)
+    std::uint64_t m_recordCount;           ///< Records in the data file (writer only)
+    std::mutex m_writeMutex;               ///< Serializes store() calls
+    bool m_open;                           ///< True while open
+#ifdef _WIN32
+    void* m_dataFile;                      ///< Data file handle
+#else
+    int m_dataFile;                        ///< Data file descriptor
+#endif
+};
@@ -0,0 +1,86 @@
+/**
+ * @file PositionId.hpp
+ * @brief Defines the 10-byte position key and its base64 text form.
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "Color.hpp"
+
+class Board;
+struct GameStateDTO;
+
+/// Bit-packed checker layout of a position (80 bits)
+using PositionKey = std::array<std::uint8_t, 10>;
+
+/**
+ * @class PositionId
+ * @brief Encodes checker layouts as compact keys, modelled on the gnubg position ID.
+ *
+ * The key is a bit string written least significant bit first. For the
+ * player on roll, then for the opponent, each of the 25 points (the player's
+ * own 1-point through 24-point, then the bar) contributes one 1-bit per
+ * checker followed by a 0-bit. Fifteen checkers per side and 50 separators
+ * give exactly 80 bits; borne-off checkers are implied. Keys are built and
+ * read with 64-bit word operations rather than bit by bit.
+ *
+ * Dice, phase and the cube are not part of the key.
+ */
+class PositionId {
+public:
+    /// Length of the base64 text form
+    static constexpr std::size_t TEXT_SIZE = 14;
+
+    /**
+     * @brief Encodes a board seen from the player on roll.
+     * @param board Checker layout
+     * @param onRoll Player to move
+     * @return Position key
+     */
+    static PositionKey encode(const Board& board, Color onRoll);
+
+    /**
+     * @brief Encodes a game state (player on roll taken from currentPlayer).
+     * @param state Game state
+     * @return Position key
+     */
+    static PositionKey encode(const GameStateDTO& state);
+
+    /**
+     * @brief Decodes a key into a board.
+     * @param key Position key
+     * @param onRoll Color of the player on roll
+     * @param board Receives the layout (unchanged if the key is invalid)
+     * @return False if the key does not describe a legal layout
+     */
+    static bool decode(const PositionKey& key, Color onRoll, Board& board);
+
+    /**
+     * @brief Checks that a key describes a legal layout.
+     *
+     * Each side has at most 15 checkers and no point holds checkers of both sides.
+     *
+     * @param key Position key
+     * @return True if decode() would succeed
+     */
+    static bool isValid(const PositionKey& key);
+
+    /**
+     * @brief Converts a key to its 14-character base64 form (no padding).
+     * @param key Position key
+     * @return Text form
+     */
+    static std::string toString(const PositionKey& key);
+
+    /**
+     * @brief Parses the base64 form produced by toString.
+     * @param text 14-character text
+     * @param key Receives the key
+     * @return False if the text is malformed
+     */
+    static bool fromString(std::string_view text, PositionKey& key);
+};
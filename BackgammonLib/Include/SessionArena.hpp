@@ -0,0 +1,50 @@
+/**
+ * @file SessionArena.hpp
+ * @brief Defines the SessionArena class, a bump allocator for per-game data.
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * @class SessionArena
+ * @brief Monotonic memory arena for the short-lived data of one game session.
+ *
+ * Move lists and move history are allocated from the arena through
+ * std::pmr containers. Individual deallocations are free no-ops; everything
+ * is released in bulk by release() when the game ends. The first
+ * INLINE_BYTES come from storage inside the arena itself, so a typical game
+ * never touches the heap.
+ */
+class SessionArena {
+public:
+    /// Bytes of inline storage used before falling back to the heap
+    static constexpr std::size_t INLINE_BYTES = 4096;
+
+    /**
+     * @brief Constructor creating an empty arena.
+     */
+    SessionArena();
+
+    SessionArena(const SessionArena&) = delete;
+    SessionArena& operator=(const SessionArena&) = delete;
+
+    /**
+     * @brief Gets the memory resource to pass to std::pmr containers.
+     * @return Arena memory resource
+     */
+    std::pmr::memory_resource* resource();
+
+    /**
+     * @brief Releases every allocation made from the arena at once.
+     *
+     * Containers using the arena must be emptied or destroyed beforehand.
+     */
+    void release();
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, INLINE_BYTES> m_inline; ///< Inline first block
+    std::pmr::monotonic_buffer_resource m_resource;                         ///< Bump allocator
+};
@@ -0,0 +1,78 @@
+/**
+ * @file SnapshotPublisher.hpp
+ * @brief Defines immutable game snapshots and the publisher sharing them with other threads.
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "GameStateDTO.hpp"
+#include "IGame.hpp"
+#include "IGameObserver.hpp"
+#include "Play.hpp"
+
+/**
+ * @struct GameSnapshot
+ * @brief A consistent, never modified copy of a game's state.
+ */
+struct GameSnapshot {
+    std::uint64_t version = 0;                 ///< Publication number, 1 for the first snapshot
+    GameStateDTO state;                        ///< Board, dice and player on roll
+    GamePhase phase = GamePhase::NOT_STARTED;  ///< Phase of the game
+    bool hasLegalMoves = false;                ///< Whether legalMoves was filled in
+    std::vector<CheckerMove> legalMoves;       ///< Every legal single move, grouped by source column
+
+    /**
+     * @brief Gets the legal destinations of one source column.
+     * @param fromIndex Source column (0-23 or the bar index)
+     * @return Destinations, empty if legalMoves was not filled in
+     */
+    std::vector<int> targetsFrom(int fromIndex) const;
+};
+
+/**
+ * @class SnapshotPublisher
+ * @brief Publishes GameSnapshots that any number of threads read without locking.
+ *
+ * The thread that owns the game calls publish() after changing it (or
+ * registers the publisher as an observer of a Game, which publishes on
+ * every notification). Each publication builds a new snapshot and swaps
+ * it in with std::atomic_store; readers take a reference with
+ * std::atomic_load and keep a consistent position for as long as they hold
+ * it, however far the game moves on in the meantime.
+ */
+class SnapshotPublisher : public IGameObserver {
+public:
+    /**
+     * @brief Constructor.
+     * @param game Game whose state is published (read only by the publishing thread)
+     * @param withLegalMoves Whether snapshots include the legal moves of the player on roll
+     */
+    explicit SnapshotPublisher(const IGame& game, bool withLegalMoves = false);
+
+    /**
+     * @brief Publishes the current state of the game; call from the thread that changes it.
+     */
+    void publish();
+
+    /**
+     * @brief Gets the latest snapshot; safe from any thread.
+     * @return Latest snapshot, or null before the first publish()
+     */
+    std::shared_ptr<const GameSnapshot> current() const;
+
+    void onGameStarted() override;
+    void onDiceRolled(Color player, int d1, int d2) override;
+    void onMoveMade(Color player, int fromIndex, int toIndex, MoveResult result) override;
+    void onPlayMade(Color player, const Play& play) override;
+    void onTurnChanged(Color currentPlayer) override;
+    void onStateRestored() override;
+    void onGameFinished(Color winner) override;
+
+private:
+    const IGame& m_game;                            ///< Published game
+    bool m_withLegalMoves;                          ///< Whether to collect the legal moves
+    std::uint64_t m_version;                        ///< Version of the last snapshot (publisher only)
+    std::shared_ptr<const GameSnapshot> m_current;  ///< Latest snapshot (accessed with std::atomic_load/store)
+};
@@ -0,0 +1,148 @@
+/**
+ * @file Tracing.hpp
+ * @brief Defines the span tracer exporting Chrome / Perfetto trace-event JSON.
+ *
+ * BG_TRACE_SCOPE is compiled in only when BACKGAMMON_TRACING is defined
+ * (CMake option of the same name). Even then nothing is recorded until
+ * Tracer::setEnabled(true) is called, so a tracing build can run untraced at
+ * the cost of one relaxed load per span.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @class Tracer
+ * @brief Process-wide collector of completed spans.
+ *
+ * Every thread records into its own fixed-capacity buffer, created on the
+ * thread's first span; the owning thread is the only writer and publishes
+ * each event with a release store, so recording never takes a lock. When a
+ * buffer is full, further spans of that thread are counted as dropped.
+ * Buffers outlive their threads so a trace can be written after joining.
+ *
+ * Span names must be string literals (only the pointer is stored).
+ */
+class Tracer {
+public:
+    /// Events per thread buffer (24 bytes each)
+    static constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;
+
+    /**
+     * @brief Starts or stops recording.
+     * @param enabled True to record spans
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether spans are being recorded.
+     * @return True if recording
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Names the calling thread in the trace (e.g. "executor 2").
+     * @param name Thread name
+     */
+    static void setThreadName(const std::string& name);
+
+    /**
+     * @brief Records a completed span on the calling thread.
+     * @param name Span name (string literal)
+     * @param beginNs Start time from now()
+     * @param endNs End time from now()
+     */
+    static void record(const char* name, std::uint64_t beginNs, std::uint64_t endNs);
+
+    /**
+     * @brief Gets the current trace timestamp.
+     * @return Nanoseconds since the tracer epoch
+     */
+    static std::uint64_t now() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch()).count());
+    }
+
+    /**
+     * @brief Gets the number of spans lost to full buffers.
+     * @return Dropped span count across all threads
+     */
+    static std::uint64_t droppedCount();
+
+    /**
+     * @brief Discards all recorded spans.
+     *
+     * Must not race with threads that are recording; call it while tracing
+     * is disabled and traced work is idle.
+     */
+    static void clear();
+
+    /**
+     * @brief Writes all recorded spans as a Chrome trace-event JSON document.
+     *
+     * The output opens in chrome://tracing and ui.perfetto.dev. May be called
+     * while other threads are still recording; their newer spans are skipped.
+     *
+     * @param out Destination stream
+     */
+    static void writeChromeJson(std::ostream& out);
+
+    /**
+     * @brief Writes the Chrome trace JSON to a file.
+     * @param path Destination file
+     * @return False if the file could not be written
+     */
+    static bool writeFile(const std::string& path);
+
+private:
+    /**
+     * @brief Gets the time origin of all trace timestamps.
+     * @return Process-wide epoch
+     */
+    static std::chrono::steady_clock::time_point epoch();
+};
+
+/**
+ * @class TraceSpan
+ * @brief Records the lifetime of a scope as one span.
+ *
+ * The span is attributed to the thread that ends it. It must not stay open
+ * across a co_await: a coroutine resumed on another thread would record it
+ * there, and the span would break the nesting of that thread's timeline.
+ */
+class TraceSpan {
+public:
+    /**
+     * @brief Constructor starting the span if tracing is enabled.
+     * @param name Span name (string literal)
+     */
+    explicit TraceSpan(const char* name) : m_name(Tracer::isEnabled() ? name : nullptr), m_begin(m_name ? Tracer::now() : 0) {}
+
+    /**
+     * @brief Destructor recording the span.
+     */
+    ~TraceSpan() {
+        if (m_name) Tracer::record(m_name, m_begin, Tracer::now());
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* m_name;     ///< Span name, null when tracing was off at construction
+    std::uint64_t m_begin;  ///< Start timestamp
+};
+
+#define BG_TRACE_CONCAT_INNER(a, b) a##b
+#define BG_TRACE_CONCAT(a, b) BG_TRACE_CONCAT_INNER(a, b)
+
+/// Records the rest of the enclosing scope as a span (no-op unless BACKGAMMON_TRACING)
+#ifdef BACKGAMMON_TRACING
+#define BG_TRACE_SCOPE(name) const TraceSpan BG_TRACE_CONCAT(bgTraceSpan_, __LINE__)(name)
+#else
+#define BG_TRACE_SCOPE(name) ((void)0)
+#endif
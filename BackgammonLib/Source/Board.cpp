@@ -30,6 +30,13 @@ Board::Board() {for (int i = 0; i < 24; ++i) {
     m_columns[18] = Column(5, Color::WHITE);
 }
 
+Board::Board(const PositionKey& key, Color onRoll) : m_barCount{ 0, 0 }, m_borneOffCount{ 0, 0 } {
+    for (int i = 0; i < 24; ++i) {
+        m_columns[i] = Column(0, Color::NONE);
+    }
+    PositionId::decode(key, onRoll, *this);
+}
+
 Board::~Board() {
 }
 
@@ -79,4 +86,16 @@ void Board::incrementBorneOffCount(int playerIndex) {
     if (playerIndex >= 0 && playerIndex < 2) {
         m_borneOffCount[playerIndex]++;
     }
-}
\ No newline at end of file
+}
+
+void Board::setBarCount(int playerIndex, int count) {
+    if (playerIndex >= 0 && playerIndex < 2) {
+        m_barCount[playerIndex] = count;
+    }
+}
+
+void Board::setBorneOffCount(int playerIndex, int count) {
+    if (playerIndex >= 0 && playerIndex < 2) {
+        m_borneOffCount[playerIndex] = count;
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * @file CommandHistory.cpp
+ * @brief Implementation of the undo and redo ring buffer.
+ */
+
+#include "CommandHistory.hpp"
+
+CommandHistory::CommandHistory(std::size_t capacity)
+    : m_ring(capacity > 0 ? capacity : 1, GameCommand(PassCommand())), m_oldest(0), m_undoable(0), m_redoable(0) {
+}
+
+MoveResult CommandHistory::execute(IGame& game, const GameCommand& command) {
+    // Executed in its slot so the recorded state is not copied again; the slot
+    // (the oldest command once the ring is full) is restored if nothing changed
+    const std::size_t target = slot(m_undoable < m_ring.size() ? m_undoable : 0);
+    GameCommand previous = m_ring[target];
+    m_ring[target] = command;
+    const MoveResult result = executeCommand(m_ring[target], game);
+    if (result != MoveResult::SUCCESS) {
+        m_ring[target] = previous;
+        return result;
+    }
+
+    if (m_undoable == m_ring.size()) {
+        m_oldest = slot(1);
+    }
+    else {
+        ++m_undoable;
+    }
+    m_redoable = 0;
+    return result;
+}
+
+bool CommandHistory::undo(IGame& game) {
+    if (m_undoable == 0) return false;
+    --m_undoable;
+    ++m_redoable;
+    undoCommand(m_ring[slot(m_undoable)], game);
+    return true;
+}
+
+bool CommandHistory::redo(IGame& game) {
+    if (m_redoable == 0) return false;
+    if (executeCommand(m_ring[slot(m_undoable)], game) != MoveResult::SUCCESS) {
+        // The game was changed outside the history; the rest cannot apply either
+        m_redoable = 0;
+        return false;
+    }
+    ++m_undoable;
+    --m_redoable;
+    return true;
+}
+
+void CommandHistory::clear() {
+    m_oldest = 0;
+    m_undoable = 0;
+    m_redoable = 0;
+}
+
+std::size_t CommandHistory::undoCount() const {
+    return m_undoable;
+}
+
+std::size_t CommandHistory::redoCount() const {
+    return m_redoable;
+}
+
+std::size_t CommandHistory::capacity() const {
+    return m_ring.size();
+}
+
+std::size_t CommandHistory::slot(std::size_t i) const {
+    return (m_oldest + i) % m_ring.size();
+}
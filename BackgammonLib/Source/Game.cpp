@@ -9,13 +9,20 @@
  * - Bearing off pieces from the home board
  * - Win detection when a player bears off all 15 pieces
  * - Turn management and automatic turn switching
+ *
+ * The engine is explicitly instantiated for the ObserverList (Game) and
+ * NoObservers (HeadlessGame) policies at the end of this file. Public entry
+ * points and observer dispatch are timed with BG_INSTRUMENT and traced with
+ * BG_TRACE_SCOPE, which compile to nothing unless BACKGAMMON_INSTRUMENTATION
+ * and BACKGAMMON_TRACING respectively are defined.
  */
 
 #include <algorithm>
 #include <random>
 #include <cmath>
 #include "Game.hpp"
-#include "RollOpeningDiceCommand.hpp"
+#include "Instrumentation.hpp"
+#include "Tracing.hpp"
 
 /// Special index value for bearing off white pieces
 constexpr uint32_t OFF_BOARD_COLOR_WHITE = 24;
@@ -23,15 +30,32 @@ constexpr uint32_t OFF_BOARD_COLOR_WHITE = 24;
 /// Special index value for bearing off black pieces
 constexpr uint32_t OFF_BOARD_COLOR_BLACK = -1;
 
-Game::Game()
+namespace {
+    /// Whether a value can be shown by a die
+    constexpr bool isDieValue(int value) {
+        return value >= 1 && value <= 6;
+    }
+}
+
+template <typename ObserverPolicy>
+BasicGame<ObserverPolicy>::BasicGame()
     : m_phase(GamePhase::NOT_STARTED), m_currentPlayer(Color::WHITE), m_dice{ 0, 0 }, m_diceRolled(false),
-      m_openingDiceWhite(0), m_openingDiceBlack(0) {
+      m_notifications(0), m_openingDiceWhite(0), m_openingDiceBlack(0) {
+}
+
+template <typename ObserverPolicy>
+BasicGame<ObserverPolicy>::BasicGame(const PositionKey& key, Color onRoll)
+    : m_board(key, onRoll), m_phase(GamePhase::NOT_STARTED), m_currentPlayer(onRoll), m_dice{ 0, 0 },
+      m_diceRolled(false), m_notifications(0), m_openingDiceWhite(0), m_openingDiceBlack(0) {
+    if (PositionId::isValid(key)) m_phase = GamePhase::IN_PROGRESS;
 }
 
-Game::~Game() {
+template <typename ObserverPolicy>
+BasicGame<ObserverPolicy>::~BasicGame() {
 }
 
-void Game::start() {
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::start() {
     m_board = Board(); // reset board
     m_phase = GamePhase::OPENING_ROLL_WHITE;
     m_currentPlayer = Color::WHITE;
@@ -42,15 +66,32 @@ void Game::start() {
     notifyGameStarted();
 }
 
-GamePhase Game::getPhase() const {
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::reset() {
+    m_board = Board();
+    m_phase = GamePhase::NOT_STARTED;
+    m_currentPlayer = Color::WHITE;
+    m_dice[0] = m_dice[1] = 0;
+    m_diceRolled = false;
+    m_openingDiceWhite = 0;
+    m_openingDiceBlack = 0;
+    m_observers.clear();
+}
+
+template <typename ObserverPolicy>
+GamePhase BasicGame<ObserverPolicy>::getPhase() const {
     return m_phase;
 }
 
-Color Game::getCurrentPlayer() const {
+template <typename ObserverPolicy>
+Color BasicGame<ObserverPolicy>::getCurrentPlayer() const {
     return m_currentPlayer;
 }
 
-void Game::rollDice() {
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::rollDice() {
+    BG_INSTRUMENT(InstrumentedOp::ROLL_DICE);
+    BG_TRACE_SCOPE("rollDice");
     if (m_phase != GamePhase::IN_PROGRESS) {
         return;
     }
@@ -58,21 +99,42 @@ void Game::rollDice() {
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<int> dist(1, 6);
-    m_dice[0] = dist(gen);
-    m_dice[1] = dist(gen);
+    const int d1 = dist(gen);
+    const int d2 = dist(gen);
+    applyDice(d1, d2);
+}
+
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::rollDice(int d1, int d2) {
+    BG_INSTRUMENT(InstrumentedOp::ROLL_DICE);
+    BG_TRACE_SCOPE("rollDice");
+    if (m_phase != GamePhase::IN_PROGRESS || !isDieValue(d1) || !isDieValue(d2)) {
+        return;
+    }
+
+    applyDice(d1, d2);
+}
+
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::applyDice(int d1, int d2) {
+    m_dice[0] = d1;
+    m_dice[1] = d2;
     m_diceRolled = true;
     notifyDiceRolled();
 }
 
-const std::array<int, 2> Game::getDice() const {
+template <typename ObserverPolicy>
+const std::array<int, 2> BasicGame<ObserverPolicy>::getDice() const {
     return m_dice;
 }
 
-int Game::playerIndex(Color player) const {
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::playerIndex(Color player) const {
     return (player == Color::WHITE) ? 0 : 1;
 }
 
-bool Game::hasAllPiecesHome(Color player) const {
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::hasAllPiecesHome(Color player) const {
     if (m_board.getBarCount(playerIndex(player)) > 0) return false;
 
     if (player == Color::WHITE) {
@@ -95,18 +157,22 @@ bool Game::hasAllPiecesHome(Color player) const {
     return true;
 }
 
-bool Game::canBearOff(Color player) const
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::canBearOff(Color player) const
 {
     if (!hasAllPiecesHome(player)) return false;
     return true;
 }
 
-bool Game::isHomeBoard(int index, Color player) const {
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::isHomeBoard(int index, Color player) const {
     if (player == Color::WHITE) return index >= 18 && index <= 23;
     return index >= 0 && index <= 5;
 }
 
-bool Game::hasMovesAvailable() const {
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::hasMovesAvailable() const {
+    BG_INSTRUMENT(InstrumentedOp::HAS_MOVES_AVAILABLE);
     if (!m_diceRolled) return false;
 
     int pIndex = playerIndex(m_currentPlayer);
@@ -165,7 +231,8 @@ bool Game::hasMovesAvailable() const {
     return false;
 }
 
-bool Game::canSelectPoint(int index) const {
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::canSelectPoint(int index) const {
     if (m_phase != GamePhase::IN_PROGRESS) return false;
     if (!m_diceRolled) return false;
 
@@ -184,10 +251,26 @@ bool Game::canSelectPoint(int index) const {
     return true;
 }
 
-std::vector<int> Game::getLegalTargets(int fromIndex) const {
+template <typename ObserverPolicy>
+std::vector<int> BasicGame<ObserverPolicy>::getLegalTargets(int fromIndex) const {
+    BG_INSTRUMENT(InstrumentedOp::GET_LEGAL_TARGETS);
     std::vector<int> targets;
-    if (!m_diceRolled) return targets;
-    if (!canSelectPoint(fromIndex)) return targets;
+    appendLegalTargets(fromIndex, targets);
+    return targets;
+}
+
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::getLegalTargets(int fromIndex, std::pmr::vector<int>& targets) const {
+    BG_INSTRUMENT(InstrumentedOp::GET_LEGAL_TARGETS);
+    targets.clear();
+    appendLegalTargets(fromIndex, targets);
+}
+
+template <typename ObserverPolicy>
+template <typename TargetList>
+void BasicGame<ObserverPolicy>::appendLegalTargets(int fromIndex, TargetList& targets) const {
+    if (!m_diceRolled) return;
+    if (!canSelectPoint(fromIndex)) return;
 
     int pIndex = playerIndex(m_currentPlayer);
     int dirs[2] = {m_dice[0], m_dice[1] };
@@ -203,7 +286,7 @@ std::vector<int> Game::getLegalTargets(int fromIndex) const {
                 }
             }
         }
-        return targets;
+        return;
     }
 
     for (int d : dirs) {
@@ -262,10 +345,87 @@ std::vector<int> Game::getLegalTargets(int fromIndex) const {
         }
     }
 
-    return targets;
 }
 
-MoveResult Game::makeMove(int fromIndex, int toIndex) {
+template <typename ObserverPolicy>
+MoveResult BasicGame<ObserverPolicy>::makeMove(int fromIndex, int toIndex) {
+    BG_INSTRUMENT(InstrumentedOp::MAKE_MOVE);
+    BG_TRACE_SCOPE("makeMove");
+    const MoveResult result = applyMove(fromIndex, toIndex);
+    if (result != MoveResult::SUCCESS) return result;
+
+    notifyMoveMade(fromIndex, toIndex, MoveResult::SUCCESS);
+
+    if (hasWon()) {
+        m_phase = GamePhase::FINISHED;
+        notifyGameFinished(m_currentPlayer);
+    }
+    else if (isTurnOver()) {
+        m_diceRolled = false;
+        switchTurn();
+    }
+    return MoveResult::SUCCESS;
+}
+
+template <typename ObserverPolicy>
+MoveResult BasicGame<ObserverPolicy>::makePlay(const Play& play) {
+    BG_INSTRUMENT(InstrumentedOp::MAKE_PLAY);
+    BG_TRACE_SCOPE("makePlay");
+    if (m_phase != GamePhase::IN_PROGRESS) return MoveResult::GAME_NOT_STARTED;
+    if (!m_diceRolled) return MoveResult::DICE_NOT_ROLLED;
+    if (play.count > Play::MAX_MOVES) return MoveResult::INVALID_MOVE;
+
+    // Moves go straight to the board and are rolled back if the play turns out illegal
+    const Board board = m_board;
+    const std::array<int, 2> dice = m_dice;
+    MoveResult result = MoveResult::SUCCESS;
+    bool won = false;
+    for (int i = 0; i < play.count; ++i) {
+        // The same checks makeMove uses to end a turn: nothing may follow them
+        if (won || (i > 0 && isTurnOver())) {
+            result = MoveResult::INVALID_MOVE;
+            break;
+        }
+        result = applyMove(play.moves[i].fromIndex, play.moves[i].toIndex);
+        if (result != MoveResult::SUCCESS) break;
+        won = hasWon();
+    }
+    // Dice that can still be played must not be left over
+    if (result == MoveResult::SUCCESS && !won && !isTurnOver()) result = MoveResult::INVALID_MOVE;
+
+    if (result != MoveResult::SUCCESS) {
+        m_board = board;
+        m_dice = dice;
+        return result;
+    }
+
+    notifyPlayMade(play);
+
+    if (won) {
+        m_phase = GamePhase::FINISHED;
+        notifyGameFinished(m_currentPlayer);
+    }
+    else {
+        // An empty play is a pass, which also clears the dice
+        if (play.count == 0) m_dice[0] = m_dice[1] = 0;
+        m_diceRolled = false;
+        switchTurn();
+    }
+    return MoveResult::SUCCESS;
+}
+
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::hasWon() const {
+    return m_board.getBorneOffCount(playerIndex(m_currentPlayer)) == 15;
+}
+
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::isTurnOver() const {
+    return (m_dice[0] == 0 && m_dice[1] == 0) || !hasMovesAvailable();
+}
+
+template <typename ObserverPolicy>
+MoveResult BasicGame<ObserverPolicy>::applyMove(int fromIndex, int toIndex) {
     if (m_phase != GamePhase::IN_PROGRESS) return MoveResult::GAME_NOT_STARTED;
     if (!m_diceRolled) return MoveResult::DICE_NOT_ROLLED;
 
@@ -346,15 +506,6 @@ MoveResult Game::makeMove(int fromIndex, int toIndex) {
             fromCol.removePiece();
             m_board.incrementBorneOffCount(pIndex);
             m_dice[dieIdx] = 0;
-
-            notifyMoveMade(fromIndex, toIndex, MoveResult::SUCCESS);
-
-            if (m_board.getBorneOffCount(pIndex) == 15) {
-                m_phase = GamePhase::FINISHED;
-                notifyGameFinished(m_currentPlayer);
-                return MoveResult::SUCCESS;
-            }
-
         }
         else {
             if (toIndex < 0 || toIndex >= 24) return MoveResult::INVALID_TO_COLUMN;
@@ -378,27 +529,21 @@ MoveResult Game::makeMove(int fromIndex, int toIndex) {
             m_dice[dieIdx] = 0;
         }
     }
-
-    notifyMoveMade(fromIndex, toIndex, MoveResult::SUCCESS);
-
-    if (m_dice[0] == 0 && m_dice[1] == 0) {
-        m_diceRolled = false;
-        switchTurn();
-    }
-    else if (!hasMovesAvailable()) {
-        m_diceRolled = false;
-        switchTurn();
-    }
-
     return MoveResult::SUCCESS;
 }
 
-int Game::getColumnCount(int index) const { return m_board.getColumn(index).getPieceCount(); }
-Color Game::getColumnColor(int index) const { return m_board.getColumn(index).getColor(); }
-int Game::getBarCount(Color player) const { return m_board.getBarCount(playerIndex(player)); }
-int Game::getBorneOffCount(Color player) const { return m_board.getBorneOffCount(playerIndex(player)); }
-
-GameStateDTO Game::getState() const {
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::getColumnCount(int index) const { return m_board.getColumn(index).getPieceCount(); }
+template <typename ObserverPolicy>
+Color BasicGame<ObserverPolicy>::getColumnColor(int index) const { return m_board.getColumn(index).getColor(); }
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::getBarCount(Color player) const { return m_board.getBarCount(playerIndex(player)); }
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::getBorneOffCount(Color player) const { return m_board.getBorneOffCount(playerIndex(player)); }
+
+template <typename ObserverPolicy>
+GameStateDTO BasicGame<ObserverPolicy>::getState() const {
+    BG_INSTRUMENT(InstrumentedOp::GET_STATE);
     GameStateDTO s;
     for (int i = 0; i < 24; ++i) {
         const Column& col = m_board.getColumn(i);
@@ -417,53 +562,153 @@ GameStateDTO Game::getState() const {
     return s;
 }
 
-void Game::addObserver(IGameObserver* observer) {
-    if (!observer) return;
-    if (std::find(m_observers.begin(), m_observers.end(), observer) == m_observers.end()) {
-        m_observers.push_back(observer);
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::loadState(const GameStateDTO& state, GamePhase phase) {
+    for (int i = 0; i < 24; ++i) {
+        m_board.getColumn(i) = Column(state.pieceCounts[i], state.pieceCounts[i] > 0 ? state.colors[i] : Color::NONE);
     }
+    m_board.setBarCount(0, state.barWhite);
+    m_board.setBarCount(1, state.barBlack);
+    m_board.setBorneOffCount(0, state.borneOffWhite);
+    m_board.setBorneOffCount(1, state.borneOffBlack);
+    m_phase = phase;
+    m_currentPlayer = state.currentPlayer;
+    m_dice[0] = state.dice1;
+    m_dice[1] = state.dice2;
+    m_diceRolled = (state.dice1 != 0 || state.dice2 != 0);
+    m_openingDiceWhite = state.openingDiceWhite;
+    m_openingDiceBlack = state.openingDiceBlack;
+}
+
+template <typename ObserverPolicy>
+GameMemento BasicGame<ObserverPolicy>::saveMemento() const {
+    GameMemento memento;
+    memento.state = getState();
+    memento.phase = m_phase;
+    memento.diceRolled = m_diceRolled;
+    memento.notifications = m_notifications;
+    return memento;
+}
+
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::restoreMemento(const GameMemento& memento) {
+    loadState(memento.state, memento.phase);
+    // Dice left over after a turn ended are shown but no longer playable
+    m_diceRolled = memento.diceRolled;
+    m_notifications = memento.notifications;
+    notifyStateRestored();
+}
+
+template <typename ObserverPolicy>
+std::uint64_t BasicGame<ObserverPolicy>::notificationCount() const {
+    return m_notifications;
+}
+
+template <typename ObserverPolicy>
+PositionKey BasicGame<ObserverPolicy>::positionKey() const {
+    return PositionId::encode(m_board, m_currentPlayer);
 }
 
-void Game::removeObserver(IGameObserver* observer) {
-    auto it = std::remove(m_observers.begin(), m_observers.end(), observer);
-    m_observers.erase(it, m_observers.end());
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::addObserver(IGameObserver* observer) {
+    m_observers.add(observer);
 }
 
-void Game::notifyGameStarted() { for (auto* o : m_observers) o->onGameStarted(); }
-void Game::notifyDiceRolled() { for (auto* o : m_observers) o->onDiceRolled(m_currentPlayer, m_dice[0], m_dice[1]); }
-void Game::notifyMoveMade(int fromIndex, int toIndex, MoveResult result) { for (auto* o : m_observers) o->onMoveMade(m_currentPlayer, fromIndex, toIndex, result); }
-void Game::notifyTurnChanged() { for (auto* o : m_observers) o->onTurnChanged(m_currentPlayer); }
-void Game::notifyGameFinished(Color winner) { for (auto* o : m_observers) o->onGameFinished(winner); }
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::removeObserver(IGameObserver* observer) {
+    m_observers.remove(observer);
+}
+
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyGameStarted() {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_GAME_STARTED);
+    BG_TRACE_SCOPE("notify:onGameStarted");
+    ++m_notifications;
+    m_observers.forEach([&](IGameObserver* o) { o->onGameStarted(); });
+}
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyDiceRolled() {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_DICE_ROLLED);
+    BG_TRACE_SCOPE("notify:onDiceRolled");
+    ++m_notifications;
+    m_observers.forEach([&](IGameObserver* o) { o->onDiceRolled(m_currentPlayer, m_dice[0], m_dice[1]); });
+}
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyMoveMade(int fromIndex, int toIndex, MoveResult result) {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_MOVE_MADE);
+    BG_TRACE_SCOPE("notify:onMoveMade");
+    ++m_notifications;
+    m_observers.forEach([&](IGameObserver* o) { o->onMoveMade(m_currentPlayer, fromIndex, toIndex, result); });
+}
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyPlayMade(const Play& play) {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_PLAY_MADE);
+    BG_TRACE_SCOPE("notify:onPlayMade");
+    ++m_notifications;
+    m_observers.forEach([&](IGameObserver* o) { o->onPlayMade(m_currentPlayer, play); });
+}
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyTurnChanged() {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_TURN_CHANGED);
+    BG_TRACE_SCOPE("notify:onTurnChanged");
+    ++m_notifications;
+    m_observers.forEach([&](IGameObserver* o) { o->onTurnChanged(m_currentPlayer); });
+}
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyStateRestored() {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_STATE_RESTORED);
+    BG_TRACE_SCOPE("notify:onStateRestored");
+    m_observers.forEach([&](IGameObserver* o) { o->onStateRestored(); });
+}
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::notifyGameFinished(Color winner) {
+    BG_INSTRUMENT(InstrumentedOp::NOTIFY_GAME_FINISHED);
+    BG_TRACE_SCOPE("notify:onGameFinished");
+    ++m_notifications;
+    m_observers.forEach([&](IGameObserver* o) { o->onGameFinished(winner); });
+}
 
-void Game::switchTurn() {
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::switchTurn() {
     m_currentPlayer = (m_currentPlayer == Color::WHITE) ? Color::BLACK : Color::WHITE;
     notifyTurnChanged();
 }
 
-bool Game::isMoveBlocked(int toIndex, Color player) const {
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::isMoveBlocked(int toIndex, Color player) const {
     const Column& toCol = m_board.getColumn(toIndex);
     if (toCol.getPieceCount() >= 2 && toCol.getColor() != player) return true;
     return false;
 }
 
-bool Game::canHit(int toIndex, Color player) const {
+template <typename ObserverPolicy>
+bool BasicGame<ObserverPolicy>::canHit(int toIndex, Color player) const {
     const Column& toCol = m_board.getColumn(toIndex);
     return toCol.getPieceCount() == 1 && toCol.getColor() != player && toCol.getColor() != Color::NONE;
 }
 
-int Game::rollSingleDie() {
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::rollSingleDie() {
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<int> dist(1, 6);
     return dist(gen);
 }
 
-void Game::rollOpeningDice() {
-    auto rollFunc = [this]() { return rollSingleDie(); };
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::rollOpeningDice() {
+    if (m_phase != GamePhase::OPENING_ROLL_WHITE && m_phase != GamePhase::OPENING_ROLL_BLACK) {
+        return;
+    }
+    rollOpeningDice(rollSingleDie());
+}
+
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::rollOpeningDice(int value) {
+    if (!isDieValue(value)) return;
 
     if (m_phase == GamePhase::OPENING_ROLL_WHITE) {
-        RollOpeningDiceCommand rollWhiteCmd(rollFunc, Color::WHITE, m_openingDiceWhite);
-        rollWhiteCmd.execute();
+        m_openingDiceWhite = value;
 
         m_dice[0] = m_openingDiceWhite;
         m_dice[1] = 0;
@@ -475,8 +720,7 @@ void Game::rollOpeningDice() {
     }
 
     if (m_phase == GamePhase::OPENING_ROLL_BLACK) {
-        RollOpeningDiceCommand rollBlackCmd(rollFunc, Color::BLACK, m_openingDiceBlack);
-        rollBlackCmd.execute();
+        m_openingDiceBlack = value;
 
         if (m_openingDiceWhite == m_openingDiceBlack) {
             m_phase = GamePhase::OPENING_ROLL_COMPARE;
@@ -502,15 +746,18 @@ void Game::rollOpeningDice() {
     }
 }
 
-int Game::getOpeningDiceWhite() const {
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::getOpeningDiceWhite() const {
     return m_openingDiceWhite;
 }
 
-int Game::getOpeningDiceBlack() const {
+template <typename ObserverPolicy>
+int BasicGame<ObserverPolicy>::getOpeningDiceBlack() const {
     return m_openingDiceBlack;
 }
 
-void Game::startGameAfterOpening() {
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::startGameAfterOpening() {
     if (m_phase == GamePhase::OPENING_ROLL_COMPARE) {
         m_phase = GamePhase::IN_PROGRESS;
         m_dice[0] = 0;
@@ -520,7 +767,8 @@ void Game::startGameAfterOpening() {
     }
 }
 
-void Game::passTurn() {
+template <typename ObserverPolicy>
+void BasicGame<ObserverPolicy>::passTurn() {
     if (m_phase != GamePhase::IN_PROGRESS) {
         return;
     }
@@ -530,4 +778,7 @@ void Game::passTurn() {
     m_dice[1] = 0;
     m_diceRolled = false;
     switchTurn();
-}
\ No newline at end of file
+}
+
+template class BasicGame<ObserverList>;
+template class BasicGame<NoObservers>;
@@ -0,0 +1,137 @@
+/**
+ * @file GameArchive.cpp
+ * @brief Implementation of the indexed game archive writer and reader.
+ */
+
+#include "GameArchive.hpp"
+
+#include <cstring>
+
+namespace {
+    constexpr char MAGIC[4] = { 'B', 'G', 'A', '1' };        ///< File header
+    constexpr char INDEX_MAGIC[4] = { 'B', 'G', 'A', 'I' };  ///< Trailer marker
+
+    constexpr std::size_t INDEX_ENTRY_SIZE = 16;  ///< Bytes per index entry
+    constexpr std::size_t TRAILER_SIZE = 24;      ///< Bytes of the trailer
+
+    void putLE(std::vector<std::uint8_t>& out, std::uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    std::uint64_t getLE(const std::uint8_t* data, int bytes) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+        return value;
+    }
+}
+
+GameArchiveWriter::GameArchiveWriter(const std::string& path)
+    : m_out(path, std::ios::binary | std::ios::trunc), m_offset(sizeof(MAGIC)), m_finished(false) {
+    m_out.write(MAGIC, sizeof(MAGIC));
+}
+
+GameArchiveWriter::~GameArchiveWriter() {
+    if (!m_finished) finish();
+}
+
+bool GameArchiveWriter::isOpen() const {
+    return m_out.is_open() && m_out.good();
+}
+
+void GameArchiveWriter::append(const GameRecord& record) {
+    m_scratch.clear();
+    record.encode(m_scratch);
+
+    const std::size_t eventBytes = record.events.size() * GameEvent::ENCODED_SIZE;
+    m_index.push_back(IndexEntry{ m_offset, static_cast<std::uint32_t>(m_scratch.size() - eventBytes),
+                                  static_cast<std::uint32_t>(record.events.size()) });
+
+    m_out.write(reinterpret_cast<const char*>(m_scratch.data()), static_cast<std::streamsize>(m_scratch.size()));
+    m_offset += m_scratch.size();
+}
+
+bool GameArchiveWriter::finish() {
+    if (m_finished) return static_cast<bool>(m_out);
+    m_finished = true;
+
+    std::vector<std::uint8_t> tail;
+    tail.reserve(m_index.size() * INDEX_ENTRY_SIZE + TRAILER_SIZE);
+    for (const IndexEntry& e : m_index) {
+        putLE(tail, e.offset, 8);
+        putLE(tail, e.headerSize, 4);
+        putLE(tail, e.eventCount, 4);
+    }
+    putLE(tail, m_offset, 8);
+    putLE(tail, m_index.size(), 8);
+    tail.insert(tail.end(), INDEX_MAGIC, INDEX_MAGIC + sizeof(INDEX_MAGIC));
+    putLE(tail, 0, 4);
+
+    m_out.write(reinterpret_cast<const char*>(tail.data()), static_cast<std::streamsize>(tail.size()));
+    m_out.close();
+    return !m_out.fail();
+}
+
+bool GameArchive::open(const std::string& path) {
+    close();
+    if (!m_file.open(path)) return false;
+
+    const std::uint8_t* data = m_file.data();
+    const std::size_t size = m_file.size();
+    if (size < sizeof(MAGIC) + TRAILER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        close();
+        return false;
+    }
+
+    const std::uint8_t* trailer = data + size - TRAILER_SIZE;
+    if (std::memcmp(trailer + 16, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        close();
+        return false;
+    }
+
+    const std::uint64_t indexOffset = getLE(trailer, 8);
+    const std::uint64_t gameCount = getLE(trailer + 8, 8);
+    const std::size_t indexLimit = size - TRAILER_SIZE;
+    if (indexOffset < sizeof(MAGIC) || indexOffset > indexLimit
+        || gameCount > (indexLimit - indexOffset) / INDEX_ENTRY_SIZE) {
+        close();
+        return false;
+    }
+
+    // Every record must lie between the header and the index
+    for (std::uint64_t k = 0; k < gameCount; ++k) {
+        const std::uint8_t* entry = data + indexOffset + k * INDEX_ENTRY_SIZE;
+        const std::uint64_t offset = getLE(entry, 8);
+        const std::uint64_t length = getLE(entry + 8, 4) + getLE(entry + 12, 4) * GameEvent::ENCODED_SIZE;
+        if (offset < sizeof(MAGIC) || offset > indexOffset || length > indexOffset - offset) {
+            close();
+            return false;
+        }
+    }
+
+    m_index = data + indexOffset;
+    m_gameCount = static_cast<std::size_t>(gameCount);
+    return true;
+}
+
+void GameArchive::close() {
+    m_file.close();
+    m_index = nullptr;
+    m_gameCount = 0;
+}
+
+bool GameArchive::isOpen() const {
+    return m_file.isOpen();
+}
+
+std::size_t GameArchive::gameCount() const {
+    return m_gameCount;
+}
+
+GameView GameArchive::game(std::size_t index) const {
+    if (index >= m_gameCount) return GameView();
+    const std::uint8_t* entry = m_index + index * INDEX_ENTRY_SIZE;
+    const std::size_t offset = static_cast<std::size_t>(getLE(entry, 8));
+    const std::size_t headerSize = static_cast<std::size_t>(getLE(entry + 8, 4));
+    const std::size_t eventCount = static_cast<std::size_t>(getLE(entry + 12, 4));
+    return GameView(m_file.data() + offset, headerSize + eventCount * GameEvent::ENCODED_SIZE, headerSize, eventCount);
+}
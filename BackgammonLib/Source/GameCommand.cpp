@@ -0,0 +1,82 @@
+/**
+ * @file GameCommand.cpp
+ * @brief Implementation of the game action commands.
+ */
+
+#include "GameCommand.hpp"
+
+namespace {
+    /// Whether a value can be shown by a die
+    bool isDieValue(int value) {
+        return value >= 1 && value <= 6;
+    }
+}
+
+MoveResult RollOpeningDiceCommand::execute(IGame& game) {
+    const GamePhase phase = game.getPhase();
+    if (phase != GamePhase::OPENING_ROLL_WHITE && phase != GamePhase::OPENING_ROLL_BLACK) return MoveResult::GAME_NOT_STARTED;
+    if (m_value != 0 && !isDieValue(m_value)) return MoveResult::INVALID_MOVE;
+
+    m_before = game.saveMemento();
+    if (m_value == 0) {
+        game.rollOpeningDice();
+        m_value = (phase == GamePhase::OPENING_ROLL_WHITE) ? game.getOpeningDiceWhite() : game.getOpeningDiceBlack();
+    }
+    else {
+        game.rollOpeningDice(m_value);
+    }
+    return MoveResult::SUCCESS;
+}
+
+MoveResult StartAfterOpeningCommand::execute(IGame& game) {
+    if (game.getPhase() != GamePhase::OPENING_ROLL_COMPARE) return MoveResult::GAME_NOT_STARTED;
+
+    m_before = game.saveMemento();
+    game.startGameAfterOpening();
+    return MoveResult::SUCCESS;
+}
+
+MoveResult RollDiceCommand::execute(IGame& game) {
+    if (game.getPhase() != GamePhase::IN_PROGRESS) return MoveResult::GAME_NOT_STARTED;
+    const bool random = m_d1 == 0 && m_d2 == 0;
+    if (!random && (!isDieValue(m_d1) || !isDieValue(m_d2))) return MoveResult::INVALID_MOVE;
+
+    m_before = game.saveMemento();
+    if (random) {
+        game.rollDice();
+        const auto dice = game.getDice();
+        m_d1 = dice[0];
+        m_d2 = dice[1];
+    }
+    else {
+        game.rollDice(m_d1, m_d2);
+    }
+    return MoveResult::SUCCESS;
+}
+
+MoveResult MoveCommand::execute(IGame& game) {
+    // Saved up front; a failed move leaves the game as it was anyway
+    m_before = game.saveMemento();
+    return game.makeMove(m_move.fromIndex, m_move.toIndex);
+}
+
+MoveResult PlayCommand::execute(IGame& game) {
+    m_before = game.saveMemento();
+    return game.makePlay(m_play);
+}
+
+MoveResult PassCommand::execute(IGame& game) {
+    if (game.getPhase() != GamePhase::IN_PROGRESS) return MoveResult::GAME_NOT_STARTED;
+
+    m_before = game.saveMemento();
+    game.passTurn();
+    return MoveResult::SUCCESS;
+}
+
+MoveResult executeCommand(GameCommand& command, IGame& game) {
+    return std::visit([&game](auto& c) { return c.execute(game); }, command);
+}
+
+void undoCommand(const GameCommand& command, IGame& game) {
+    std::visit([&game](const auto& c) { c.undo(game); }, command);
+}
@@ -0,0 +1,302 @@
+/**
+ * @file GameJournal.cpp
+ * @brief Implementation of the game journal.
+ */
+
+#include "GameJournal.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr const char* SEGMENT_SUFFIX = ".log";
+    constexpr std::size_t LSN_DIGITS = 16;
+
+    std::uint8_t checkByte(const std::uint8_t* in) {
+        std::uint8_t check = 0xA5;
+        for (std::size_t i = 0; i + 1 < JournalEntry::ENCODED_SIZE; ++i) {
+            check = static_cast<std::uint8_t>(((check << 1) | (check >> 7)) ^ in[i]);
+        }
+        return check;
+    }
+
+    std::string segmentPath(const std::string& prefix, std::uint64_t firstLsn) {
+        static const char HEX[] = "0123456789abcdef";
+        std::string digits(LSN_DIGITS, '0');
+        for (std::size_t i = 0; i < LSN_DIGITS; ++i) {
+            digits[LSN_DIGITS - 1 - i] = HEX[(firstLsn >> (4 * i)) & 0xF];
+        }
+        return prefix + "." + digits + SEGMENT_SUFFIX;
+    }
+
+    /**
+     * @brief Lists the segments of a journal as (first LSN, path), sorted by LSN.
+     */
+    std::vector<std::pair<std::uint64_t, std::string>> listSegments(const std::string& prefix) {
+        namespace fs = std::filesystem;
+        std::vector<std::pair<std::uint64_t, std::string>> segments;
+
+        const fs::path base(prefix);
+        const fs::path directory = base.parent_path().empty() ? fs::path(".") : base.parent_path();
+        const std::string stem = base.filename().string() + ".";
+        const std::size_t nameSize = stem.size() + LSN_DIGITS + std::char_traits<char>::length(SEGMENT_SUFFIX);
+
+        std::error_code ec;
+        for (fs::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            const std::string name = it->path().filename().string();
+            if (name.size() != nameSize || name.compare(0, stem.size(), stem) != 0 ||
+                name.compare(stem.size() + LSN_DIGITS, std::string::npos, SEGMENT_SUFFIX) != 0) {
+                continue;
+            }
+            std::uint64_t lsn = 0;
+            bool valid = true;
+            for (std::size_t i = 0; i < LSN_DIGITS && valid; ++i) {
+                const char c = name[stem.size() + i];
+                if (c >= '0' && c <= '9') lsn = lsn << 4 | static_cast<std::uint64_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') lsn = lsn << 4 | static_cast<std::uint64_t>(c - 'a' + 10);
+                else valid = false;
+            }
+            if (valid) segments.emplace_back(lsn, it->path().string());
+        }
+        std::sort(segments.begin(), segments.end());
+        return segments;
+    }
+
+    bool syncFile(std::FILE* file) {
+        if (std::fflush(file) != 0) return false;
+#ifdef _WIN32
+        return ::_commit(::_fileno(file)) == 0;
+#else
+        return ::fsync(::fileno(file)) == 0;
+#endif
+    }
+}
+
+void JournalEntry::encode(std::uint8_t* out) const {
+    out[0] = static_cast<std::uint8_t>(session);
+    out[1] = static_cast<std::uint8_t>(session >> 8);
+    out[2] = static_cast<std::uint8_t>(session >> 16);
+    out[3] = static_cast<std::uint8_t>(session >> 24);
+    out[4] = static_cast<std::uint8_t>(op);
+    out[5] = static_cast<std::uint8_t>(a);
+    out[6] = static_cast<std::uint8_t>(b);
+    out[7] = checkByte(out);
+}
+
+bool JournalEntry::decode(const std::uint8_t* in, JournalEntry& entry) {
+    if (in[7] != checkByte(in)) return false;
+    if (in[4] < static_cast<std::uint8_t>(JournalOp::CREATE) || in[4] > static_cast<std::uint8_t>(JournalOp::PASS)) {
+        return false;
+    }
+    entry.session = static_cast<std::uint32_t>(in[0]) | (static_cast<std::uint32_t>(in[1]) << 8) |
+                    (static_cast<std::uint32_t>(in[2]) << 16) | (static_cast<std::uint32_t>(in[3]) << 24);
+    entry.op = static_cast<JournalOp>(in[4]);
+    entry.a = static_cast<std::int8_t>(in[5]);
+    entry.b = static_cast<std::int8_t>(in[6]);
+    return true;
+}
+
+bool JournalEntry::apply(HeadlessGame& game) const {
+    switch (op) {
+    case JournalOp::START:
+        game.start();
+        return true;
+    case JournalOp::OPENING_ROLL:
+        if (a < 1 || a > 6) return false;
+        game.rollOpeningDice(a);
+        return true;
+    case JournalOp::START_AFTER_OPENING:
+        game.startGameAfterOpening();
+        return true;
+    case JournalOp::ROLL:
+        if (a < 1 || a > 6 || b < 1 || b > 6) return false;
+        game.rollDice(a, b);
+        return true;
+    case JournalOp::MOVE:
+        game.makeMove(a, b);
+        return true;
+    case JournalOp::PASS:
+        game.passTurn();
+        return true;
+    default:
+        return false;
+    }
+}
+
+GameJournal::GameJournal()
+    : m_file(nullptr), m_lastLsn(0), m_durableLsn(0), m_rotatedAt(0), m_rotateRequested(false),
+      m_stop(false), m_failed(false), m_open(false) {
+}
+
+GameJournal::~GameJournal() {
+    close();
+}
+
+bool GameJournal::open(const std::string& prefix, std::uint64_t firstLsn) {
+    close();
+    if (firstLsn == 0) firstLsn = 1;
+
+    m_file = std::fopen(segmentPath(prefix, firstLsn).c_str(), "wb");
+    if (!m_file) return false;
+
+    m_prefix = prefix;
+    m_pending.clear();
+    m_lastLsn = firstLsn - 1;
+    m_durableLsn = firstLsn - 1;
+    m_rotatedAt = firstLsn - 1;
+    m_rotateRequested = false;
+    m_stop = false;
+    m_failed = false;
+    m_open = true;
+    m_writer = std::thread([this]() { run(); });
+    return true;
+}
+
+void GameJournal::close() {
+    if (!m_open) return;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_writer.join();
+
+    std::fclose(m_file);
+    m_file = nullptr;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_open = false;
+    m_durable.notify_all();
+}
+
+bool GameJournal::isOpen() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_open;
+}
+
+std::uint64_t GameJournal::append(const JournalEntry& entry) {
+    std::uint8_t bytes[JournalEntry::ENCODED_SIZE];
+    entry.encode(bytes);
+
+    std::uint64_t lsn = 0;
+    bool wasIdle = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Entries after a failed write could never be made durable in order
+        if (!m_open || m_stop || m_failed) return 0;
+        wasIdle = m_pending.empty();
+        m_pending.insert(m_pending.end(), bytes, bytes + sizeof bytes);
+        lsn = ++m_lastLsn;
+    }
+    if (wasIdle) m_wake.notify_one();
+    return lsn;
+}
+
+bool GameJournal::waitDurable(std::uint64_t lsn) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_durable.wait(lock, [&]() { return m_durableLsn >= lsn || m_failed || !m_open; });
+    return m_durableLsn >= lsn;
+}
+
+std::uint64_t GameJournal::durableLsn() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_durableLsn;
+}
+
+std::uint64_t GameJournal::lastLsn() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lastLsn;
+}
+
+std::uint64_t GameJournal::rotate() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_open) return m_lastLsn;
+    m_durable.wait(lock, [&]() { return !m_rotateRequested || !m_open; });
+    m_rotateRequested = true;
+    m_wake.notify_one();
+    m_durable.wait(lock, [&]() { return !m_rotateRequested || !m_open; });
+    return m_rotatedAt;
+}
+
+void GameJournal::run() {
+    std::vector<std::uint8_t> batch;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;) {
+        m_wake.wait(lock, [&]() { return m_stop || m_rotateRequested || !m_pending.empty(); });
+        if (m_stop && !m_rotateRequested && m_pending.empty()) break;
+
+        // Everything appended so far goes into one write and one fsync
+        batch.swap(m_pending);
+        const std::uint64_t upTo = m_lastLsn;
+        const bool rotate = m_rotateRequested;
+        const bool failed = m_failed;
+        lock.unlock();
+
+        // Once a batch is lost, later ones must not make it look durable
+        bool ok = !failed;
+        if (ok && !batch.empty()) {
+            ok = std::fwrite(batch.data(), 1, batch.size(), m_file) == batch.size() && syncFile(m_file);
+        }
+        std::FILE* next = nullptr;
+        if (rotate && ok) {
+            next = std::fopen(segmentPath(m_prefix, upTo + 1).c_str(), "wb");
+            ok = next != nullptr;
+        }
+        batch.clear();
+
+        lock.lock();
+        if (ok) {
+            m_durableLsn = upTo;
+        }
+        else {
+            m_failed = true;
+        }
+        if (rotate) {
+            // On failure the boundary stays at the previous rotation, so no
+            // segment holding entries after it is ever deleted
+            if (next) {
+                std::fclose(m_file);
+                m_file = next;
+                m_rotatedAt = upTo;
+            }
+            m_rotateRequested = false;
+        }
+        m_durable.notify_all();
+    }
+}
+
+void GameJournal::readAll(const std::string& prefix, std::uint64_t& firstLsn, std::vector<JournalEntry>& entries) {
+    entries.clear();
+    const auto segments = listSegments(prefix);
+    firstLsn = segments.empty() ? 1 : segments.front().first;
+
+    std::uint64_t expected = firstLsn;
+    for (const auto& segment : segments) {
+        if (segment.first != expected) return;
+
+        std::FILE* file = std::fopen(segment.second.c_str(), "rb");
+        if (!file) return;
+        std::uint8_t bytes[JournalEntry::ENCODED_SIZE];
+        JournalEntry entry;
+        while (std::fread(bytes, 1, sizeof bytes, file) == sizeof bytes && JournalEntry::decode(bytes, entry)) {
+            entries.push_back(entry);
+            ++expected;
+        }
+        std::fclose(file);
+    }
+}
+
+void GameJournal::removeSegmentsBefore(const std::string& prefix, std::uint64_t lsn) {
+    for (const auto& segment : listSegments(prefix)) {
+        if (segment.first >= lsn) break;
+        std::remove(segment.second.c_str());
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * @file GameRecord.cpp
+ * @brief Implementation of the GameRecord binary encoding.
+ */
+
+#include "GameRecord.hpp"
+
+namespace {
+    constexpr std::uint8_t FLAG_CUSTOM_START = 0x01;  ///< Record carries a start position
+    constexpr std::uint8_t FLAG_FINISHED = 0x02;      ///< Game reached FINISHED
+    constexpr std::uint8_t FLAG_WINNER_BLACK = 0x04;  ///< Winner is black (white otherwise)
+
+    void appendVarint(std::uint64_t value, std::vector<std::uint8_t>& out) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    bool readVarint(const std::uint8_t* data, std::size_t size, std::size_t& pos, std::uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= size) return false;
+            const std::uint8_t byte = data[pos++];
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    std::uint8_t colorCode(Color c) {
+        return c == Color::WHITE ? 1 : (c == Color::BLACK ? 2 : 0);
+    }
+
+    Color colorFromCode(std::uint8_t code) {
+        return code == 1 ? Color::WHITE : (code == 2 ? Color::BLACK : Color::NONE);
+    }
+}
+
+std::uint16_t GameEvent::encode() const {
+    const std::uint16_t tag = static_cast<std::uint16_t>(static_cast<std::uint16_t>(type) << 14);
+    switch (type) {
+    case GameEventType::OPENING_ROLL:
+    case GameEventType::ROLL:
+        return tag | static_cast<std::uint16_t>(((a & 0x7) << 3) | (b & 0x7));
+    case GameEventType::MOVE:
+        return tag | static_cast<std::uint16_t>(((a & 0x1F) << 5) | ((b + 1) & 0x1F));
+    case GameEventType::PASS:
+        break;
+    }
+    return tag;
+}
+
+GameEvent GameEvent::decode(std::uint16_t code) {
+    GameEvent e;
+    e.type = static_cast<GameEventType>(code >> 14);
+    switch (e.type) {
+    case GameEventType::OPENING_ROLL:
+    case GameEventType::ROLL:
+        e.a = static_cast<std::int8_t>((code >> 3) & 0x7);
+        e.b = static_cast<std::int8_t>(code & 0x7);
+        break;
+    case GameEventType::MOVE:
+        e.a = static_cast<std::int8_t>((code >> 5) & 0x1F);
+        e.b = static_cast<std::int8_t>((code & 0x1F) - 1);
+        break;
+    case GameEventType::PASS:
+        break;
+    }
+    return e;
+}
+
+bool GameEvent::isValid() const {
+    switch (type) {
+    case GameEventType::OPENING_ROLL:
+    case GameEventType::ROLL:
+        return a >= 1 && a <= 6 && b >= 1 && b <= 6;
+    case GameEventType::MOVE:
+        // Sources 0-23 and the bar (25); destinations 0-23 and both bear-offs (24, -1)
+        return (a <= 23 || a == 25) && b >= -1 && b <= 24;
+    case GameEventType::PASS:
+        return true;
+    }
+    return false;
+}
+
+void GameRecord::encode(std::vector<std::uint8_t>& out) const {
+    std::uint8_t flags = 0;
+    if (!standardStart) flags |= FLAG_CUSTOM_START;
+    if (finished) flags |= FLAG_FINISHED;
+    if (winner == Color::BLACK) flags |= FLAG_WINNER_BLACK;
+
+    out.push_back(flags);
+    appendVarint(gameId, out);
+    appendVarint(events.size(), out);
+
+    if (!standardStart) {
+        for (int i = 0; i < 24; ++i) {
+            const int count = startPosition.pieceCounts[i];
+            out.push_back(static_cast<std::uint8_t>(static_cast<std::int8_t>(
+                startPosition.colors[i] == Color::BLACK ? -count : count)));
+        }
+        out.push_back(static_cast<std::uint8_t>(startPosition.barWhite));
+        out.push_back(static_cast<std::uint8_t>(startPosition.barBlack));
+        out.push_back(static_cast<std::uint8_t>(startPosition.borneOffWhite));
+        out.push_back(static_cast<std::uint8_t>(startPosition.borneOffBlack));
+        out.push_back(colorCode(startPosition.currentPlayer));
+    }
+
+    for (const GameEvent& e : events) {
+        const std::uint16_t code = e.encode();
+        out.push_back(static_cast<std::uint8_t>(code & 0xFF));
+        out.push_back(static_cast<std::uint8_t>(code >> 8));
+    }
+}
+
+bool GameRecord::decodeHeader(const std::uint8_t* data, std::size_t size, std::size_t& eventCount, std::size_t& headerSize) {
+    std::size_t pos = 0;
+    if (size < 1) return false;
+    const std::uint8_t flags = data[pos++];
+
+    std::uint64_t count = 0;
+    if (!readVarint(data, size, pos, gameId) || !readVarint(data, size, pos, count)) return false;
+
+    standardStart = (flags & FLAG_CUSTOM_START) == 0;
+    finished = (flags & FLAG_FINISHED) != 0;
+    winner = finished ? ((flags & FLAG_WINNER_BLACK) ? Color::BLACK : Color::WHITE) : Color::NONE;
+    startPosition = GameStateDTO();
+    events.clear();
+
+    if (!standardStart) {
+        if (size - pos < POSITION_SIZE) return false;
+        for (int i = 0; i < 24; ++i) {
+            const int signedCount = static_cast<std::int8_t>(data[pos++]);
+            startPosition.pieceCounts[i] = signedCount < 0 ? -signedCount : signedCount;
+            startPosition.colors[i] = signedCount > 0 ? Color::WHITE : (signedCount < 0 ? Color::BLACK : Color::NONE);
+        }
+        startPosition.barWhite = data[pos++];
+        startPosition.barBlack = data[pos++];
+        startPosition.borneOffWhite = data[pos++];
+        startPosition.borneOffBlack = data[pos++];
+        startPosition.currentPlayer = colorFromCode(data[pos++]);
+    }
+
+    if (count > (size - pos) / GameEvent::ENCODED_SIZE) return false;
+    eventCount = static_cast<std::size_t>(count);
+    headerSize = pos;
+    return true;
+}
+
+bool GameRecord::decode(const std::uint8_t* data, std::size_t size, std::size_t& consumed) {
+    std::size_t eventCount = 0;
+    std::size_t pos = 0;
+    if (!decodeHeader(data, size, eventCount, pos)) return false;
+
+    events.resize(eventCount);
+    for (GameEvent& e : events) {
+        e = GameEvent::decode(static_cast<std::uint16_t>(data[pos] | (data[pos + 1] << 8)));
+        if (!e.isValid()) return false;
+        pos += GameEvent::ENCODED_SIZE;
+    }
+
+    consumed = pos;
+    return true;
+}
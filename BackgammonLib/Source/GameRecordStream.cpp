@@ -0,0 +1,170 @@
+/**
+ * @file GameRecordStream.cpp
+ * @brief Implementation of the block-compressed game record writer and reader.
+ */
+
+#include "GameRecordStream.hpp"
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+#ifdef BACKGAMMON_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace {
+    constexpr char MAGIC[4] = { 'B', 'G', 'R', '1' };  ///< File header
+
+    constexpr std::uint8_t CODEC_RAW = 0;   ///< Block stored as is
+    constexpr std::uint8_t CODEC_ZLIB = 1;  ///< Block compressed with zlib
+
+    /// Upper bound on block sizes accepted by the reader
+    constexpr std::uint64_t MAX_BLOCK_SIZE = 64u * 1024u * 1024u;
+
+    void writeVarint(std::ostream& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.put(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        out.put(static_cast<char>(value));
+    }
+
+    bool readVarint(std::istream& in, std::uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const int c = in.get();
+            if (c == std::char_traits<char>::eof()) return false;
+            value |= static_cast<std::uint64_t>(c & 0x7F) << shift;
+            if ((c & 0x80) == 0) return true;
+        }
+        return false;
+    }
+}
+
+GameRecordWriter::GameRecordWriter(std::ostream& out, bool compress)
+    : m_out(out), m_compress(compress), m_blockRecords(0), m_totalRecords(0) {
+    m_out.write(MAGIC, sizeof(MAGIC));
+    m_block.reserve(BLOCK_SIZE + 1024);
+}
+
+GameRecordWriter::~GameRecordWriter() {
+    finish();
+}
+
+void GameRecordWriter::append(const GameRecord& record) {
+    record.encode(m_block);
+    ++m_blockRecords;
+    ++m_totalRecords;
+    if (m_block.size() >= BLOCK_SIZE) flushBlock();
+}
+
+bool GameRecordWriter::finish() {
+    flushBlock();
+    m_out.flush();
+    return static_cast<bool>(m_out);
+}
+
+std::uint64_t GameRecordWriter::recordCount() const {
+    return m_totalRecords;
+}
+
+void GameRecordWriter::flushBlock() {
+    if (m_blockRecords == 0) return;
+
+    std::uint8_t codec = CODEC_RAW;
+    const std::uint8_t* stored = m_block.data();
+    std::size_t storedSize = m_block.size();
+
+#ifdef BACKGAMMON_HAVE_ZLIB
+    if (m_compress) {
+        uLongf compressedSize = compressBound(static_cast<uLong>(m_block.size()));
+        m_scratch.resize(compressedSize);
+        if (compress2(m_scratch.data(), &compressedSize, m_block.data(), static_cast<uLong>(m_block.size()), 6) == Z_OK
+            && compressedSize < m_block.size()) {
+            codec = CODEC_ZLIB;
+            stored = m_scratch.data();
+            storedSize = compressedSize;
+        }
+    }
+#endif
+
+    m_out.put(static_cast<char>(codec));
+    writeVarint(m_out, m_blockRecords);
+    writeVarint(m_out, m_block.size());
+    writeVarint(m_out, storedSize);
+    m_out.write(reinterpret_cast<const char*>(stored), static_cast<std::streamsize>(storedSize));
+
+    m_block.clear();
+    m_blockRecords = 0;
+}
+
+GameRecordReader::GameRecordReader(std::istream& in)
+    : m_in(in), m_position(0), m_blockRecords(0), m_failed(false) {
+    char magic[sizeof(MAGIC)] = {};
+    m_in.read(magic, sizeof(magic));
+    if (m_in.gcount() != static_cast<std::streamsize>(sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        m_failed = true;
+    }
+}
+
+bool GameRecordReader::next(GameRecord& record) {
+    if (m_failed) return false;
+    while (m_blockRecords == 0) {
+        if (!loadBlock()) return false;
+    }
+
+    std::size_t consumed = 0;
+    if (!record.decode(m_block.data() + m_position, m_block.size() - m_position, consumed)) {
+        m_failed = true;
+        return false;
+    }
+    m_position += consumed;
+    --m_blockRecords;
+    return true;
+}
+
+bool GameRecordReader::failed() const {
+    return m_failed;
+}
+
+bool GameRecordReader::loadBlock() {
+    const int codec = m_in.get();
+    if (codec == std::char_traits<char>::eof()) return false;
+
+    std::uint64_t records = 0, rawSize = 0, storedSize = 0;
+    if (!readVarint(m_in, records) || !readVarint(m_in, rawSize) || !readVarint(m_in, storedSize)
+        || rawSize > MAX_BLOCK_SIZE || storedSize > MAX_BLOCK_SIZE) {
+        m_failed = true;
+        return false;
+    }
+
+    m_stored.resize(static_cast<std::size_t>(storedSize));
+    m_in.read(reinterpret_cast<char*>(m_stored.data()), static_cast<std::streamsize>(storedSize));
+    if (m_in.gcount() != static_cast<std::streamsize>(storedSize)) {
+        m_failed = true;
+        return false;
+    }
+
+    if (codec == CODEC_RAW && storedSize == rawSize) {
+        m_block.swap(m_stored);
+    }
+#ifdef BACKGAMMON_HAVE_ZLIB
+    else if (codec == CODEC_ZLIB) {
+        m_block.resize(static_cast<std::size_t>(rawSize));
+        uLongf size = static_cast<uLongf>(rawSize);
+        if (uncompress(m_block.data(), &size, m_stored.data(), static_cast<uLong>(storedSize)) != Z_OK || size != rawSize) {
+            m_failed = true;
+            return false;
+        }
+    }
+#endif
+    else {
+        m_failed = true;
+        return false;
+    }
+
+    m_position = 0;
+    m_blockRecords = records;
+    return true;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file GameRecorder.cpp
+ * @brief Implementation of the GameRecorder observer.
+ */
+
+#include "GameRecorder.hpp"
+#include "GameRecordStream.hpp"
+
+GameRecorder::GameRecorder(const IGame& game, GameRecordWriter* writer)
+    : m_game(game), m_writer(writer), m_engineTurnChange(false), m_written(false), m_firstNotification(0) {
+}
+
+void GameRecorder::beginFromPosition(const GameStateDTO& position) {
+    const std::uint64_t id = m_record.gameId;
+    m_record = GameRecord();
+    m_record.gameId = id;
+    m_record.standardStart = false;
+    m_record.startPosition = position;
+    m_engineTurnChange = false;
+    m_written = false;
+    m_firstNotification = m_game.notificationCount();
+    m_eventsAt.assign(1, 0);
+}
+
+void GameRecorder::setGameId(std::uint64_t gameId) {
+    m_record.gameId = gameId;
+}
+
+const GameRecord& GameRecorder::record() const {
+    return m_record;
+}
+
+void GameRecorder::onGameStarted() {
+    // start() after a tied opening roll continues the same game
+    bool tieRestart = m_record.standardStart && !m_record.finished && !m_record.events.empty();
+    for (const GameEvent& e : m_record.events) {
+        if (e.type != GameEventType::OPENING_ROLL) tieRestart = false;
+    }
+
+    if (!tieRestart) {
+        m_record.events.clear();
+        m_firstNotification = m_game.notificationCount();
+        m_eventsAt.clear();
+    }
+    m_record.standardStart = true;
+    m_record.startPosition = GameStateDTO();
+    m_record.finished = false;
+    m_record.winner = Color::NONE;
+    m_engineTurnChange = false;
+    m_written = false;
+    markNotification();
+}
+
+void GameRecorder::onDiceRolled(Color, int d1, int d2) {
+    const GamePhase phase = m_game.getPhase();
+    if (phase == GamePhase::OPENING_ROLL_COMPARE) {
+        m_record.events.push_back(GameEvent{ GameEventType::OPENING_ROLL,
+            static_cast<std::int8_t>(d1), static_cast<std::int8_t>(d2) });
+        // startGameAfterOpening() hands the first turn over; a tie restarts instead
+        m_engineTurnChange = true;
+    }
+    else if (phase == GamePhase::IN_PROGRESS) {
+        m_record.events.push_back(GameEvent{ GameEventType::ROLL,
+            static_cast<std::int8_t>(d1), static_cast<std::int8_t>(d2) });
+    }
+    markNotification();
+}
+
+void GameRecorder::onMoveMade(Color, int fromIndex, int toIndex, MoveResult result) {
+    if (result != MoveResult::SUCCESS) {
+        markNotification();
+        return;
+    }
+    m_record.events.push_back(GameEvent{ GameEventType::MOVE,
+        static_cast<std::int8_t>(fromIndex), static_cast<std::int8_t>(toIndex) });
+
+    // Sent before the engine decides; the same test makeMove uses to end the turn
+    const auto dice = m_game.getDice();
+    m_engineTurnChange = (dice[0] == 0 && dice[1] == 0) || !m_game.hasMovesAvailable();
+    markNotification();
+}
+
+void GameRecorder::onPlayMade(Color, const Play& play) {
+    // A play is recorded as its single moves, which replay to the same turn
+    for (int i = 0; i < play.count; ++i) {
+        m_record.events.push_back(GameEvent{ GameEventType::MOVE, play.moves[i].fromIndex, play.moves[i].toIndex });
+    }
+    // A successful play always ends the turn
+    m_engineTurnChange = true;
+    markNotification();
+}
+
+void GameRecorder::onTurnChanged(Color) {
+    const bool byEngine = m_engineTurnChange;
+    m_engineTurnChange = false;
+    if (!byEngine && m_game.getPhase() == GamePhase::IN_PROGRESS) {
+        m_record.events.push_back(GameEvent{ GameEventType::PASS, 0, 0 });
+    }
+    markNotification();
+}
+
+void GameRecorder::onStateRestored() {
+    // The restored game has taken back every notification after its count
+    m_engineTurnChange = false;
+    const std::uint64_t count = m_game.notificationCount();
+    if (count < m_firstNotification || count - m_firstNotification >= m_eventsAt.size()) return;
+    const std::size_t index = static_cast<std::size_t>(count - m_firstNotification);
+    m_record.events.resize(m_eventsAt[index]);
+    m_eventsAt.resize(index + 1);
+    if (m_game.getPhase() != GamePhase::FINISHED) {
+        m_record.finished = false;
+        m_record.winner = Color::NONE;
+    }
+}
+
+void GameRecorder::onGameFinished(Color winner) {
+    m_record.finished = true;
+    m_record.winner = winner;
+    markNotification();
+    if (m_writer && !m_written) {
+        m_writer->append(m_record);
+        m_written = true;
+    }
+}
+
+void GameRecorder::markNotification() {
+    const std::uint64_t count = m_game.notificationCount();
+    if (count < m_firstNotification) return;
+    const std::size_t index = static_cast<std::size_t>(count - m_firstNotification);
+    if (index >= m_eventsAt.size()) m_eventsAt.resize(index + 1, m_record.events.size());
+    m_eventsAt[index] = m_record.events.size();
+}
@@ -0,0 +1,156 @@
+/**
+ * @file HeuristicEvaluator.cpp
+ * @brief Implementation of the HeuristicEvaluator class.
+ */
+
+#include "HeuristicEvaluator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include "MoveGenerator.hpp"
+
+namespace {
+    constexpr int CHECKERS = 15;
+
+    constexpr float PIP_WEIGHT = 0.012f;
+    constexpr float BLOT_WEIGHT = 0.10f;
+    constexpr float HOME_POINT_WEIGHT = 0.06f;
+    constexpr float BAR_POINT_WEIGHT = 0.04f;
+    constexpr float PRIME_WEIGHT = 0.04f;
+    constexpr float ANCHOR_WEIGHT = 0.03f;
+    constexpr float ON_BAR_WEIGHT = 0.15f;
+    constexpr float BORNE_OFF_WEIGHT = 0.02f;
+
+    /**
+     * @struct Side
+     * @brief Checker counts of one player by own point (1-24 from that player's view, 25 = bar).
+     */
+    struct Side {
+        int points[26] = {};  ///< Checkers per own point
+        int borneOff = 0;     ///< Checkers borne off
+    };
+
+    Side sideOf(const IGame& game, Color player) {
+        Side side;
+        for (int i = 0; i < 24; ++i) {
+            if (game.getColumnCount(i) == 0 || game.getColumnColor(i) != player) continue;
+            side.points[player == Color::WHITE ? 24 - i : i + 1] = game.getColumnCount(i);
+        }
+        side.points[25] = game.getBarCount(player);
+        side.borneOff = game.getBorneOffCount(player);
+        return side;
+    }
+
+    int pips(const Side& side) {
+        int total = 0;
+        for (int p = 1; p <= 25; ++p) total += p * side.points[p];
+        return total;
+    }
+
+    /**
+     * @brief Counts blots of a side that an opposing checker could hit with one die or a combination (up to 11 pips).
+     *
+     * Own point p faces the opponent's own point 25 - p; the opponent's bar
+     * counts as its 25-point.
+     */
+    int exposedBlots(const Side& side, const Side& opponent) {
+        int count = 0;
+        for (int p = 1; p <= 24; ++p) {
+            if (side.points[p] != 1) continue;
+            const int target = 25 - p; // the blot's point in the opponent's numbering
+            for (int q = target + 1; q <= std::min(25, target + 11); ++q) {
+                if (opponent.points[q] > 0) {
+                    ++count;
+                    break;
+                }
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Scores the structure of one side (everything except the race).
+     */
+    float structure(const Side& side, const Side& opponent) {
+        float s = -BLOT_WEIGHT * static_cast<float>(exposedBlots(side, opponent));
+
+        int run = 0;
+        int longestPrime = 0;
+        for (int p = 1; p <= 24; ++p) {
+            const bool made = side.points[p] >= 2;
+            if (made && p <= 6) s += HOME_POINT_WEIGHT;
+            if (made && p == 7) s += BAR_POINT_WEIGHT;
+            if (made && p >= 19) s += ANCHOR_WEIGHT;
+            run = made ? run + 1 : 0;
+            longestPrime = std::max(longestPrime, run);
+        }
+        if (longestPrime > 2) s += PRIME_WEIGHT * static_cast<float>(longestPrime - 2);
+
+        s -= ON_BAR_WEIGHT * static_cast<float>(side.points[25]);
+        s += BORNE_OFF_WEIGHT * static_cast<float>(side.borneOff);
+        return s;
+    }
+}
+
+float HeuristicEvaluator::evaluate(const IGame& game, Color player) {
+    const Color opponent = player == Color::WHITE ? Color::BLACK : Color::WHITE;
+    const Side own = sideOf(game, player);
+    const Side opp = sideOf(game, opponent);
+    if (own.borneOff == CHECKERS) return 1.0f;
+    if (opp.borneOff == CHECKERS) return -1.0f;
+
+    const float race = PIP_WEIGHT * static_cast<float>(pips(opp) - pips(own));
+    return std::tanh(race + structure(own, opp) - structure(opp, own));
+}
+
+bool HeuristicEvaluator::bestPlay(const HeadlessGame& game, Play& play, float& equity) {
+    const std::array<int, 2> dice = game.getDice();
+    if (game.getPhase() != GamePhase::IN_PROGRESS || (dice[0] == 0 && dice[1] == 0)) return false;
+
+    // Ties are broken by the key of the resulting position, which does not
+    // depend on color, so mirrored positions get mirrored plays
+    const Color mover = game.getCurrentPlayer();
+    bool found = false;
+    PositionKey bestKey{};
+    for (const GeneratedPlay& candidate : MoveGenerator::generatePlays(game)) {
+        const float value = evaluate(candidate.after, mover);
+        const PositionKey key = candidate.after.positionKey();
+        if (!found || value > equity || (value == equity && key < bestKey)) {
+            play = candidate.play;
+            equity = value;
+            bestKey = key;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool HeuristicEvaluator::rankPlays(const HeadlessGame& game, std::size_t maxPlays, std::vector<RankedPlay>& ranked,
+                                   const std::atomic<bool>* cancel) {
+    ranked.clear();
+    const std::array<int, 2> dice = game.getDice();
+    if (game.getPhase() != GamePhase::IN_PROGRESS || (dice[0] == 0 && dice[1] == 0)) return false;
+
+    struct Candidate {
+        RankedPlay ranked;
+        PositionKey key;
+    };
+    const Color mover = game.getCurrentPlayer();
+    std::vector<Candidate> candidates;
+    for (const GeneratedPlay& generated : MoveGenerator::generatePlays(game)) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) return false;
+        candidates.push_back(Candidate{ RankedPlay{ generated.play, evaluate(generated.after, mover) },
+                                        generated.after.positionKey() });
+    }
+
+    // Same order as bestPlay(): higher equity first, ties by position key
+    const std::size_t kept = std::min(maxPlays, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + kept, candidates.end(),
+                      [](const Candidate& a, const Candidate& b) {
+                          if (a.ranked.equity != b.ranked.equity) return a.ranked.equity > b.ranked.equity;
+                          return a.key < b.key;
+                      });
+    ranked.reserve(kept);
+    for (std::size_t i = 0; i < kept; ++i) ranked.push_back(candidates[i].ranked);
+    return true;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file Instrumentation.cpp
+ * @brief Implementation of the per-operation metrics registry and its exporters.
+ */
+
+#include "Instrumentation.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <ostream>
+
+namespace {
+    constexpr std::size_t OP_COUNT = static_cast<std::size_t>(InstrumentedOp::COUNT);
+
+    /**
+     * @struct OpCounters
+     * @brief Live counters of one operation, on their own cache lines.
+     */
+    struct alignas(64) OpCounters {
+        std::atomic<std::uint64_t> calls{ 0 };                                 ///< Completed calls
+        std::atomic<std::uint64_t> totalNanoseconds{ 0 };                      ///< Summed durations
+        std::array<std::atomic<std::uint64_t>, OpMetrics::BUCKET_COUNT> buckets{}; ///< Log2 histogram
+    };
+
+    std::array<OpCounters, OP_COUNT> g_counters;  ///< Counters indexed by InstrumentedOp
+
+    const char* const OP_NAMES[OP_COUNT] = {
+        "make_move", "get_legal_targets", "has_moves_available", "get_state", "roll_dice",
+        "notify_game_started", "notify_dice_rolled", "notify_move_made", "notify_turn_changed", "notify_game_finished",
+        "make_play", "notify_play_made", "notify_state_restored"
+    };
+
+    /**
+     * @brief Maps a duration to its log2 bucket, the smallest i with nanoseconds <= 2^i.
+     */
+    std::size_t bucketFor(std::uint64_t nanoseconds) {
+        if (nanoseconds <= 1) return 0;
+        std::uint64_t rest = nanoseconds - 1;
+        std::size_t bucket = 0;
+        while (rest > 0 && bucket + 1 < OpMetrics::BUCKET_COUNT) {
+            rest >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    void writeJson(std::ostream& out) {
+        out << "{\"enabled\":" << (Instrumentation::ENABLED ? "true" : "false") << ",\"operations\":[";
+        for (std::size_t i = 0; i < OP_COUNT; ++i) {
+            const InstrumentedOp op = static_cast<InstrumentedOp>(i);
+            const OpMetrics m = Instrumentation::snapshot(op);
+            out << (i ? "," : "") << "{\"op\":\"" << Instrumentation::name(op) << "\",\"calls\":" << m.calls
+                << ",\"total_ns\":" << m.totalNanoseconds << ",\"histogram_log2_ns\":[";
+            for (std::size_t b = 0; b < OpMetrics::BUCKET_COUNT; ++b) {
+                out << (b ? "," : "") << m.buckets[b];
+            }
+            out << "]}";
+        }
+        out << "]}\n";
+    }
+
+    void writePrometheus(std::ostream& out) {
+        out << "# HELP backgammon_op_duration_seconds Latency of game engine entry points and observer dispatch.\n"
+            << "# TYPE backgammon_op_duration_seconds histogram\n";
+        for (std::size_t i = 0; i < OP_COUNT; ++i) {
+            const InstrumentedOp op = static_cast<InstrumentedOp>(i);
+            const OpMetrics m = Instrumentation::snapshot(op);
+            const char* opName = Instrumentation::name(op);
+
+            // Bucket b holds durations up to 2^b ns; the last one is unbounded and only counts towards +Inf
+            std::uint64_t cumulative = 0;
+            for (std::size_t b = 0; b + 1 < OpMetrics::BUCKET_COUNT; ++b) {
+                cumulative += m.buckets[b];
+                const double upperSeconds = static_cast<double>(std::uint64_t{ 1 } << b) * 1e-9;
+                out << "backgammon_op_duration_seconds_bucket{op=\"" << opName << "\",le=\"" << upperSeconds << "\"} "
+                    << cumulative << "\n";
+            }
+            out << "backgammon_op_duration_seconds_bucket{op=\"" << opName << "\",le=\"+Inf\"} " << m.calls << "\n"
+                << "backgammon_op_duration_seconds_sum{op=\"" << opName << "\"} " << m.totalNanoseconds * 1e-9 << "\n"
+                << "backgammon_op_duration_seconds_count{op=\"" << opName << "\"} " << m.calls << "\n";
+        }
+    }
+}
+
+void Instrumentation::record(InstrumentedOp op, std::uint64_t nanoseconds) {
+    OpCounters& c = g_counters[static_cast<std::size_t>(op)];
+    c.calls.fetch_add(1, std::memory_order_relaxed);
+    c.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    c.buckets[bucketFor(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+OpMetrics Instrumentation::snapshot(InstrumentedOp op) {
+    const OpCounters& c = g_counters[static_cast<std::size_t>(op)];
+    OpMetrics m;
+    m.calls = c.calls.load(std::memory_order_relaxed);
+    m.totalNanoseconds = c.totalNanoseconds.load(std::memory_order_relaxed);
+    for (std::size_t b = 0; b < OpMetrics::BUCKET_COUNT; ++b) {
+        m.buckets[b] = c.buckets[b].load(std::memory_order_relaxed);
+    }
+    return m;
+}
+
+void Instrumentation::reset() {
+    for (OpCounters& c : g_counters) {
+        c.calls.store(0, std::memory_order_relaxed);
+        c.totalNanoseconds.store(0, std::memory_order_relaxed);
+        for (auto& b : c.buckets) b.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char* Instrumentation::name(InstrumentedOp op) {
+    const std::size_t i = static_cast<std::size_t>(op);
+    return i < OP_COUNT ? OP_NAMES[i] : "unknown";
+}
+
+void Instrumentation::write(std::ostream& out, Format format) {
+    if (format == Format::JSON) writeJson(out);
+    else writePrometheus(out);
+}
+
+bool Instrumentation::writeFile(const std::string& path, Format format) {
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::trunc);
+        if (!out) return false;
+        write(out, format);
+        if (!out.flush()) return false;
+    }
+#ifdef _WIN32
+    std::remove(path.c_str());  // rename does not replace existing files on Windows
+#endif
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
@@ -0,0 +1,319 @@
+/**
+ * @file MatchImporter.cpp
+ * @brief Implementation of the .mat transcript parser and validator.
+ */
+
+#include "MatchImporter.hpp"
+
+#include <cctype>
+
+namespace {
+    constexpr int POINT_BAR = 25;  ///< Transcript point number of the bar
+    constexpr int POINT_OFF = 0;   ///< Transcript point number for bearing off
+
+    /// Tokens starting this close to the right column start belong to the right player
+    constexpr std::size_t COLUMN_SLACK = 4;
+
+    /**
+     * @struct Token
+     * @brief One whitespace-separated word of a line and its column.
+     */
+    struct Token {
+        std::string_view text;  ///< Token characters
+        std::size_t column;     ///< Offset from the start of the line
+    };
+
+    /**
+     * @struct Turn
+     * @brief Roll and checker moves of one player from one transcript line.
+     */
+    struct Turn {
+        bool rolled = false;                  ///< True if the entry holds a roll
+        int d1 = 0;                           ///< First die
+        int d2 = 0;                           ///< Second die
+        std::vector<std::string_view> moves;  ///< Move tokens such as "24/18*/14" or "6/5(2)"
+    };
+
+    std::string_view trimLeft(std::string_view s) {
+        std::size_t i = 0;
+        while (i < s.size() && (s[i] == ' ' || s[i] == '\t')) ++i;
+        return s.substr(i);
+    }
+
+    bool startsWith(std::string_view s, std::string_view prefix) {
+        return s.substr(0, prefix.size()) == prefix;
+    }
+
+    /**
+     * @brief Returns the next line and advances pos past its line break.
+     */
+    std::string_view nextLine(std::string_view text, std::size_t& pos) {
+        const std::size_t end = text.find('\n', pos);
+        std::string_view line = text.substr(pos, end == std::string_view::npos ? std::string_view::npos : end - pos);
+        pos = end == std::string_view::npos ? text.size() : end + 1;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        return line;
+    }
+
+    std::vector<Token> tokenize(std::string_view line, std::size_t from) {
+        std::vector<Token> tokens;
+        std::size_t i = from;
+        while (i < line.size()) {
+            while (i < line.size() && std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+            const std::size_t start = i;
+            while (i < line.size() && !std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+            if (i > start) tokens.push_back(Token{ line.substr(start, i - start), start });
+        }
+        return tokens;
+    }
+
+    bool isRoll(std::string_view t) {
+        return t.size() == 3 && t[0] >= '1' && t[0] <= '6' && t[1] >= '1' && t[1] <= '6' && t[2] == ':';
+    }
+
+    /**
+     * @brief Parses "bar", "off" or a point number.
+     */
+    bool parsePoint(std::string_view s, int& point) {
+        if (s == "bar" || s == "Bar") { point = POINT_BAR; return true; }
+        if (s == "off" || s == "Off") { point = POINT_OFF; return true; }
+        if (s.empty() || s.size() > 2) return false;
+        point = 0;
+        for (char c : s) {
+            if (c < '0' || c > '9') return false;
+            point = point * 10 + (c - '0');
+        }
+        return point <= POINT_BAR;
+    }
+
+    /**
+     * @brief Parses a move token into its points and repetition count.
+     */
+    bool parseMove(std::string_view token, std::vector<int>& points, int& repeat) {
+        points.clear();
+        repeat = 1;
+        const std::size_t paren = token.find('(');
+        if (paren != std::string_view::npos) {
+            if (token.size() < paren + 3 || token.back() != ')') return false;
+            repeat = token[paren + 1] - '0';
+            if (repeat < 1 || repeat > 4) return false;
+            token = token.substr(0, paren);
+        }
+
+        std::size_t start = 0;
+        while (start <= token.size()) {
+            std::size_t slash = token.find('/', start);
+            if (slash == std::string_view::npos) slash = token.size();
+            std::string_view part = token.substr(start, slash - start);
+            while (!part.empty() && part.back() == '*') part.remove_suffix(1);
+            int point = 0;
+            if (!parsePoint(part, point)) return false;
+            points.push_back(point);
+            start = slash + 1;
+        }
+        return points.size() >= 2;
+    }
+
+    /**
+     * @brief Maps a transcript point of a player to an engine index.
+     */
+    int toIndex(int point, Color player) {
+        if (point == POINT_BAR) return HeadlessGame::BAR_INDEX;
+        if (player == Color::WHITE) return point == POINT_OFF ? 24 : 24 - point;
+        return point == POINT_OFF ? -1 : point - 1;
+    }
+
+    /**
+     * @brief Finds engine moves carrying one checker from point a to point b.
+     *
+     * A hop longer than one die (e.g. "24/14" with 6-4) is split through
+     * every intermediate point reachable with a remaining die.
+     */
+    bool findPath(const HeadlessGame& game, Color player, int a, int b, std::vector<GameEvent>& path) {
+        HeadlessGame direct = game;
+        if (direct.makeMove(toIndex(a, player), toIndex(b, player)) == MoveResult::SUCCESS) {
+            path.push_back(GameEvent{ GameEventType::MOVE, static_cast<std::int8_t>(toIndex(a, player)),
+                                      static_cast<std::int8_t>(toIndex(b, player)) });
+            return true;
+        }
+
+        const auto dice = game.getDice();
+        for (int i = 0; i < 2; ++i) {
+            const int d = dice[i];
+            if (d == 0 || (i == 1 && d == dice[0])) continue;
+            const int mid = a - d;
+            if (mid <= b || mid < 1) continue;
+
+            HeadlessGame step = game;
+            if (step.makeMove(toIndex(a, player), toIndex(mid, player)) != MoveResult::SUCCESS) continue;
+            if (step.getPhase() != GamePhase::IN_PROGRESS || step.getCurrentPlayer() != player) continue;
+
+            std::vector<GameEvent> rest;
+            if (findPath(step, player, mid, b, rest)) {
+                path.push_back(GameEvent{ GameEventType::MOVE, static_cast<std::int8_t>(toIndex(a, player)),
+                                          static_cast<std::int8_t>(toIndex(mid, player)) });
+                path.insert(path.end(), rest.begin(), rest.end());
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Replays one player's turn and appends its events.
+     */
+    bool playTurn(HeadlessGame& game, GameRecord& record, Color player, const Turn& turn, int lineNumber, std::string& error) {
+        const std::string where = "move " + std::to_string(lineNumber) + (player == Color::WHITE ? " (left)" : " (right)");
+
+        if (game.getPhase() == GamePhase::NOT_STARTED || game.getPhase() == GamePhase::OPENING_ROLL_WHITE) {
+            // The transcript's first roll is the opening roll; the engine rolls again after it
+            const int high = turn.d1 == turn.d2 ? 2 : (turn.d1 > turn.d2 ? turn.d1 : turn.d2);
+            const int low = turn.d1 == turn.d2 ? 1 : (turn.d1 > turn.d2 ? turn.d2 : turn.d1);
+            const GameEvent opening{ GameEventType::OPENING_ROLL,
+                static_cast<std::int8_t>(player == Color::WHITE ? high : low),
+                static_cast<std::int8_t>(player == Color::WHITE ? low : high) };
+            GameRecord::applyEvent(game, opening);
+            record.events.push_back(opening);
+        }
+
+        const GameEvent roll{ GameEventType::ROLL, static_cast<std::int8_t>(turn.d1), static_cast<std::int8_t>(turn.d2) };
+        if (!GameRecord::applyEvent(game, roll) || game.getCurrentPlayer() != player) {
+            error = where + ": roll out of turn";
+            return false;
+        }
+        record.events.push_back(roll);
+
+        std::vector<int> points;
+        for (std::string_view token : turn.moves) {
+            int repeat = 1;
+            if (!parseMove(token, points, repeat)) {
+                error = where + ": cannot parse '" + std::string(token) + "'";
+                return false;
+            }
+            for (int r = 0; r < repeat; ++r) {
+                for (std::size_t h = 0; h + 1 < points.size(); ++h) {
+                    if (game.getPhase() != GamePhase::IN_PROGRESS || game.getCurrentPlayer() != player) {
+                        error = where + ": more checker moves than the engine allows (doubles play twice here)";
+                        return false;
+                    }
+                    std::vector<GameEvent> path;
+                    if (!findPath(game, player, points[h], points[h + 1], path)) {
+                        error = where + ": illegal move '" + std::string(token) + "'";
+                        return false;
+                    }
+                    for (const GameEvent& e : path) {
+                        game.makeMove(e.a, e.b);
+                        record.events.push_back(e);
+                    }
+                }
+            }
+        }
+
+        if (game.getPhase() == GamePhase::IN_PROGRESS && game.getCurrentPlayer() == player) {
+            if (game.hasMovesAvailable()) {
+                error = where + ": engine still has legal moves after the listed play";
+                return false;
+            }
+            game.passTurn();
+            record.events.push_back(GameEvent{ GameEventType::PASS, 0, 0 });
+        }
+        return true;
+    }
+}
+
+std::vector<std::string_view> MatchImporter::splitGames(std::string_view text) {
+    std::vector<std::string_view> games;
+    std::size_t pos = 0;
+    std::size_t gameStart = std::string_view::npos;
+
+    while (pos < text.size()) {
+        const std::size_t lineStart = pos;
+        const std::string_view line = trimLeft(nextLine(text, pos));
+        if (startsWith(line, "Game ")) {
+            if (gameStart != std::string_view::npos) games.push_back(text.substr(gameStart, lineStart - gameStart));
+            gameStart = lineStart;
+        }
+    }
+    if (gameStart != std::string_view::npos) games.push_back(text.substr(gameStart));
+    return games;
+}
+
+bool MatchImporter::importGame(std::string_view gameText, GameRecord& record, std::string& error) {
+    record = GameRecord();
+    HeadlessGame game;
+
+    std::size_t pos = 0;
+    std::size_t rightColumn = std::string_view::npos;
+    Color nextByAlternation = Color::NONE;
+
+    while (pos < gameText.size()) {
+        const std::string_view line = nextLine(gameText, pos);
+        const std::string_view trimmed = trimLeft(line);
+        if (trimmed.empty() || startsWith(trimmed, "Game ")) continue;
+
+        // Score line "Alice : 0      Bob : 0" gives the start of the right column
+        if (rightColumn == std::string_view::npos && game.getPhase() == GamePhase::NOT_STARTED
+            && trimmed.find(" : ") != std::string_view::npos && trimmed.find(')') == std::string_view::npos) {
+            const std::vector<Token> tokens = tokenize(line, 0);
+            for (std::size_t i = 0; i + 2 < tokens.size(); ++i) {
+                if (tokens[i + 1].text == ":" && i + 3 < tokens.size()) {
+                    rightColumn = tokens[i + 3].column;
+                    break;
+                }
+            }
+            continue;
+        }
+
+        // Move lines look like " 12) 31: 8/5 6/5          52: 13/11 24/19"
+        const std::size_t paren = line.find(')');
+        if (paren == std::string_view::npos || !std::isdigit(static_cast<unsigned char>(trimmed[0]))) continue;
+        int lineNumber = 0;
+        for (char c : line.substr(0, paren)) {
+            if (c >= '0' && c <= '9') lineNumber = lineNumber * 10 + (c - '0');
+        }
+
+        Turn turns[2];
+        Turn* current = nullptr;
+        for (const Token& token : tokenize(line, paren + 1)) {
+            if (isRoll(token.text)) {
+                int side = 0;
+                if (rightColumn != std::string_view::npos) {
+                    side = token.column + COLUMN_SLACK >= rightColumn ? 1 : 0;
+                }
+                else {
+                    side = (nextByAlternation == Color::BLACK) ? 1 : 0;
+                    nextByAlternation = side == 0 ? Color::BLACK : Color::WHITE;
+                }
+                current = &turns[side];
+                current->rolled = true;
+                current->d1 = token.text[0] - '0';
+                current->d2 = token.text[1] - '0';
+            }
+            else if (current && token.text.find('/') != std::string_view::npos) {
+                current->moves.push_back(token.text);
+            }
+            else {
+                current = nullptr;  // cube action or comment
+            }
+        }
+
+        for (int side = 0; side < 2; ++side) {
+            if (!turns[side].rolled) continue;
+            if (game.getPhase() == GamePhase::FINISHED) {
+                error = "move " + std::to_string(lineNumber) + ": play after the game was won";
+                return false;
+            }
+            if (!playTurn(game, record, side == 0 ? Color::WHITE : Color::BLACK, turns[side], lineNumber, error)) return false;
+        }
+    }
+
+    if (record.events.empty()) {
+        error = "no moves";
+        return false;
+    }
+    record.finished = game.getPhase() == GamePhase::FINISHED;
+    if (record.finished) {
+        record.winner = game.getBorneOffCount(Color::WHITE) == 15 ? Color::WHITE : Color::BLACK;
+    }
+    return true;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file MoveGenerator.cpp
+ * @brief Implementation of the MoveGenerator class.
+ */
+
+#include "MoveGenerator.hpp"
+
+namespace {
+    void addUnique(std::vector<GeneratedPlay>& plays, const Play& play, const HeadlessGame& after) {
+        for (const GeneratedPlay& existing : plays) {
+            if (MoveGenerator::samePosition(existing.after, after)) return;
+        }
+        plays.push_back(GeneratedPlay{ play, after });
+    }
+
+    void expand(const HeadlessGame& game, Color mover, Play& current, std::vector<GeneratedPlay>& plays) {
+        bool moved = false;
+
+        for (int from = 0; from <= Game::BAR_INDEX; ++from) {
+            if (!game.canSelectPoint(from)) continue;
+
+            for (int to : game.getLegalTargets(from)) {
+                HeadlessGame next = game;
+                if (next.makeMove(from, to) != MoveResult::SUCCESS) continue;
+                moved = true;
+
+                current.push(from, to);
+                const bool turnOver = next.getPhase() != GamePhase::IN_PROGRESS ||
+                                      next.getCurrentPlayer() != mover ||
+                                      current.count == Play::MAX_MOVES;
+                if (turnOver) addUnique(plays, current, next);
+                else expand(next, mover, current, plays);
+                current.pop();
+            }
+        }
+
+        if (!moved) {
+            HeadlessGame next = game;
+            next.passTurn();
+            addUnique(plays, current, next);
+        }
+    }
+}
+
+std::vector<GeneratedPlay> MoveGenerator::generatePlays(const HeadlessGame& game) {
+    std::vector<GeneratedPlay> plays;
+    Play current;
+    expand(game, game.getCurrentPlayer(), current, plays);
+    return plays;
+}
+
+bool MoveGenerator::samePosition(const HeadlessGame& a, const HeadlessGame& b) {
+    for (int i = 0; i < 24; ++i) {
+        if (a.getColumnCount(i) != b.getColumnCount(i)) return false;
+        if (a.getColumnCount(i) > 0 && a.getColumnColor(i) != b.getColumnColor(i)) return false;
+    }
+    return a.getBarCount(Color::WHITE) == b.getBarCount(Color::WHITE) &&
+           a.getBarCount(Color::BLACK) == b.getBarCount(Color::BLACK) &&
+           a.getBorneOffCount(Color::WHITE) == b.getBorneOffCount(Color::WHITE) &&
+           a.getBorneOffCount(Color::BLACK) == b.getBorneOffCount(Color::BLACK);
+}
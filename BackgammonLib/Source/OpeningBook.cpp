@@ -0,0 +1,167 @@
+/**
+ * @file OpeningBook.cpp
+ * @brief Implementation of the OpeningBook class.
+ */
+
+#include "OpeningBook.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    constexpr char MAGIC[4] = { 'B', 'G', 'O', 'B' };
+    constexpr std::uint32_t FORMAT_VERSION = 1;
+    constexpr std::size_t HEADER_SIZE = 16;
+    constexpr std::size_t MATCH_SIZE = 11;   ///< Key bytes plus the dice byte
+    constexpr int BAR_POINT = 25;
+
+    using EntryBytes = std::array<std::uint8_t, OpeningBook::ENTRY_SIZE>;
+
+    std::uint8_t diceByte(int die1, int die2) {
+        const int high = std::max(die1, die2);
+        const int low = std::min(die1, die2);
+        return static_cast<std::uint8_t>(high << 4 | low);
+    }
+
+    /**
+     * @brief Converts a column index (or bar / bear-off value) to the own-point numbering of a player.
+     */
+    int toOwnPoint(int index, Color player) {
+        if (index == BAR_POINT) return BAR_POINT;
+        return player == Color::WHITE ? 24 - index : index + 1;
+    }
+
+    int fromOwnPoint(int point, Color player) {
+        if (point == BAR_POINT) return BAR_POINT;
+        return player == Color::WHITE ? 24 - point : point - 1;
+    }
+
+    void putU32(std::uint8_t* out, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+
+    std::uint32_t getU32(const std::uint8_t* in) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<std::uint32_t>(in[i]) << (8 * i);
+        return value;
+    }
+}
+
+bool OpeningBook::write(const std::string& path, const std::vector<OpeningBookEntry>& entries) {
+    std::vector<EntryBytes> table;
+    table.reserve(entries.size());
+    for (const OpeningBookEntry& entry : entries) {
+        EntryBytes bytes{};
+        std::memcpy(bytes.data(), entry.key.data(), entry.key.size());
+        bytes[10] = diceByte(entry.die1, entry.die2);
+        const int count = std::min<int>(entry.play.count, Play::MAX_MOVES);
+        bytes[11] = static_cast<std::uint8_t>(count);
+        for (int i = 0; i < count; ++i) {
+            bytes[12 + 2 * i] = static_cast<std::uint8_t>(toOwnPoint(entry.play.moves[i].fromIndex, entry.onRoll));
+            bytes[13 + 2 * i] = static_cast<std::uint8_t>(toOwnPoint(entry.play.moves[i].toIndex, entry.onRoll));
+        }
+        std::uint32_t equityBits;
+        std::memcpy(&equityBits, &entry.equity, sizeof equityBits);
+        putU32(bytes.data() + 20, equityBits);
+        table.push_back(bytes);
+    }
+
+    const auto byMatch = [](const EntryBytes& a, const EntryBytes& b) {
+        return std::memcmp(a.data(), b.data(), MATCH_SIZE) < 0;
+    };
+    std::stable_sort(table.begin(), table.end(), byMatch);
+    table.erase(std::unique(table.begin(), table.end(),
+                            [](const EntryBytes& a, const EntryBytes& b) {
+                                return std::memcmp(a.data(), b.data(), MATCH_SIZE) == 0;
+                            }),
+                table.end());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    std::uint8_t header[HEADER_SIZE];
+    std::memcpy(header, MAGIC, sizeof MAGIC);
+    putU32(header + 4, FORMAT_VERSION);
+    putU32(header + 8, static_cast<std::uint32_t>(table.size()));
+    putU32(header + 12, static_cast<std::uint32_t>(ENTRY_SIZE));
+    out.write(reinterpret_cast<const char*>(header), sizeof header);
+    for (const EntryBytes& bytes : table) {
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    out.flush();
+    return static_cast<bool>(out);
+}
+
+OpeningBook::OpeningBook() : m_count(0) {
+}
+
+bool OpeningBook::open(const std::string& path) {
+    close();
+    if (!m_file.open(path)) return false;
+
+    const std::uint8_t* data = m_file.data();
+    const std::size_t size = m_file.size();
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof MAGIC) != 0 ||
+        getU32(data + 4) != FORMAT_VERSION || getU32(data + 12) != ENTRY_SIZE) {
+        close();
+        return false;
+    }
+    const std::size_t count = getU32(data + 8);
+    if (HEADER_SIZE + count * ENTRY_SIZE > size) {
+        close();
+        return false;
+    }
+    m_count = count;
+    return true;
+}
+
+void OpeningBook::close() {
+    m_file.close();
+    m_count = 0;
+}
+
+bool OpeningBook::isOpen() const {
+    return m_file.isOpen();
+}
+
+std::size_t OpeningBook::size() const {
+    return m_count;
+}
+
+bool OpeningBook::lookup(const PositionKey& key, Color onRoll, int die1, int die2, Play& play, float& equity) const {
+    if (m_count == 0) return false;
+
+    std::uint8_t match[MATCH_SIZE];
+    std::memcpy(match, key.data(), key.size());
+    match[10] = diceByte(die1, die2);
+
+    const std::uint8_t* entries = m_file.data() + HEADER_SIZE;
+    std::size_t low = 0;
+    std::size_t high = m_count;
+    while (low < high) {
+        const std::size_t mid = low + (high - low) / 2;
+        if (std::memcmp(entries + mid * ENTRY_SIZE, match, MATCH_SIZE) < 0) low = mid + 1;
+        else high = mid;
+    }
+    if (low == m_count) return false;
+
+    const std::uint8_t* entry = entries + low * ENTRY_SIZE;
+    if (std::memcmp(entry, match, MATCH_SIZE) != 0) return false;
+
+    play = Play{};
+    const int count = std::min<int>(entry[11], Play::MAX_MOVES);
+    for (int i = 0; i < count; ++i) {
+        play.push(fromOwnPoint(entry[12 + 2 * i], onRoll), fromOwnPoint(entry[13 + 2 * i], onRoll));
+    }
+    const std::uint32_t equityBits = getU32(entry + 20);
+    std::memcpy(&equity, &equityBits, sizeof equity);
+    return true;
+}
+
+bool OpeningBook::lookup(const IGame& game, Play& play, float& equity) const {
+    const std::array<int, 2> dice = game.getDice();
+    if (game.getPhase() != GamePhase::IN_PROGRESS || dice[0] == 0 || dice[1] == 0) return false;
+    return lookup(PositionId::encode(game.getState()), game.getCurrentPlayer(), dice[0], dice[1], play, equity);
+}
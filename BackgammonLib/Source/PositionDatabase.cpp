@@ -0,0 +1,563 @@
+/**
+ * @file PositionDatabase.cpp
+ * @brief Implementation of the analyzed-position database for POSIX and Windows.
+ */
+
+#include "PositionDatabase.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr char DATA_MAGIC[4] = { 'B', 'G', 'P', 'D' };
+    constexpr char INDEX_MAGIC[4] = { 'B', 'G', 'P', 'I' };
+    constexpr std::uint32_t FORMAT_VERSION = 1;
+    constexpr std::uint64_t DATA_HEADER_SIZE = 8;
+    constexpr std::size_t MATCH_SIZE = 11;        ///< Key bytes plus the dice byte
+    constexpr std::uint64_t MAX_LOAD_PERCENT = 70;
+
+    /**
+     * @struct IndexHeader
+     * @brief First bytes of the index file.
+     */
+    struct IndexHeader {
+        char magic[4];                          ///< "BGPI"
+        std::uint32_t version;                  ///< FORMAT_VERSION
+        std::uint64_t capacity;                 ///< Slot count (power of two)
+        std::atomic<std::uint64_t> count;       ///< Occupied slots
+        std::atomic<std::uint64_t> records;     ///< Data file records covered by the index
+        std::uint64_t reserved[4];              ///< Zero
+    };
+
+    /**
+     * @struct Slot
+     * @brief One hash table entry. A zero tag marks an empty slot.
+     */
+    struct Slot {
+        std::atomic<std::uint64_t> tag;         ///< Key hash with the low bit set
+        std::atomic<std::uint64_t> record;      ///< Record number in the data file
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "index slots are shared through a mapping");
+    static_assert(std::is_standard_layout<IndexHeader>::value && sizeof(IndexHeader) == 64, "index header layout");
+    static_assert(std::is_standard_layout<Slot>::value && sizeof(Slot) == 16, "index slot layout");
+
+#ifdef _WIN32
+    using NativeFile = HANDLE;
+    const NativeFile INVALID_FILE = INVALID_HANDLE_VALUE;
+#else
+    using NativeFile = int;
+    constexpr NativeFile INVALID_FILE = -1;
+#endif
+
+    NativeFile openFile(const std::string& path, bool truncate) {
+#ifdef _WIN32
+        return ::CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                             FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                             truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        return ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+#endif
+    }
+
+    void closeFile(NativeFile file) {
+        if (file == INVALID_FILE) return;
+#ifdef _WIN32
+        ::CloseHandle(file);
+#else
+        ::close(file);
+#endif
+    }
+
+    bool fileSize(NativeFile file, std::uint64_t& size) {
+#ifdef _WIN32
+        LARGE_INTEGER value;
+        if (!::GetFileSizeEx(file, &value)) return false;
+        size = static_cast<std::uint64_t>(value.QuadPart);
+#else
+        struct stat st;
+        if (::fstat(file, &st) != 0) return false;
+        size = static_cast<std::uint64_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    bool resizeFile(NativeFile file, std::uint64_t size) {
+#ifdef _WIN32
+        LARGE_INTEGER value;
+        value.QuadPart = static_cast<LONGLONG>(size);
+        return ::SetFilePointerEx(file, value, nullptr, FILE_BEGIN) && ::SetEndOfFile(file);
+#else
+        return ::ftruncate(file, static_cast<off_t>(size)) == 0;
+#endif
+    }
+
+    bool readAt(NativeFile file, std::uint64_t offset, void* buffer, std::size_t size) {
+        auto* out = static_cast<char*>(buffer);
+        while (size > 0) {
+#ifdef _WIN32
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD done = 0;
+            if (!::ReadFile(file, out, static_cast<DWORD>(size), &done, &overlapped) || done == 0) return false;
+#else
+            const ssize_t done = ::pread(file, out, size, static_cast<off_t>(offset));
+            if (done <= 0) return false;
+#endif
+            out += done;
+            offset += static_cast<std::uint64_t>(done);
+            size -= static_cast<std::size_t>(done);
+        }
+        return true;
+    }
+
+    bool writeAt(NativeFile file, std::uint64_t offset, const void* buffer, std::size_t size) {
+        const auto* in = static_cast<const char*>(buffer);
+        while (size > 0) {
+#ifdef _WIN32
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD done = 0;
+            if (!::WriteFile(file, in, static_cast<DWORD>(size), &done, &overlapped) || done == 0) return false;
+#else
+            const ssize_t done = ::pwrite(file, in, size, static_cast<off_t>(offset));
+            if (done <= 0) return false;
+#endif
+            in += done;
+            offset += static_cast<std::uint64_t>(done);
+            size -= static_cast<std::size_t>(done);
+        }
+        return true;
+    }
+
+    bool syncFile(NativeFile file) {
+#ifdef _WIN32
+        return ::FlushFileBuffers(file) != 0;
+#else
+        return ::fsync(file) == 0;
+#endif
+    }
+
+    std::uint64_t mix(std::uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    /**
+     * @brief Builds the bytes identifying a position and roll (key followed by the dice byte).
+     */
+    void makeMatch(const PositionKey& key, int die1, int die2, std::uint8_t (&match)[MATCH_SIZE]) {
+        std::memcpy(match, key.data(), key.size());
+        const int high = std::max(die1, die2);
+        const int low = std::min(die1, die2);
+        match[10] = (high >= 1 && high <= 6 && low >= 1) ? static_cast<std::uint8_t>(high << 4 | low) : 0;
+    }
+
+    std::uint64_t hashMatch(const std::uint8_t* match) {
+        std::uint64_t lo = 0;
+        for (int i = 0; i < 8; ++i) lo |= static_cast<std::uint64_t>(match[i]) << (8 * i);
+        const std::uint64_t hi = match[8] | (static_cast<std::uint64_t>(match[9]) << 8) |
+                                 (static_cast<std::uint64_t>(match[10]) << 16);
+        return mix(lo ^ mix(hi + 0x9E3779B97F4A7C15ull));
+    }
+
+    std::uint64_t tagOf(std::uint64_t hash) {
+        return hash | 1;
+    }
+
+    void putU32(std::uint8_t* out, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+
+    std::uint32_t getU32(const std::uint8_t* in) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<std::uint32_t>(in[i]) << (8 * i);
+        return value;
+    }
+
+    void putFloat(std::uint8_t* out, float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof bits);
+        putU32(out, bits);
+    }
+
+    float getFloat(const std::uint8_t* in) {
+        const std::uint32_t bits = getU32(in);
+        float value;
+        std::memcpy(&value, &bits, sizeof value);
+        return value;
+    }
+
+    /**
+     * @brief Encodes a record: [11 match][u8 depth][f32 equity][f32 win][f32 gammon][u64 time][u8 moves][4 x (i8 from, i8 to)].
+     */
+    void encodeRecord(const std::uint8_t (&match)[MATCH_SIZE], const PositionAnalysis& analysis,
+                      std::uint8_t* out) {
+        std::memset(out, 0, PositionDatabase::RECORD_SIZE);
+        std::memcpy(out, match, MATCH_SIZE);
+        out[11] = analysis.depth;
+        putFloat(out + 12, analysis.equity);
+        putFloat(out + 16, analysis.winChance);
+        putFloat(out + 20, analysis.gammonChance);
+        putU32(out + 24, static_cast<std::uint32_t>(analysis.timestamp));
+        putU32(out + 28, static_cast<std::uint32_t>(analysis.timestamp >> 32));
+        const int count = std::min<int>(analysis.bestPlay.count, Play::MAX_MOVES);
+        out[32] = static_cast<std::uint8_t>(count);
+        for (int i = 0; i < count; ++i) {
+            out[33 + 2 * i] = static_cast<std::uint8_t>(analysis.bestPlay.moves[i].fromIndex);
+            out[34 + 2 * i] = static_cast<std::uint8_t>(analysis.bestPlay.moves[i].toIndex);
+        }
+    }
+
+    void decodeRecord(const std::uint8_t* in, PositionAnalysis& analysis) {
+        analysis.depth = in[11];
+        analysis.equity = getFloat(in + 12);
+        analysis.winChance = getFloat(in + 16);
+        analysis.gammonChance = getFloat(in + 20);
+        analysis.timestamp = getU32(in + 24) | (static_cast<std::uint64_t>(getU32(in + 28)) << 32);
+        analysis.bestPlay = Play{};
+        const int count = std::min<int>(in[32], Play::MAX_MOVES);
+        for (int i = 0; i < count; ++i) {
+            analysis.bestPlay.push(static_cast<std::int8_t>(in[33 + 2 * i]), static_cast<std::int8_t>(in[34 + 2 * i]));
+        }
+    }
+
+    std::uint64_t capacityFor(std::uint64_t entries) {
+        std::uint64_t capacity = PositionDatabase::INITIAL_CAPACITY;
+        while (entries * 100 >= capacity * MAX_LOAD_PERCENT) capacity *= 2;
+        return capacity;
+    }
+
+    std::uint64_t indexFileSize(std::uint64_t capacity) {
+        return sizeof(IndexHeader) + capacity * sizeof(Slot);
+    }
+}
+
+/**
+ * @struct PositionDatabase::Index
+ * @brief A mapped index file. Immutable in size; replaced as a whole when it fills up.
+ */
+struct PositionDatabase::Index {
+    ~Index() {
+#ifdef _WIN32
+        if (base) ::UnmapViewOfFile(base);
+        if (mapping) ::CloseHandle(mapping);
+#else
+        if (base) ::munmap(base, size);
+#endif
+        closeFile(file);
+    }
+
+    /**
+     * @brief Maps an index file.
+     * @param path Index file
+     * @param createCapacity Capacity of a new, empty file; 0 to map an existing file
+     * @return False if the file could not be mapped or is not a valid index
+     */
+    bool map(const std::string& path, std::uint64_t createCapacity) {
+        if (createCapacity) {
+            file = openFile(path, true);
+        }
+        else {
+#ifdef _WIN32
+            file = ::CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+#else
+            file = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+#endif
+        }
+        if (file == INVALID_FILE) return false;
+
+        std::uint64_t bytes = 0;
+        if (createCapacity) {
+            bytes = indexFileSize(createCapacity);
+            if (!resizeFile(file, bytes)) return false;
+        }
+        else if (!fileSize(file, bytes) || bytes < sizeof(IndexHeader)) {
+            return false;
+        }
+        size = static_cast<std::size_t>(bytes);
+
+#ifdef _WIN32
+        mapping = ::CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+        if (!mapping) return false;
+        base = ::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (!base) return false;
+#else
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (address == MAP_FAILED) return false;
+        base = address;
+#endif
+
+        header = static_cast<IndexHeader*>(base);
+        slots = reinterpret_cast<Slot*>(static_cast<std::uint8_t*>(base) + sizeof(IndexHeader));
+        if (createCapacity) {
+            // A freshly sized file reads as zeros, i.e. all slots empty
+            std::memcpy(header->magic, INDEX_MAGIC, sizeof INDEX_MAGIC);
+            header->version = FORMAT_VERSION;
+            header->capacity = createCapacity;
+        }
+        else if (std::memcmp(header->magic, INDEX_MAGIC, sizeof INDEX_MAGIC) != 0 ||
+                 header->version != FORMAT_VERSION || header->capacity < INITIAL_CAPACITY ||
+                 (header->capacity & (header->capacity - 1)) != 0 || indexFileSize(header->capacity) != bytes) {
+            return false;
+        }
+        mask = header->capacity - 1;
+        return true;
+    }
+
+    /**
+     * @brief Inserts a slot known not to be present yet (writer only).
+     */
+    void insertNew(std::uint64_t tag, std::uint64_t record) {
+        for (std::uint64_t i = tag >> 1;; ++i) {
+            Slot& slot = slots[i & mask];
+            if (slot.tag.load(std::memory_order_relaxed) == 0) {
+                slot.record.store(record, std::memory_order_relaxed);
+                slot.tag.store(tag, std::memory_order_release);
+                header->count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    std::string path;                   ///< Index file
+    void* base = nullptr;               ///< Start of the mapping
+    std::size_t size = 0;               ///< Mapped size
+    IndexHeader* header = nullptr;      ///< Header inside the mapping
+    Slot* slots = nullptr;              ///< Slot array inside the mapping
+    std::uint64_t mask = 0;             ///< capacity - 1
+    NativeFile file = INVALID_FILE;     ///< Index file handle
+#ifdef _WIN32
+    HANDLE mapping = nullptr;           ///< File mapping handle
+#endif
+};
+
+PositionDatabase::PositionDatabase()
+    : m_recordCount(0), m_open(false), m_dataFile(INVALID_FILE) {
+}
+
+PositionDatabase::~PositionDatabase() {
+    close();
+}
+
+bool PositionDatabase::open(const std::string& path) {
+    close();
+    m_path = path;
+
+    m_dataFile = openFile(path + ".dat", false);
+    if (m_dataFile == INVALID_FILE) return false;
+
+    std::uint64_t bytes = 0;
+    if (!fileSize(m_dataFile, bytes)) {
+        close();
+        return false;
+    }
+    if (bytes == 0) {
+        std::uint8_t header[DATA_HEADER_SIZE];
+        std::memcpy(header, DATA_MAGIC, sizeof DATA_MAGIC);
+        putU32(header + 4, FORMAT_VERSION);
+        if (!writeAt(m_dataFile, 0, header, sizeof header)) {
+            close();
+            return false;
+        }
+        bytes = DATA_HEADER_SIZE;
+    }
+
+    std::uint8_t header[DATA_HEADER_SIZE];
+    if (bytes < DATA_HEADER_SIZE || !readAt(m_dataFile, 0, header, sizeof header) ||
+        std::memcmp(header, DATA_MAGIC, sizeof DATA_MAGIC) != 0 || getU32(header + 4) != FORMAT_VERSION) {
+        close();
+        return false;
+    }
+    m_recordCount = (bytes - DATA_HEADER_SIZE) / RECORD_SIZE;
+    const std::uint64_t used = DATA_HEADER_SIZE + m_recordCount * RECORD_SIZE;
+    if (used != bytes && !resizeFile(m_dataFile, used)) {
+        close();
+        return false;
+    }
+
+    auto index = std::make_shared<Index>();
+    index->path = path + ".idx";
+    if (index->map(index->path, 0) &&
+        index->header->records.load(std::memory_order_relaxed) == m_recordCount) {
+        std::atomic_store(&m_index, std::move(index));
+    }
+    else {
+        index.reset();
+        std::shared_ptr<Index> rebuilt = buildIndex(capacityFor(m_recordCount), true);
+        if (!rebuilt) {
+            close();
+            return false;
+        }
+        std::atomic_store(&m_index, std::move(rebuilt));
+    }
+
+    m_open = true;
+    return true;
+}
+
+void PositionDatabase::close() {
+    std::atomic_store(&m_index, std::shared_ptr<Index>());
+    closeFile(m_dataFile);
+    m_dataFile = INVALID_FILE;
+    m_recordCount = 0;
+    m_open = false;
+}
+
+bool PositionDatabase::isOpen() const {
+    return m_open;
+}
+
+bool PositionDatabase::lookup(const PositionKey& key, int die1, int die2, PositionAnalysis& analysis) const {
+    const std::shared_ptr<Index> index = std::atomic_load(&m_index);
+    if (!index) return false;
+
+    std::uint8_t match[MATCH_SIZE];
+    makeMatch(key, die1, die2, match);
+    const std::uint64_t tag = tagOf(hashMatch(match));
+
+    for (std::uint64_t i = tag >> 1, probes = 0; probes <= index->mask; ++i, ++probes) {
+        const Slot& slot = index->slots[i & index->mask];
+        const std::uint64_t slotTag = slot.tag.load(std::memory_order_acquire);
+        if (slotTag == 0) return false;
+        if (slotTag != tag) continue;
+
+        std::uint8_t bytes[RECORD_SIZE];
+        if (!readRecord(slot.record.load(std::memory_order_acquire), bytes)) return false;
+        if (std::memcmp(bytes, match, MATCH_SIZE) == 0) {
+            decodeRecord(bytes, analysis);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PositionDatabase::store(const PositionKey& key, int die1, int die2, const PositionAnalysis& analysis) {
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    std::shared_ptr<Index> index = std::atomic_load(&m_index);
+    if (!index) return false;
+
+    if ((index->header->count.load(std::memory_order_relaxed) + 1) * 100 > index->header->capacity * MAX_LOAD_PERCENT) {
+        index = buildIndex(index->header->capacity * 2, false);
+        if (!index) return false;
+        std::atomic_store(&m_index, index);
+    }
+
+    std::uint8_t match[MATCH_SIZE];
+    makeMatch(key, die1, die2, match);
+    std::uint8_t bytes[RECORD_SIZE];
+    encodeRecord(match, analysis, bytes);
+
+    // The record must be in the file before any reader can find it
+    const std::uint64_t record = m_recordCount;
+    if (!writeAt(m_dataFile, DATA_HEADER_SIZE + record * RECORD_SIZE, bytes, RECORD_SIZE)) return false;
+    ++m_recordCount;
+
+    publish(*index, match, record);
+
+    index->header->records.store(m_recordCount, std::memory_order_release);
+    return true;
+}
+
+std::size_t PositionDatabase::size() const {
+    const std::shared_ptr<Index> index = std::atomic_load(&m_index);
+    return index ? static_cast<std::size_t>(index->header->count.load(std::memory_order_relaxed)) : 0;
+}
+
+bool PositionDatabase::flush() {
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    const std::shared_ptr<Index> index = std::atomic_load(&m_index);
+    if (!index) return false;
+
+    bool ok = syncFile(m_dataFile);
+#ifdef _WIN32
+    ok = ::FlushViewOfFile(index->base, 0) && ok;
+    ok = syncFile(index->file) && ok;
+#else
+    ok = ::msync(index->base, index->size, MS_SYNC) == 0 && ok;
+#endif
+    return ok;
+}
+
+std::shared_ptr<PositionDatabase::Index> PositionDatabase::buildIndex(std::uint64_t capacity, bool fromDataFile) {
+    // Built under a capacity-specific name, so an older table that is still
+    // mapped (and on Windows cannot be replaced) is never truncated
+    const std::string target = m_path + ".idx";
+    auto index = std::make_shared<Index>();
+    index->path = target + "." + std::to_string(capacity);
+    if (!index->map(index->path, capacity)) {
+        std::remove(index->path.c_str());
+        return nullptr;
+    }
+
+    if (fromDataFile) {
+        std::uint8_t bytes[RECORD_SIZE];
+        for (std::uint64_t record = 0; record < m_recordCount; ++record) {
+            if (!readRecord(record, bytes)) return nullptr;
+            // Later records of the same position replace earlier ones
+            publish(*index, bytes, record);
+        }
+    }
+    else {
+        const std::shared_ptr<Index> current = std::atomic_load(&m_index);
+        for (std::uint64_t i = 0; current && i <= current->mask; ++i) {
+            const Slot& slot = current->slots[i];
+            const std::uint64_t tag = slot.tag.load(std::memory_order_relaxed);
+            if (tag != 0) index->insertNew(tag, slot.record.load(std::memory_order_relaxed));
+        }
+    }
+    index->header->records.store(m_recordCount, std::memory_order_release);
+
+    // If the rename fails the old file stays stale and is rebuilt on the next open()
+#ifdef _WIN32
+    std::remove(target.c_str());
+#endif
+    if (std::rename(index->path.c_str(), target.c_str()) == 0) index->path = target;
+    return index;
+}
+
+void PositionDatabase::publish(Index& index, const std::uint8_t* match, std::uint64_t record) {
+    const std::uint64_t tag = tagOf(hashMatch(match));
+
+    for (std::uint64_t i = tag >> 1, probes = 0; probes <= index.mask; ++i, ++probes) {
+        Slot& slot = index.slots[i & index.mask];
+        const std::uint64_t slotTag = slot.tag.load(std::memory_order_relaxed);
+        if (slotTag == 0) break;
+        if (slotTag != tag) continue;
+
+        std::uint8_t existing[RECORD_SIZE];
+        if (readRecord(slot.record.load(std::memory_order_relaxed), existing) &&
+            std::memcmp(existing, match, MATCH_SIZE) == 0) {
+            slot.record.store(record, std::memory_order_release);
+            return;
+        }
+    }
+    index.insertNew(tag, record);
+}
+
+bool PositionDatabase::readRecord(std::uint64_t record, std::uint8_t* bytes) const {
+    return readAt(m_dataFile, DATA_HEADER_SIZE + record * RECORD_SIZE, bytes, RECORD_SIZE);
+}
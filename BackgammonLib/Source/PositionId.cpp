@@ -0,0 +1,240 @@
+/**
+ * @file PositionId.cpp
+ * @brief Implementation of the position key encoding.
+ */
+
+#include "PositionId.hpp"
+
+#include "Board.hpp"
+#include "GameStateDTO.hpp"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+    constexpr int POINTS = 25;     ///< Points per side including the bar
+    constexpr int CHECKERS = 15;   ///< Checkers per side
+    constexpr int KEY_BITS = 80;   ///< Bits in a key
+
+    const char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    /**
+     * @struct Bits80
+     * @brief An 80-bit value held in two machine words.
+     */
+    struct Bits80 {
+        std::uint64_t lo = 0;  ///< Bits 0-63
+        std::uint64_t hi = 0;  ///< Bits 64-79
+
+        /**
+         * @brief Sets n consecutive bits starting at pos.
+         */
+        void setOnes(unsigned pos, unsigned n) {
+            const std::uint64_t ones = (std::uint64_t{ 1 } << n) - 1;
+            if (pos < 64) {
+                lo |= ones << pos;
+                if (pos + n > 64) hi |= ones >> (64 - pos);
+            }
+            else {
+                hi |= ones << (pos - 64);
+            }
+        }
+
+        /**
+         * @brief Gets the bits starting at pos (at least 16 valid bits).
+         */
+        std::uint64_t window(unsigned pos) const {
+            if (pos == 0) return lo;
+            if (pos < 64) return (lo >> pos) | (hi << (64 - pos));
+            return pos < 128 ? hi >> (pos - 64) : 0;
+        }
+    };
+
+    unsigned countTrailingOnes(std::uint64_t value) {
+        const std::uint64_t zeros = ~value;
+        if (zeros == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(zeros));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index = 0;
+        _BitScanForward64(&index, zeros);
+        return static_cast<unsigned>(index);
+#else
+        unsigned n = 0;
+        while ((zeros >> n & 1) == 0) ++n;
+        return n;
+#endif
+    }
+
+    /**
+     * @brief Maps a point of a player's own numbering (0 = own 1-point, 24 = bar) to a column index.
+     */
+    int columnIndex(Color player, int point) {
+        return player == Color::WHITE ? 23 - point : point;
+    }
+
+    Color opponentOf(Color c) {
+        return c == Color::WHITE ? Color::BLACK : Color::WHITE;
+    }
+
+    int playerIndex(Color c) {
+        return c == Color::WHITE ? 0 : 1;
+    }
+
+    /**
+     * @brief Packs per-point counts (on-roll side first) into a key.
+     */
+    PositionKey pack(const int (&counts)[2][POINTS]) {
+        Bits80 bits;
+        unsigned pos = 0;
+        for (int side = 0; side < 2; ++side) {
+            for (int p = 0; p < POINTS; ++p) {
+                const unsigned n = static_cast<unsigned>(counts[side][p]);
+                if (n) bits.setOnes(pos, n);
+                pos += n + 1;
+            }
+        }
+
+        PositionKey key{};
+        for (int i = 0; i < 8; ++i) key[i] = static_cast<std::uint8_t>(bits.lo >> (8 * i));
+        key[8] = static_cast<std::uint8_t>(bits.hi);
+        key[9] = static_cast<std::uint8_t>(bits.hi >> 8);
+        return key;
+    }
+
+    /**
+     * @brief Unpacks a key into per-point counts (on-roll side first).
+     */
+    bool unpack(const PositionKey& key, int (&counts)[2][POINTS]) {
+        Bits80 bits;
+        for (int i = 0; i < 8; ++i) bits.lo |= static_cast<std::uint64_t>(key[i]) << (8 * i);
+        bits.hi = static_cast<std::uint64_t>(key[8]) | (static_cast<std::uint64_t>(key[9]) << 8);
+
+        unsigned pos = 0;
+        for (int side = 0; side < 2; ++side) {
+            int total = 0;
+            for (int p = 0; p < POINTS; ++p) {
+                const unsigned n = countTrailingOnes(bits.window(pos));
+                total += static_cast<int>(n);
+                if (total > CHECKERS) return false;
+                counts[side][p] = static_cast<int>(n);
+                pos += n + 1;
+            }
+        }
+        if (pos > KEY_BITS) return false;
+        // Unused high bits must be clear so that each layout has exactly one key
+        if (pos < KEY_BITS) {
+            const unsigned spare = KEY_BITS - pos;
+            const std::uint64_t mask = spare >= 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << spare) - 1;
+            if ((bits.window(pos) & mask) != 0) return false;
+        }
+
+        // No column may hold checkers of both sides
+        for (int p = 0; p < 24; ++p) {
+            if (counts[0][p] > 0 && counts[1][23 - p] > 0) return false;
+        }
+        return true;
+    }
+}
+
+PositionKey PositionId::encode(const Board& board, Color onRoll) {
+    int counts[2][POINTS] = {};
+    const Color sides[2] = { onRoll, opponentOf(onRoll) };
+    for (int side = 0; side < 2; ++side) {
+        const Color player = sides[side];
+        for (int p = 0; p < 24; ++p) {
+            const Column& col = board.getColumn(columnIndex(player, p));
+            if (col.getColor() == player) counts[side][p] = col.getPieceCount();
+        }
+        counts[side][24] = board.getBarCount(playerIndex(player));
+    }
+    return pack(counts);
+}
+
+PositionKey PositionId::encode(const GameStateDTO& state) {
+    int counts[2][POINTS] = {};
+    const Color onRoll = state.currentPlayer == Color::BLACK ? Color::BLACK : Color::WHITE;
+    const Color sides[2] = { onRoll, opponentOf(onRoll) };
+    for (int side = 0; side < 2; ++side) {
+        const Color player = sides[side];
+        for (int p = 0; p < 24; ++p) {
+            const int index = columnIndex(player, p);
+            if (state.colors[index] == player) counts[side][p] = state.pieceCounts[index];
+        }
+        counts[side][24] = player == Color::WHITE ? state.barWhite : state.barBlack;
+    }
+    return pack(counts);
+}
+
+bool PositionId::decode(const PositionKey& key, Color onRoll, Board& board) {
+    int counts[2][POINTS] = {};
+    if (!unpack(key, counts)) return false;
+
+    for (int i = 0; i < 24; ++i) board.getColumn(i) = Column(0, Color::NONE);
+
+    const Color sides[2] = { onRoll, opponentOf(onRoll) };
+    for (int side = 0; side < 2; ++side) {
+        const Color player = sides[side];
+        int onBoard = counts[side][24];
+        for (int p = 0; p < 24; ++p) {
+            if (counts[side][p] > 0) board.getColumn(columnIndex(player, p)) = Column(counts[side][p], player);
+            onBoard += counts[side][p];
+        }
+        board.setBarCount(playerIndex(player), counts[side][24]);
+        board.setBorneOffCount(playerIndex(player), CHECKERS - onBoard);
+    }
+    return true;
+}
+
+bool PositionId::isValid(const PositionKey& key) {
+    int counts[2][POINTS] = {};
+    return unpack(key, counts);
+}
+
+std::string PositionId::toString(const PositionKey& key) {
+    std::string text;
+    text.reserve(TEXT_SIZE);
+    std::uint32_t buffer = 0;
+    int bits = 0;
+    for (std::uint8_t byte : key) {
+        buffer = (buffer << 8) | byte;
+        bits += 8;
+        while (bits >= 6) {
+            bits -= 6;
+            text.push_back(BASE64[(buffer >> bits) & 0x3F]);
+        }
+    }
+    if (bits > 0) text.push_back(BASE64[(buffer << (6 - bits)) & 0x3F]);
+    return text;
+}
+
+bool PositionId::fromString(std::string_view text, PositionKey& key) {
+    if (text.size() != TEXT_SIZE) return false;
+
+    PositionKey result{};
+    std::uint32_t buffer = 0;
+    int bits = 0;
+    std::size_t out = 0;
+    for (char c : text) {
+        int value = -1;
+        if (c >= 'A' && c <= 'Z') value = c - 'A';
+        else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+        else if (c >= '0' && c <= '9') value = c - '0' + 52;
+        else if (c == '+') value = 62;
+        else if (c == '/') value = 63;
+        if (value < 0) return false;
+
+        buffer = (buffer << 6) | static_cast<std::uint32_t>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            result[out++] = static_cast<std::uint8_t>(buffer >> bits);
+        }
+    }
+    // 84 bits of text carry 80 bits of key; the last 4 must be zero
+    if ((buffer & ((1u << bits) - 1)) != 0) return false;
+
+    key = result;
+    return true;
+}
@@ -0,0 +1,18 @@
+/**
+ * @file SessionArena.cpp
+ * @brief Implementation of the SessionArena class.
+ */
+
+#include "SessionArena.hpp"
+
+SessionArena::SessionArena()
+    : m_inline{}, m_resource(m_inline.data(), m_inline.size(), std::pmr::new_delete_resource()) {
+}
+
+std::pmr::memory_resource* SessionArena::resource() {
+    return &m_resource;
+}
+
+void SessionArena::release() {
+    m_resource.release();
+}
@@ -0,0 +1,59 @@
+/**
+ * @file SnapshotPublisher.cpp
+ * @brief Implementation of the lock-free game snapshots.
+ */
+
+#include "SnapshotPublisher.hpp"
+
+#include <atomic>
+#include "Game.hpp"
+
+std::vector<int> GameSnapshot::targetsFrom(int fromIndex) const {
+    std::vector<int> targets;
+    for (const CheckerMove& move : legalMoves) {
+        if (move.fromIndex == fromIndex) targets.push_back(move.toIndex);
+    }
+    return targets;
+}
+
+SnapshotPublisher::SnapshotPublisher(const IGame& game, bool withLegalMoves)
+    : m_game(game), m_withLegalMoves(withLegalMoves), m_version(0) {
+}
+
+void SnapshotPublisher::publish() {
+    auto snapshot = std::make_shared<GameSnapshot>();
+    snapshot->version = ++m_version;
+    snapshot->state = m_game.getState();
+    snapshot->phase = m_game.getPhase();
+
+    if (m_withLegalMoves) {
+        snapshot->hasLegalMoves = true;
+        if (snapshot->phase == GamePhase::IN_PROGRESS && (snapshot->state.dice1 != 0 || snapshot->state.dice2 != 0)) {
+            for (int from = 0; from <= Game::BAR_INDEX; ++from) {
+                if (from == 24 || !m_game.canSelectPoint(from)) continue;
+                for (int to : m_game.getLegalTargets(from)) {
+                    snapshot->legalMoves.push_back(CheckerMove{ static_cast<std::int8_t>(from), static_cast<std::int8_t>(to) });
+                }
+            }
+        }
+    }
+    std::atomic_store(&m_current, std::shared_ptr<const GameSnapshot>(std::move(snapshot)));
+}
+
+std::shared_ptr<const GameSnapshot> SnapshotPublisher::current() const {
+    return std::atomic_load(&m_current);
+}
+
+void SnapshotPublisher::onGameStarted() { publish(); }
+
+void SnapshotPublisher::onDiceRolled(Color, int, int) { publish(); }
+
+void SnapshotPublisher::onMoveMade(Color, int, int, MoveResult) { publish(); }
+
+void SnapshotPublisher::onPlayMade(Color, const Play&) { publish(); }
+
+void SnapshotPublisher::onTurnChanged(Color) { publish(); }
+
+void SnapshotPublisher::onStateRestored() { publish(); }
+
+void SnapshotPublisher::onGameFinished(Color) { publish(); }
@@ -0,0 +1,145 @@
+/**
+ * @file Tracing.cpp
+ * @brief Implementation of the per-thread span buffers and the Chrome trace writer.
+ */
+
+#include "Tracing.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace {
+    /**
+     * @struct TraceEvent
+     * @brief One completed span.
+     */
+    struct TraceEvent {
+        const char* name;         ///< Span name
+        std::uint64_t beginNs;    ///< Start timestamp
+        std::uint64_t durationNs; ///< Duration
+    };
+
+    /**
+     * @struct ThreadBuffer
+     * @brief Span storage written only by its owning thread.
+     */
+    struct ThreadBuffer {
+        explicit ThreadBuffer(std::uint32_t threadId) : tid(threadId) {}
+
+        std::uint32_t tid;                      ///< Trace thread id
+        std::string name;                       ///< Thread name (guarded by g_registryMutex)
+        std::unique_ptr<TraceEvent[]> events;   ///< Fixed-capacity event storage, allocated on the first span
+        std::atomic<std::size_t> count{ 0 };    ///< Published events
+        std::atomic<std::uint64_t> dropped{ 0 }; ///< Spans lost because the buffer was full
+    };
+
+    std::atomic<bool> g_enabled{ false };                 ///< Recording switch
+    std::mutex g_registryMutex;                           ///< Guards g_buffers and thread names
+    std::vector<std::unique_ptr<ThreadBuffer>> g_buffers; ///< Buffers of every thread that traced
+    thread_local ThreadBuffer* t_buffer = nullptr;        ///< Buffer of the calling thread
+
+    ThreadBuffer& threadBuffer() {
+        if (!t_buffer) {
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            g_buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<std::uint32_t>(g_buffers.size() + 1)));
+            t_buffer = g_buffers.back().get();
+        }
+        return *t_buffer;
+    }
+
+    void writeEscaped(std::ostream& out, const char* text) {
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') out << '\\';
+            if (static_cast<unsigned char>(*c) >= 0x20) out << *c;
+        }
+    }
+}
+
+void Tracer::setEnabled(bool enabled) {
+    epoch();
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Tracer::isEnabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    buffer.name = name;
+}
+
+void Tracer::record(const char* name, std::uint64_t beginNs, std::uint64_t endNs) {
+    ThreadBuffer& buffer = threadBuffer();
+    const std::size_t index = buffer.count.load(std::memory_order_relaxed);
+    if (index >= EVENTS_PER_THREAD) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!buffer.events) buffer.events = std::make_unique<TraceEvent[]>(EVENTS_PER_THREAD);
+    buffer.events[index] = TraceEvent{ name, beginNs, endNs - beginNs };
+    buffer.count.store(index + 1, std::memory_order_release);
+}
+
+std::uint64_t Tracer::droppedCount() {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    std::uint64_t total = 0;
+    for (const auto& buffer : g_buffers) total += buffer->dropped.load(std::memory_order_relaxed);
+    return total;
+}
+
+void Tracer::clear() {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    for (auto& buffer : g_buffers) {
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Tracer::writeChromeJson(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    char number[64];
+    bool first = true;
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (const auto& buffer : g_buffers) {
+        if (!buffer->name.empty()) {
+            out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"args\":{\"name\":\"";
+            writeEscaped(out, buffer->name.c_str());
+            out << "\"}}";
+            first = false;
+        }
+
+        const std::size_t count = buffer->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; ++i) {
+            const TraceEvent& e = buffer->events[i];
+            out << (first ? "" : ",") << "\n{\"name\":\"";
+            writeEscaped(out, e.name);
+            std::snprintf(number, sizeof(number), "%.3f", e.beginNs / 1000.0);
+            out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid << ",\"ts\":" << number;
+            std::snprintf(number, sizeof(number), "%.3f", e.durationNs / 1000.0);
+            out << ",\"dur\":" << number << "}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+}
+
+bool Tracer::writeFile(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) return false;
+    writeChromeJson(out);
+    return static_cast<bool>(out.flush());
+}
+
+std::chrono::steady_clock::time_point Tracer::epoch() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return start;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file GameServer.hpp
+ * @brief Defines the epoll-based multi-session Backgammon game server.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Protocol.hpp"
+#include "ServerConnection.hpp"
+#include "SessionJournal.hpp"
+#include "SessionStore.hpp"
+
+/**
+ * @struct ServerConfig
+ * @brief Listening endpoint and threading configuration for GameServer.
+ */
+struct ServerConfig {
+    std::string unixSocketPath;  ///< Unix socket path; used when not empty
+    std::uint16_t tcpPort = 0;   ///< Loopback TCP port; used when unixSocketPath is empty
+    unsigned workerCount = 0;    ///< Worker threads (0 = hardware concurrency)
+    std::string journalPath;     ///< Journal and snapshot path prefix; sessions are not persisted when empty
+    std::uint64_t snapshotInterval = 100000; ///< Journal entries between snapshots (0 = never)
+    std::size_t spectatorBacklog = 1 << 20;  ///< Unsent update bytes after which a spectator connection is dropped
+};
+
+/**
+ * @class GameServer
+ * @brief Hosts many concurrent game sessions behind a local socket.
+ *
+ * Each worker thread runs its own epoll loop, accepts connections from the
+ * shared listening socket (EPOLLEXCLUSIVE avoids thundering herds) and owns
+ * one shard of the SessionStore. Requests on a connection are served in
+ * order and answered with one response frame each (see Protocol.hpp).
+ *
+ * With a journal configured, every state change is logged and the responses
+ * to a batch of requests are only sent once their journal entries are on
+ * disk, so an acknowledged change survives a crash.
+ *
+ * Connections can subscribe to a session. Each change of a watched session
+ * is encoded once into a shared, immutable update frame; every subscriber's
+ * connection queues a reference to the same bytes, and the queue is sent
+ * with one sendmsg() gathering responses and updates. Subscribers owned by
+ * other workers get the frame through that worker's inbox. A subscriber that
+ * stops reading is disconnected once ServerConfig::spectatorBacklog bytes of
+ * updates are waiting for it.
+ */
+class GameServer {
+public:
+    /**
+     * @brief Constructor storing the configuration; nothing is bound yet.
+     * @param config Server configuration
+     */
+    explicit GameServer(ServerConfig config);
+
+    /**
+     * @brief Destructor stopping the server if it is running.
+     */
+    ~GameServer();
+
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    /**
+     * @brief Restores the sessions from the configured journal. Call before start().
+     *
+     * Does nothing without ServerConfig::journalPath.
+     *
+     * @param sessionCount Receives the number of restored sessions
+     * @param replayed Receives the number of journal entries replayed after the snapshot
+     * @return False if the journal or snapshot is unusable
+     */
+    bool recover(std::size_t& sessionCount, std::size_t& replayed);
+
+    /**
+     * @brief Binds the listening socket and starts the worker threads.
+     *
+     * With a journal configured, recover() must have succeeded first.
+     *
+     * @return False if the socket could not be set up
+     */
+    bool start();
+
+    /**
+     * @brief Stops all workers and closes every connection.
+     */
+    void stop();
+
+    /**
+     * @brief Gets the session store.
+     * @return Reference to the session store
+     */
+    SessionStore& sessions();
+
+private:
+    struct Worker;
+
+    /**
+     * @brief Creates the listening socket described by the configuration.
+     * @return True on success
+     */
+    bool openListener();
+
+    /**
+     * @brief Event loop of one worker thread.
+     * @param worker Worker to run
+     */
+    void runWorker(Worker& worker);
+
+    /**
+     * @brief Accepts all pending connections on the listening socket.
+     * @param worker Worker that will own the connections
+     */
+    void acceptConnections(Worker& worker);
+
+    /**
+     * @brief Reads from a connection and answers all complete requests.
+     * @param worker Owning worker
+     * @param fd Connection socket
+     * @return False if the connection must be closed
+     */
+    bool handleReadable(Worker& worker, int fd);
+
+    /**
+     * @brief Flushes pending output of a connection.
+     * @param worker Owning worker
+     * @param fd Connection socket
+     * @return False if the connection must be closed
+     */
+    bool handleWritable(Worker& worker, int fd);
+
+    /**
+     * @brief Closes a connection, ends its subscriptions and forgets its buffers.
+     *
+     * Does nothing if the worker has no such connection.
+     *
+     * @param worker Owning worker
+     * @param fd Connection socket
+     */
+    void closeConnection(Worker& worker, int fd);
+
+    /**
+     * @brief Executes a request and appends the response frame.
+     *
+     * Changes of watched sessions are queued on the worker as update frames.
+     *
+     * @param worker Calling worker, owner of the connection and of a shard
+     * @param fd Connection socket
+     * @param conn Connection the request came from
+     * @param request Decoded request
+     * @param lsn Raised to the LSN of any journal entry logged for the request
+     */
+    void handleRequest(Worker& worker, int fd, ServerConnection& conn, const Protocol::Request& request, std::uint64_t& lsn);
+
+    /**
+     * @brief Sends the update frames queued by the worker's requests to their subscribers.
+     * @param worker Worker whose updates are sent
+     */
+    void publishUpdates(Worker& worker);
+
+    /**
+     * @brief Queues the update frames other workers delivered to this worker's inbox.
+     * @param worker Receiving worker
+     */
+    void drainInbox(Worker& worker);
+
+    /**
+     * @brief Queues an update frame on a connection, dropping the connection if it lags too far behind.
+     * @param worker Owning worker
+     * @param fd Connection socket
+     * @param connection Connection id the frame is meant for
+     * @param frame Update frame
+     * @param touched Receives fd when the connection needs a flush
+     */
+    void deliverUpdate(Worker& worker, int fd, std::uint64_t connection, const SharedFrame& frame, std::vector<int>& touched);
+
+    /**
+     * @brief Flushes connections that received updates.
+     * @param worker Owning worker
+     * @param touched Connection sockets to flush
+     */
+    void flushTouched(Worker& worker, std::vector<int>& touched);
+
+    ServerConfig m_config;                          ///< Server configuration
+    SessionStore m_sessions;                        ///< All hosted sessions
+    std::unique_ptr<SessionJournal> m_journal;      ///< Journal of session changes (null when not persisting)
+    int m_listenFd;                                 ///< Listening socket (-1 when stopped)
+    std::vector<std::unique_ptr<Worker>> m_workers; ///< Worker state, one per thread
+    std::vector<std::thread> m_threads;             ///< Worker threads
+    std::atomic<std::uint64_t> m_nextConnection;    ///< Id handed to the next accepted connection
+};
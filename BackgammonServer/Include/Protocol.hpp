@@ -0,0 +1,163 @@
+/**
+ * @file Protocol.hpp
+ * @brief Defines the compact binary protocol spoken by the Backgammon game server.
+ *
+ * Every frame starts with a little-endian 16-bit length of the frame body.
+ *
+ * Request body:  [u8 opcode][u32 session id][i8 arg0][i8 arg1]
+ *                PLAY appends arg0 moves as [i8 from][i8 to] pairs
+ * Response body: [u8 status][payload...]
+ * Update body:   [u8 Status::UPDATE][u32 session id][encoded state]
+ *
+ * Update frames are pushed unrequested to connections that subscribed to a
+ * session and may arrive between the responses to that connection's requests.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "GameStateDTO.hpp"
+#include "IGame.hpp"
+#include "Play.hpp"
+
+namespace Protocol {
+
+/// Size of the length prefix in front of every frame
+constexpr std::size_t LENGTH_PREFIX_SIZE = 2;
+
+/// Size of a request body
+constexpr std::size_t REQUEST_BODY_SIZE = 7;
+
+/// Size of an encoded game state payload
+constexpr std::size_t STATE_SIZE = 34;
+
+/// Size of an update body
+constexpr std::size_t UPDATE_BODY_SIZE = 1 + 4 + STATE_SIZE;
+
+/// Largest frame body accepted by either side
+constexpr std::size_t MAX_BODY_SIZE = 1024;
+
+/**
+ * @enum Opcode
+ * @brief Operations a client can request on a session.
+ */
+enum class Opcode : std::uint8_t {
+    CREATE = 0x01,              ///< Create a session; responds with its u32 id
+    START = 0x02,               ///< IGame::start()
+    ROLL_OPENING = 0x03,        ///< IGame::rollOpeningDice()
+    START_AFTER_OPENING = 0x04, ///< IGame::startGameAfterOpening()
+    ROLL = 0x05,                ///< IGame::rollDice(); responds with the two dice
+    MOVE = 0x06,                ///< IGame::makeMove(arg0, arg1); responds with a u8 MoveResult
+    PASS = 0x07,                ///< IGame::passTurn()
+    STATE = 0x08,               ///< Responds with the encoded game state
+    LEGAL_TARGETS = 0x09,       ///< IGame::getLegalTargets(arg0); responds with [u8 count][i8 targets...]
+    CLOSE = 0x0A,               ///< Destroys the session
+    SUBSCRIBE = 0x0B,           ///< Watches the session; responds with the encoded state, then pushes updates
+    UNSUBSCRIBE = 0x0C,         ///< Stops watching the session
+    PLAY = 0x0D                 ///< IGame::makePlay() with arg0 moves; responds with a u8 MoveResult
+};
+
+/**
+ * @enum Status
+ * @brief First byte of every response.
+ */
+enum class Status : std::uint8_t {
+    OK = 0,               ///< Request was executed
+    UNKNOWN_SESSION = 1,  ///< The session id does not exist
+    BAD_REQUEST = 2,      ///< Unknown opcode or malformed frame
+    UPDATE = 3            ///< Not a response: pushed state of a subscribed session
+};
+
+/**
+ * @struct Request
+ * @brief Decoded request frame.
+ */
+struct Request {
+    Opcode opcode = Opcode::STATE;  ///< Requested operation
+    std::uint32_t session = 0;      ///< Target session id (ignored by CREATE)
+    std::int8_t arg0 = 0;           ///< First argument (e.g. source column)
+    std::int8_t arg1 = 0;           ///< Second argument (e.g. destination column)
+    Play play;                      ///< Moves of a PLAY request (arg0 is set from play.count when encoding)
+};
+
+/**
+ * @enum DecodeResult
+ * @brief Outcome of trying to decode a frame from a byte buffer.
+ */
+enum class DecodeResult {
+    COMPLETE,    ///< A frame was decoded
+    INCOMPLETE,  ///< More bytes are needed
+    MALFORMED    ///< The stream is corrupt and the connection should be dropped
+};
+
+/**
+ * @brief Appends an encoded request frame to a buffer.
+ * @param request Request to encode
+ * @param out Buffer receiving the frame
+ */
+void encodeRequest(const Request& request, std::vector<std::uint8_t>& out);
+
+/**
+ * @brief Decodes one request frame from the front of a buffer.
+ * @param data Buffer start
+ * @param size Number of bytes available
+ * @param out Decoded request
+ * @param consumed Number of bytes consumed when COMPLETE
+ * @return DecodeResult
+ */
+DecodeResult decodeRequest(const std::uint8_t* data, std::size_t size, Request& out, std::size_t& consumed);
+
+/**
+ * @brief Appends an encoded response frame to a buffer.
+ * @param status Response status
+ * @param payload Payload bytes (may be null when size is 0)
+ * @param size Payload size
+ * @param out Buffer receiving the frame
+ */
+void encodeResponse(Status status, const std::uint8_t* payload, std::size_t size, std::vector<std::uint8_t>& out);
+
+/**
+ * @brief Decodes one response frame from the front of a buffer.
+ * @param data Buffer start
+ * @param size Number of bytes available
+ * @param status Decoded status
+ * @param payload Receives a pointer to the payload inside data
+ * @param payloadSize Receives the payload size
+ * @param consumed Number of bytes consumed when COMPLETE
+ * @return DecodeResult
+ */
+DecodeResult decodeResponse(const std::uint8_t* data, std::size_t size, Status& status,
+                            const std::uint8_t*& payload, std::size_t& payloadSize, std::size_t& consumed);
+
+/**
+ * @brief Appends an encoded update frame to a buffer.
+ * @param session Id of the changed session
+ * @param state New state of the session
+ * @param phase New phase of the session
+ * @param out Buffer receiving the frame
+ */
+void encodeUpdate(std::uint32_t session, const GameStateDTO& state, GamePhase phase, std::vector<std::uint8_t>& out);
+
+/**
+ * @brief Encodes a game state into STATE_SIZE bytes.
+ *
+ * Layout: phase, current player, dice1, dice2, opening white, opening black,
+ * bar white, bar black, off white, off black, then 24 signed column counts
+ * (positive for white, negative for black).
+ *
+ * @param state State to encode
+ * @param phase Current game phase
+ * @param out Destination of at least STATE_SIZE bytes
+ */
+void encodeState(const GameStateDTO& state, GamePhase phase, std::uint8_t* out);
+
+/**
+ * @brief Decodes a game state produced by encodeState.
+ * @param data Source of at least STATE_SIZE bytes
+ * @param state Decoded state
+ * @param phase Decoded phase
+ */
+void decodeState(const std::uint8_t* data, GameStateDTO& state, GamePhase& phase);
+
+} // namespace Protocol
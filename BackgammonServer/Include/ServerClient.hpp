@@ -0,0 +1,79 @@
+/**
+ * @file ServerClient.hpp
+ * @brief Defines a small blocking client for the game server protocol.
+ */
+
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include "Protocol.hpp"
+
+/**
+ * @class ServerClient
+ * @brief Blocking, single-connection client used by tools and tests.
+ *
+ * Each call sends one request and waits for its response. Update frames of
+ * subscribed sessions that arrive in between are kept for nextUpdate().
+ */
+class ServerClient {
+public:
+    /**
+     * @brief Constructor creating a disconnected client.
+     */
+    ServerClient();
+
+    /**
+     * @brief Destructor closing the connection.
+     */
+    ~ServerClient();
+
+    ServerClient(const ServerClient&) = delete;
+    ServerClient& operator=(const ServerClient&) = delete;
+
+    /**
+     * @brief Connects to a server listening on a Unix socket.
+     * @param path Socket path
+     * @return True on success
+     */
+    bool connectUnix(const std::string& path);
+
+    /**
+     * @brief Connects to a server listening on loopback TCP.
+     * @param port TCP port
+     * @return True on success
+     */
+    bool connectTcp(std::uint16_t port);
+
+    /**
+     * @brief Sends a request and waits for the response.
+     * @param request Request to send
+     * @param payload Receives the response payload
+     * @return Response status, or BAD_REQUEST if the connection failed
+     */
+    Protocol::Status call(const Protocol::Request& request, std::vector<std::uint8_t>& payload);
+
+    /**
+     * @brief Waits for the next update of a subscribed session.
+     * @param session Receives the id of the changed session
+     * @param state Receives the new state
+     * @param phase Receives the new phase
+     * @return False if the connection failed or a frame other than an update arrived
+     */
+    bool nextUpdate(std::uint32_t& session, GameStateDTO& state, GamePhase& phase);
+
+private:
+    /**
+     * @brief Reads the next frame from the connection.
+     * @param status Receives the frame status
+     * @param payload Receives the frame payload
+     * @return False if the connection failed or the stream is corrupt
+     */
+    bool receive(Protocol::Status& status, std::vector<std::uint8_t>& payload);
+
+    int m_fd;                                         ///< Connected socket (-1 if none)
+    std::vector<std::uint8_t> m_buffer;               ///< Scratch buffer for outgoing frames
+    std::vector<std::uint8_t> m_in;                   ///< Received bytes not yet decoded
+    std::deque<std::vector<std::uint8_t>> m_updates;  ///< Update payloads received during call()
+};
@@ -0,0 +1,173 @@
+/**
+ * @file ServerConnection.hpp
+ * @brief Defines the per-connection buffers and the connection table of a server worker.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <sys/uio.h>
+#include <unordered_map>
+#include <vector>
+
+/// Encoded frame shared by every connection it is sent to
+using SharedFrame = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+/**
+ * @class OutputQueue
+ * @brief Output of one connection: encoded responses and queued update frames.
+ *
+ * Whole frames are sent in queue order, except that responses may overtake
+ * updates that have not started yet, so frames never interleave. gather()
+ * describes the pending bytes for one sendmsg() and retire() drops what the
+ * call sent, which may end inside any of the gathered buffers.
+ */
+class OutputQueue {
+public:
+    /**
+     * @brief Gets the buffer that responses are encoded into.
+     * @return Response bytes, sent before updates that have not started
+     */
+    std::vector<std::uint8_t>& responses();
+
+    /**
+     * @brief Queues an update frame unless the queued updates would exceed a backlog.
+     * @param frame Update frame
+     * @param backlog Largest total size of queued updates
+     * @return False if the frame was not queued because the backlog is full
+     */
+    bool pushUpdate(const SharedFrame& frame, std::size_t backlog);
+
+    /**
+     * @brief Describes the pending bytes in send order.
+     *
+     * A partly sent update comes first, then the responses, then the other updates.
+     *
+     * @param iov Receives up to maxIov buffers
+     * @param maxIov Capacity of iov
+     * @return Number of buffers filled (0 when nothing is pending)
+     */
+    int gather(iovec* iov, int maxIov) const;
+
+    /**
+     * @brief Drops bytes sent from the buffers returned by the last gather().
+     * @param sent Bytes sent
+     */
+    void retire(std::size_t sent);
+
+    /**
+     * @brief Checks whether nothing is waiting to be sent.
+     * @return True without pending responses and updates
+     */
+    bool empty() const;
+
+    /**
+     * @brief Checks whether update frames are queued.
+     * @return True if at least one update is waiting
+     */
+    bool hasUpdates() const;
+
+    /**
+     * @brief Gets the total size of the queued updates, including sent parts of the first one.
+     * @return Queued update bytes
+     */
+    std::size_t updateBytes() const;
+
+private:
+    /**
+     * @brief Drops sent bytes from the front of the update queue.
+     * @param sent Bytes left to retire; reduced by what was retired
+     * @param limit Largest number of updates to retire completely or partly
+     */
+    void retireUpdates(std::size_t& sent, std::size_t limit);
+
+    std::vector<std::uint8_t> m_out;   ///< Encoded responses
+    std::size_t m_outOffset = 0;       ///< Bytes of m_out already sent
+    std::deque<SharedFrame> m_updates; ///< Update frames not yet completely sent
+    std::size_t m_updateOffset = 0;    ///< Bytes of the first update already sent
+    std::size_t m_updateBytes = 0;     ///< Total size of the queued updates
+};
+
+/**
+ * @struct ServerConnection
+ * @brief Buffers and subscriptions of one client connection.
+ */
+struct ServerConnection {
+    std::uint64_t id = 0;                      ///< Server-wide connection id
+    std::vector<std::uint8_t> in;              ///< Received bytes not yet decoded
+    OutputQueue output;                        ///< Responses and updates not yet sent
+    std::vector<std::uint32_t> subscriptions;  ///< Sessions this connection watches
+    bool waitingWritable = false;              ///< Whether EPOLLOUT is armed
+};
+
+/**
+ * @class ConnectionTable
+ * @brief Connections of one worker, indexed by socket.
+ *
+ * A socket number is reused as soon as its connection is closed, so frames
+ * addressed to a connection carry its id as well; delivery to a socket that
+ * now belongs to a different connection is refused.
+ */
+class ConnectionTable {
+public:
+    /**
+     * @enum DeliveryResult
+     * @brief Outcome of deliver().
+     */
+    enum class DeliveryResult {
+        QUEUED,  ///< The frame was queued
+        GONE,    ///< The connection no longer exists; nothing was queued
+        LAGGING  ///< The connection's update backlog is full; nothing was queued
+    };
+
+    /**
+     * @brief Registers a new connection, replacing any earlier one on the socket.
+     * @param fd Connection socket
+     * @param id Server-wide connection id
+     * @return The new connection
+     */
+    ServerConnection& open(int fd, std::uint64_t id);
+
+    /**
+     * @brief Forgets a connection.
+     * @param fd Connection socket
+     */
+    void close(int fd);
+
+    /**
+     * @brief Looks up the connection on a socket.
+     * @param fd Connection socket
+     * @return Connection, or null if there is none
+     */
+    ServerConnection* find(int fd);
+
+    /**
+     * @brief Looks up a connection by socket and id.
+     * @param fd Connection socket
+     * @param id Connection id the caller expects
+     * @return Connection, or null if the socket is closed or belongs to another connection
+     */
+    ServerConnection* find(int fd, std::uint64_t id);
+
+    /**
+     * @brief Queues an update frame for a connection.
+     * @param fd Connection socket
+     * @param id Connection id the frame is meant for
+     * @param frame Update frame
+     * @param backlog Largest total size of queued updates per connection
+     * @param wasIdle Set to true if the connection had nothing queued and no flush pending
+     * @return DeliveryResult
+     */
+    DeliveryResult deliver(int fd, std::uint64_t id, const SharedFrame& frame, std::size_t backlog, bool& wasIdle);
+
+    /**
+     * @brief Gets the sockets of all connections.
+     * @return Open connection sockets
+     */
+    std::vector<int> sockets() const;
+
+private:
+    std::unordered_map<int, ServerConnection> m_connections;  ///< Connections by socket
+};
@@ -0,0 +1,118 @@
+/**
+ * @file SessionJournal.hpp
+ * @brief Defines crash recovery of server sessions from a journal and snapshots.
+ *
+ * Files, all starting with the configured prefix:
+ *   <prefix>.<LSN>.log   journal segments (see GameJournal.hpp)
+ *   <prefix>.snapshot    "BGJS" [u32 version][u64 boundary LSN][u32 count],
+ *                        then per session [u32 id][u64 last LSN]
+ *                        [STATE_SIZE state][u8 dice rolled][u32 moves]
+ *                        [moves as (player, from, to)]
+ * Integers are little-endian. A snapshot reflects every entry up to its
+ * boundary and, per session, up to the session's last LSN; recovery loads
+ * it and replays only the newer entries.
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "GameJournal.hpp"
+#include "SessionStore.hpp"
+
+/**
+ * @class SessionJournal
+ * @brief Journals every state change of the hosted sessions and restores them after a crash.
+ *
+ * Request handlers call log() while holding the session's shard lock, so the
+ * LSN order of a session's entries is the order in which they were applied.
+ * A background thread writes a snapshot every snapshotInterval entries and
+ * deletes the journal segments it covers.
+ */
+class SessionJournal {
+public:
+    /**
+     * @brief Constructor; nothing is read or written yet.
+     * @param sessions Session store to recover into and snapshot
+     * @param prefix Path prefix of the journal and snapshot files
+     * @param snapshotInterval Journal entries between snapshots (0 disables snapshots)
+     */
+    SessionJournal(SessionStore& sessions, std::string prefix, std::uint64_t snapshotInterval);
+
+    /**
+     * @brief Destructor stopping the snapshot thread and closing the journal.
+     */
+    ~SessionJournal();
+
+    SessionJournal(const SessionJournal&) = delete;
+    SessionJournal& operator=(const SessionJournal&) = delete;
+
+    /**
+     * @brief Restores the sessions from the files and opens the journal for appending.
+     *
+     * Must be called once, before any request is served.
+     *
+     * @param sessionCount Receives the number of restored sessions
+     * @param replayed Receives the number of journal entries replayed
+     * @return False if the files are unreadable or inconsistent, or the journal cannot be created
+     */
+    bool recover(std::size_t& sessionCount, std::size_t& replayed);
+
+    /**
+     * @brief Appends an entry. Thread-safe.
+     * @param session Session id
+     * @param op Operation
+     * @param a First argument
+     * @param b Second argument
+     * @return LSN of the entry
+     */
+    std::uint64_t log(std::uint32_t session, JournalOp op, int a = 0, int b = 0);
+
+    /**
+     * @brief Blocks until an entry is on disk.
+     * @param lsn LSN returned by log()
+     * @return False if the journal failed
+     */
+    bool waitDurable(std::uint64_t lsn);
+
+    /**
+     * @brief Wakes the snapshot thread if snapshotInterval entries were logged since the last snapshot.
+     */
+    void maybeSnapshot();
+
+    /**
+     * @brief Writes a snapshot of all sessions and deletes the journal segments it covers.
+     * @return False if the snapshot could not be written
+     */
+    bool snapshot();
+
+private:
+    /**
+     * @brief Loads the snapshot file into the session store.
+     * @param boundary Receives the snapshot's boundary LSN (0 without a snapshot)
+     * @param sessionCount Receives the number of sessions loaded
+     * @return False if the file exists but is corrupt
+     */
+    bool loadSnapshot(std::uint64_t& boundary, std::size_t& sessionCount);
+
+    /**
+     * @brief Snapshot thread loop.
+     */
+    void runSnapshots();
+
+    SessionStore& m_sessions;                   ///< Journaled sessions
+    std::string m_prefix;                       ///< Path prefix of all files
+    std::uint64_t m_snapshotInterval;           ///< Entries between snapshots
+    GameJournal m_journal;                      ///< Append-only journal
+    std::mutex m_snapshotMutex;                 ///< Serializes snapshot()
+    std::mutex m_wakeMutex;                     ///< Guards the flags below
+    std::condition_variable m_snapshotWake;     ///< Wakes the snapshot thread
+    bool m_snapshotRequested;                   ///< Snapshot thread has work
+    bool m_stop;                                ///< Snapshot thread should exit
+    std::atomic<std::uint64_t> m_snapshotLsn;   ///< Boundary of the last snapshot
+    std::thread m_snapshotter;                  ///< Snapshot thread
+};
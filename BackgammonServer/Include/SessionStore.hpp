@@ -0,0 +1,196 @@
+/**
+ * @file SessionStore.hpp
+ * @brief Defines the sharded store holding all live game sessions of the server.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Game.hpp"
+#include "GamePool.hpp"
+#include "SessionArena.hpp"
+
+/**
+ * @struct MoveRecord
+ * @brief One successful move in a session's history.
+ */
+struct MoveRecord {
+    Color player;       ///< Player who moved
+    std::int8_t from;   ///< Source column
+    std::int8_t to;     ///< Destination column
+};
+
+/**
+ * @struct Subscriber
+ * @brief A connection watching a session.
+ */
+struct Subscriber {
+    unsigned worker;          ///< Index of the worker owning the connection
+    int fd;                   ///< Connection socket
+    std::uint64_t connection; ///< Server-wide connection id, guards against reused descriptors
+};
+
+/**
+ * @struct Session
+ * @brief A single hosted game.
+ *
+ * Sessions are recycled through a GamePool. Move history and the legal-target
+ * scratch list are allocated from the session's arena and released in bulk
+ * by reset().
+ */
+struct Session {
+    /**
+     * @brief Constructor creating an idle session.
+     */
+    Session();
+
+    /**
+     * @brief Returns the session to its idle state and releases its arena.
+     */
+    void reset();
+
+    HeadlessGame game;                     ///< Rules engine for this session (no observers on the server)
+    SessionArena arena;                    ///< Per-session allocations
+    std::pmr::vector<MoveRecord> history;  ///< Successful moves since the session was created
+    std::pmr::vector<int> targets;         ///< Scratch list for legal-target queries
+    std::uint64_t lastLsn = 0;             ///< Journal LSN of the last logged change (0 without a journal)
+    std::vector<Subscriber> spectators;    ///< Connections receiving the session's updates
+};
+
+/**
+ * @class SessionStore
+ * @brief Session map split into independently locked shards.
+ *
+ * Each server worker owns one shard and creates its sessions there. The shard
+ * index is encoded in the low bits of the session id, so lookups go straight
+ * to the owning shard. A worker touching its own sessions only ever takes an
+ * uncontended lock; requests for sessions owned by another worker are still
+ * served, at the cost of a lock on that shard.
+ */
+class SessionStore {
+public:
+    /**
+     * @brief Constructor creating the given number of shards.
+     * @param shardCount Number of shards (at least 1)
+     */
+    explicit SessionStore(unsigned shardCount);
+
+    /**
+     * @brief Gets the number of shards.
+     * @return Shard count
+     */
+    unsigned shardCount() const;
+
+    /**
+     * @brief Creates a new session in a shard.
+     * @param shard Shard that will own the session
+     * @return Id of the new session
+     */
+    std::uint32_t create(unsigned shard);
+
+    /**
+     * @brief Creates a new session in a shard and initializes it under the shard lock.
+     *
+     * No other thread can reach the session before the callable returns,
+     * so e.g. a journal entry logged there precedes any request on it.
+     *
+     * @param shard Shard that will own the session
+     * @param fn Callable taking (std::uint32_t id, Session&)
+     * @return Id of the new session
+     */
+    template <typename Fn>
+    std::uint32_t create(unsigned shard, Fn&& fn) {
+        Shard& s = *m_shards[shard % m_shards.size()];
+        std::lock_guard<std::mutex> lock(s.mutex);
+        const std::uint32_t id = s.nextSequence++ * shardCount() + (shard % shardCount());
+        auto it = s.sessions.emplace(id, s.pool.acquire()).first;
+        fn(id, *it->second);
+        return id;
+    }
+
+    /**
+     * @brief Recreates a session with a known id, e.g. during crash recovery.
+     *
+     * The owning shard will not hand out the id again.
+     *
+     * @param id Session id
+     * @param fn Callable taking Session&, run under the shard lock
+     * @return False if the session already exists
+     */
+    template <typename Fn>
+    bool restore(std::uint32_t id, Fn&& fn) {
+        Shard& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.sessions.count(id) > 0) return false;
+        shard.nextSequence = std::max(shard.nextSequence, id / shardCount() + 1);
+        auto it = shard.sessions.emplace(id, shard.pool.acquire()).first;
+        fn(*it->second);
+        return true;
+    }
+
+    /**
+     * @brief Destroys a session.
+     * @param id Session id
+     * @return True if the session existed
+     */
+    bool destroy(std::uint32_t id);
+
+    /**
+     * @brief Runs a callable on a session while holding its shard lock.
+     * @param id Session id
+     * @param fn Callable taking Session&
+     * @return False if the session does not exist
+     */
+    template <typename Fn>
+    bool withSession(std::uint32_t id, Fn&& fn) {
+        Shard& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(id);
+        if (it == shard.sessions.end()) return false;
+        fn(*it->second);
+        return true;
+    }
+
+    /**
+     * @brief Runs a callable on every session, locking one shard at a time.
+     * @param fn Callable taking (std::uint32_t id, const Session&)
+     */
+    template <typename Fn>
+    void forEachSession(Fn&& fn) const {
+        for (const auto& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            for (const auto& entry : shard->sessions) fn(entry.first, *entry.second);
+        }
+    }
+
+    /**
+     * @brief Gets the total number of live sessions.
+     * @return Session count across all shards
+     */
+    std::size_t size() const;
+
+private:
+    /**
+     * @struct Shard
+     * @brief One independently locked part of the session map.
+     */
+    struct Shard {
+        mutable std::mutex mutex;                                                 ///< Guards this shard
+        GamePool<Session> pool;                                                   ///< Recycled sessions (declared before the map that borrows from it)
+        std::unordered_map<std::uint32_t, GamePool<Session>::Handle> sessions;    ///< Sessions owned by the shard
+        std::uint32_t nextSequence = 1;                                           ///< Next per-shard sequence number
+    };
+
+    /**
+     * @brief Gets the shard owning a session id.
+     * @param id Session id
+     * @return Owning shard
+     */
+    Shard& shardFor(std::uint32_t id);
+
+    std::vector<std::unique_ptr<Shard>> m_shards;  ///< All shards
+};
@@ -0,0 +1,287 @@
+/**
+ * @file ClientMain.cpp
+ * @brief Local client stand-in and load generator for the game server.
+ *
+ * Plays complete games over the binary protocol (always taking the first
+ * legal move) on several connections in parallel and reports per-request
+ * latency percentiles. With --plays each turn is sent as one PLAY request,
+ * chosen locally with MoveGenerator, instead of one MOVE per checker.
+ *
+ * Usage: BackgammonServerClient [--unix PATH | --port PORT | --self-test]
+ *                               [--connections N] [--games N] [--plays]
+ *
+ * With --self-test an in-process server is started on a temporary Unix
+ * socket, which makes the tool usable as a smoke test. The self-test also
+ * plays one game watched by spectator connections and checks that every
+ * spectator follows it to the end.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "Game.hpp"
+#include "GameServer.hpp"
+#include "MoveGenerator.hpp"
+#include "ServerClient.hpp"
+
+namespace {
+    constexpr int MAX_TURNS_PER_GAME = 5000;  ///< Safety limit for a single game
+    constexpr int SELF_TEST_SPECTATORS = 3;   ///< Spectators watching the self-test's checked game
+
+    /**
+     * @brief Sends a request and records its round-trip latency.
+     */
+    Protocol::Status timedCall(ServerClient& client, const Protocol::Request& request,
+                               std::vector<std::uint8_t>& payload, std::vector<double>& latenciesUs) {
+        const auto begin = std::chrono::steady_clock::now();
+        const Protocol::Status status = client.call(request, payload);
+        const auto end = std::chrono::steady_clock::now();
+        latenciesUs.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+        return status;
+    }
+
+    /**
+     * @brief Creates a new session.
+     * @return True if the session was created
+     */
+    bool createSession(ServerClient& client, std::uint32_t& session, std::vector<double>& latenciesUs) {
+        std::vector<std::uint8_t> payload;
+        Protocol::Request req;
+        req.opcode = Protocol::Opcode::CREATE;
+        if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK || payload.size() != 4) return false;
+        session = payload[0] | (payload[1] << 8) | (payload[2] << 16) | (static_cast<std::uint32_t>(payload[3]) << 24);
+        return true;
+    }
+
+    /**
+     * @brief Plays one full game on an existing session and closes it.
+     * @param usePlays Whether to send whole turns with PLAY instead of single moves
+     * @return True if the game finished without protocol errors
+     */
+    bool playSession(ServerClient& client, std::uint32_t session, std::vector<double>& latenciesUs, bool usePlays) {
+        std::vector<std::uint8_t> payload;
+        Protocol::Request req;
+        req.session = session;
+
+        GameStateDTO state;
+        GamePhase phase = GamePhase::NOT_STARTED;
+        auto refresh = [&]() {
+            req.opcode = Protocol::Opcode::STATE;
+            if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK ||
+                payload.size() != Protocol::STATE_SIZE) return false;
+            Protocol::decodeState(payload.data(), state, phase);
+            return true;
+        };
+
+        // Opening rolls, repeated on ties
+        do {
+            req.opcode = Protocol::Opcode::START;
+            if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK) return false;
+            req.opcode = Protocol::Opcode::ROLL_OPENING;
+            timedCall(client, req, payload, latenciesUs);
+            timedCall(client, req, payload, latenciesUs);
+            if (!refresh()) return false;
+        } while (state.openingDiceWhite == state.openingDiceBlack);
+
+        req.opcode = Protocol::Opcode::START_AFTER_OPENING;
+        if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK) return false;
+
+        for (int turn = 0; turn < MAX_TURNS_PER_GAME; ++turn) {
+            req.opcode = Protocol::Opcode::ROLL;
+            if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK) return false;
+            const Color mover = state.currentPlayer;
+
+            if (usePlays) {
+                if (!refresh()) return false;
+                HeadlessGame local;
+                local.loadState(state, phase);
+                const std::vector<GeneratedPlay> plays = MoveGenerator::generatePlays(local);
+                req.opcode = Protocol::Opcode::PLAY;
+                req.play = plays.empty() ? Play() : plays.front().play;
+                if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK || payload.size() != 1 ||
+                    payload[0] != static_cast<std::uint8_t>(MoveResult::SUCCESS)) return false;
+                if (!refresh()) return false;
+                if (phase == GamePhase::FINISHED) {
+                    req.opcode = Protocol::Opcode::CLOSE;
+                    return timedCall(client, req, payload, latenciesUs) == Protocol::Status::OK;
+                }
+                continue;
+            }
+
+            for (;;) {
+                if (!refresh()) return false;
+                if (phase == GamePhase::FINISHED) {
+                    req.opcode = Protocol::Opcode::CLOSE;
+                    return timedCall(client, req, payload, latenciesUs) == Protocol::Status::OK;
+                }
+                if (state.currentPlayer != mover || (state.dice1 == 0 && state.dice2 == 0)) break;
+
+                bool moved = false;
+                for (int from = 0; from <= Game::BAR_INDEX && !moved; ++from) {
+                    req.opcode = Protocol::Opcode::LEGAL_TARGETS;
+                    req.arg0 = static_cast<std::int8_t>(from);
+                    if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK || payload.empty()) return false;
+                    if (payload[0] == 0) continue;
+
+                    req.opcode = Protocol::Opcode::MOVE;
+                    req.arg1 = static_cast<std::int8_t>(payload[1]);
+                    if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK) return false;
+                    moved = payload.size() == 1 && payload[0] == static_cast<std::uint8_t>(MoveResult::SUCCESS);
+                }
+
+                if (!moved) {
+                    req.opcode = Protocol::Opcode::PASS;
+                    if (timedCall(client, req, payload, latenciesUs) != Protocol::Status::OK) return false;
+                    if (!refresh()) return false;
+                    break;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Plays one full game on a new session.
+     * @return True if the game finished without protocol errors
+     */
+    bool playGame(ServerClient& client, std::vector<double>& latenciesUs, bool usePlays) {
+        std::uint32_t session = 0;
+        return createSession(client, session, latenciesUs) && playSession(client, session, latenciesUs, usePlays);
+    }
+
+    /**
+     * @brief Plays one game watched by spectator connections.
+     * @return True if every spectator received updates up to the finished game
+     */
+    bool watchedGame(const std::string& unixPath, std::uint16_t port, bool usePlays) {
+        auto connect = [&](ServerClient& client) {
+            return unixPath.empty() ? client.connectTcp(port) : client.connectUnix(unixPath);
+        };
+        ServerClient player;
+        std::vector<double> latencies;
+        std::uint32_t session = 0;
+        if (!connect(player) || !createSession(player, session, latencies)) return false;
+
+        std::vector<std::unique_ptr<ServerClient>> spectators;
+        std::vector<std::uint8_t> payload;
+        Protocol::Request req;
+        req.opcode = Protocol::Opcode::SUBSCRIBE;
+        req.session = session;
+        for (int i = 0; i < SELF_TEST_SPECTATORS; ++i) {
+            spectators.push_back(std::make_unique<ServerClient>());
+            if (!connect(*spectators.back()) || spectators.back()->call(req, payload) != Protocol::Status::OK ||
+                payload.size() != Protocol::STATE_SIZE) return false;
+        }
+
+        if (!playSession(player, session, latencies, usePlays)) return false;
+
+        for (auto& spectator : spectators) {
+            std::uint32_t updated = 0;
+            GameStateDTO state;
+            GamePhase phase = GamePhase::NOT_STARTED;
+            do {
+                if (!spectator->nextUpdate(updated, state, phase) || updated != session) return false;
+            } while (phase != GamePhase::FINISHED);
+        }
+        return true;
+    }
+
+    double percentile(std::vector<double>& values, double p) {
+        if (values.empty()) return 0.0;
+        const std::size_t idx = static_cast<std::size_t>(p * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(idx), values.end());
+        return values[idx];
+    }
+}
+
+/**
+ * @brief Main entry point of the client.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return 0 if every game completed, 1 otherwise
+ */
+int main(int argc, char* argv[]) {
+    std::string unixPath;
+    std::uint16_t port = 7500;
+    bool selfTest = false;
+    bool usePlays = false;
+    int connections = 4;
+    int gamesPerConnection = 25;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--unix" && i + 1 < argc) unixPath = argv[++i];
+        else if (arg == "--port" && i + 1 < argc) port = static_cast<std::uint16_t>(std::atoi(argv[++i]));
+        else if (arg == "--connections" && i + 1 < argc) connections = std::atoi(argv[++i]);
+        else if (arg == "--games" && i + 1 < argc) gamesPerConnection = std::atoi(argv[++i]);
+        else if (arg == "--self-test") selfTest = true;
+        else if (arg == "--plays") usePlays = true;
+        else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--unix PATH | --port PORT | --self-test] [--connections N] [--games N] [--plays]\n";
+            return 2;
+        }
+    }
+
+    std::unique_ptr<GameServer> server;
+    if (selfTest) {
+        unixPath = "/tmp/backgammon-selftest-" + std::to_string(::getpid()) + ".sock";
+        ServerConfig config;
+        config.unixSocketPath = unixPath;
+        config.workerCount = 2;
+        server = std::make_unique<GameServer>(config);
+        if (!server->start()) {
+            std::cerr << "Could not start in-process server\n";
+            return 1;
+        }
+    }
+
+    std::mutex resultsMutex;
+    std::vector<double> allLatencies;
+    std::atomic<int> failures{ 0 };
+    std::atomic<int> finished{ 0 };
+
+    const auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int c = 0; c < connections; ++c) {
+        threads.emplace_back([&]() {
+            ServerClient client;
+            const bool connected = unixPath.empty() ? client.connectTcp(port) : client.connectUnix(unixPath);
+            if (!connected) {
+                failures += gamesPerConnection;
+                return;
+            }
+            std::vector<double> latencies;
+            for (int g = 0; g < gamesPerConnection; ++g) {
+                if (playGame(client, latencies, usePlays)) ++finished;
+                else ++failures;
+            }
+            std::lock_guard<std::mutex> lock(resultsMutex);
+            allLatencies.insert(allLatencies.end(), latencies.begin(), latencies.end());
+        });
+    }
+    for (auto& t : threads) t.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    if (selfTest && !watchedGame(unixPath, port, usePlays)) {
+        std::cerr << "Spectators did not follow the watched game\n";
+        ++failures;
+    }
+
+    const std::size_t requests = allLatencies.size();
+    std::cout << "games finished: " << finished << ", failed: " << failures << "\n"
+              << "requests: " << requests << " in " << seconds << " s\n"
+              << "latency us p50: " << percentile(allLatencies, 0.50)
+              << " p99: " << percentile(allLatencies, 0.99)
+              << " max: " << percentile(allLatencies, 1.0) << "\n";
+
+    if (server) server->stop();
+    return failures == 0 ? 0 : 1;
+}
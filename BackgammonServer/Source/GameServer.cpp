@@ -0,0 +1,583 @@
+/**
+ * @file GameServer.cpp
+ * @brief Implementation of the epoll-based game server.
+ *
+ * All sockets are non-blocking and edge-triggered. Input is accumulated per
+ * connection until complete frames are available; responses are appended to a
+ * per-connection output buffer and flushed immediately, falling back to
+ * EPOLLOUT only when the socket buffer is full. Update frames for spectators
+ * are queued by reference behind the responses and gathered into the same
+ * sendmsg() call.
+ */
+
+#include "GameServer.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <mutex>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    constexpr int MAX_EVENTS = 256;           ///< Events fetched per epoll_wait call
+    constexpr std::size_t READ_CHUNK = 65536; ///< Bytes read per recv call
+    constexpr int LISTEN_BACKLOG = 1024;      ///< Pending connection backlog
+    constexpr int MAX_IOV = 64;               ///< Buffers gathered per sendmsg call
+
+    unsigned resolveWorkerCount(const ServerConfig& config) {
+        if (config.workerCount > 0) return config.workerCount;
+        unsigned n = std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+}
+
+namespace {
+    /**
+     * @struct PendingUpdate
+     * @brief An update frame together with the subscribers it goes to.
+     */
+    struct PendingUpdate {
+        SharedFrame frame;                    ///< Encoded update
+        std::vector<Subscriber> subscribers;  ///< Copy of the session's spectators
+    };
+
+    /**
+     * @struct Delivery
+     * @brief An update frame handed to the worker owning the subscriber's connection.
+     */
+    struct Delivery {
+        int fd;                    ///< Connection socket
+        std::uint64_t connection;  ///< Connection id
+        SharedFrame frame;         ///< Encoded update
+    };
+}
+
+/**
+ * @struct GameServer::Worker
+ * @brief State owned by one worker thread.
+ */
+struct GameServer::Worker {
+    unsigned index = 0;                                ///< Worker index, also its shard
+    int epollFd = -1;                                  ///< Worker epoll instance
+    int wakeFd = -1;                                   ///< eventfd signalling inbox deliveries and stop
+    std::atomic<bool> stopping{ false };               ///< Set before wakeFd is signalled to stop
+    ConnectionTable connections;                       ///< Connections served by this worker
+    std::vector<PendingUpdate> updates;                ///< Updates produced by the current batch of requests
+    std::vector<std::vector<Delivery>> outgoing;       ///< Scratch: deliveries per target worker
+    std::mutex inboxMutex;                             ///< Guards inbox
+    std::vector<Delivery> inbox;                       ///< Deliveries from other workers
+};
+
+GameServer::GameServer(ServerConfig config)
+    : m_config(std::move(config)), m_sessions(resolveWorkerCount(m_config)), m_listenFd(-1), m_nextConnection(1) {
+}
+
+GameServer::~GameServer() {
+    stop();
+}
+
+SessionStore& GameServer::sessions() {
+    return m_sessions;
+}
+
+bool GameServer::openListener() {
+    if (!m_config.unixSocketPath.empty()) {
+        sockaddr_un addr{};
+        if (m_config.unixSocketPath.size() >= sizeof(addr.sun_path)) return false;
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, m_config.unixSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+        m_listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (m_listenFd < 0) return false;
+        ::unlink(m_config.unixSocketPath.c_str());
+        if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) return false;
+    }
+    else {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(m_config.tcpPort);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        m_listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (m_listenFd < 0) return false;
+        int one = 1;
+        ::setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) return false;
+    }
+    return ::listen(m_listenFd, LISTEN_BACKLOG) == 0;
+}
+
+bool GameServer::recover(std::size_t& sessionCount, std::size_t& replayed) {
+    sessionCount = 0;
+    replayed = 0;
+    if (m_config.journalPath.empty()) return true;
+    if (m_journal || m_listenFd >= 0) return false;
+
+    m_journal = std::make_unique<SessionJournal>(m_sessions, m_config.journalPath, m_config.snapshotInterval);
+    if (!m_journal->recover(sessionCount, replayed)) {
+        m_journal.reset();
+        return false;
+    }
+    return true;
+}
+
+bool GameServer::start() {
+    if (m_listenFd >= 0) return true;
+    if (!m_config.journalPath.empty() && !m_journal) return false;
+
+    if (!openListener()) {
+        if (m_listenFd >= 0) ::close(m_listenFd);
+        m_listenFd = -1;
+        return false;
+    }
+
+    for (unsigned i = 0; i < m_sessions.shardCount(); ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->index = i;
+        worker->epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        worker->wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        worker->outgoing.resize(m_sessions.shardCount());
+
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+        ev.data.fd = m_listenFd;
+        ::epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, m_listenFd, &ev);
+
+        ev.events = EPOLLIN;
+        ev.data.fd = worker->wakeFd;
+        ::epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, worker->wakeFd, &ev);
+
+        m_workers.push_back(std::move(worker));
+    }
+
+    for (auto& worker : m_workers) {
+        Worker* w = worker.get();
+        m_threads.emplace_back([this, w]() { runWorker(*w); });
+    }
+    return true;
+}
+
+void GameServer::stop() {
+    if (m_listenFd < 0) return;
+
+    for (auto& worker : m_workers) {
+        worker->stopping = true;
+        std::uint64_t one = 1;
+        ssize_t ignored = ::write(worker->wakeFd, &one, sizeof(one));
+        (void)ignored;
+    }
+    for (auto& t : m_threads) t.join();
+    m_threads.clear();
+
+    for (auto& worker : m_workers) {
+        for (int fd : worker->connections.sockets()) ::close(fd);
+        ::close(worker->wakeFd);
+        ::close(worker->epollFd);
+    }
+    m_workers.clear();
+
+    ::close(m_listenFd);
+    m_listenFd = -1;
+    if (!m_config.unixSocketPath.empty()) ::unlink(m_config.unixSocketPath.c_str());
+}
+
+void GameServer::runWorker(Worker& worker) {
+    epoll_event events[MAX_EVENTS];
+
+    for (;;) {
+        int n = ::epoll_wait(worker.epollFd, events, MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            const int fd = events[i].data.fd;
+
+            if (fd == worker.wakeFd) {
+                std::uint64_t count = 0;
+                ssize_t ignored = ::read(worker.wakeFd, &count, sizeof(count));
+                (void)ignored;
+                if (worker.stopping) return;
+                drainInbox(worker);
+                continue;
+            }
+
+            if (fd == m_listenFd) {
+                acceptConnections(worker);
+                continue;
+            }
+
+            bool keep = true;
+            if (events[i].events & (EPOLLHUP | EPOLLERR)) keep = false;
+            if (keep && (events[i].events & EPOLLIN)) keep = handleReadable(worker, fd);
+            if (keep && (events[i].events & EPOLLOUT)) keep = handleWritable(worker, fd);
+            if (!keep) closeConnection(worker, fd);
+        }
+    }
+}
+
+void GameServer::acceptConnections(Worker& worker) {
+    for (;;) {
+        int fd = ::accept4(m_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;
+
+        if (m_config.unixSocketPath.empty()) {
+            int one = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+        ev.data.fd = fd;
+        if (::epoll_ctl(worker.epollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            ::close(fd);
+            continue;
+        }
+        worker.connections.open(fd, m_nextConnection.fetch_add(1, std::memory_order_relaxed));
+    }
+}
+
+bool GameServer::handleReadable(Worker& worker, int fd) {
+    ServerConnection* found = worker.connections.find(fd);
+    if (!found) return false;
+    ServerConnection& conn = *found;
+
+    std::uint8_t chunk[READ_CHUNK];
+    bool peerClosed = false;
+    for (;;) {
+        ssize_t r = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (r > 0) {
+            conn.in.insert(conn.in.end(), chunk, chunk + r);
+            continue;
+        }
+        if (r == 0) {
+            peerClosed = true;
+            break;
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        return false;
+    }
+
+    std::size_t offset = 0;
+    std::uint64_t lsn = 0;
+    for (;;) {
+        Protocol::Request request;
+        std::size_t consumed = 0;
+        Protocol::DecodeResult r = Protocol::decodeRequest(conn.in.data() + offset, conn.in.size() - offset, request, consumed);
+        if (r == Protocol::DecodeResult::MALFORMED) return false;
+        if (r == Protocol::DecodeResult::INCOMPLETE) break;
+        handleRequest(worker, fd, conn, request, lsn);
+        offset += consumed;
+    }
+    conn.in.erase(conn.in.begin(), conn.in.begin() + static_cast<std::ptrdiff_t>(offset));
+
+    // One wait covers the whole batch; concurrent workers share the fsync
+    if (lsn > 0) {
+        if (!m_journal->waitDurable(lsn)) return false;
+        m_journal->maybeSnapshot();
+    }
+    // Spectators see a change only once it is as durable as its acknowledgement
+    if (!worker.updates.empty()) publishUpdates(worker);
+
+    // Looked up again: publishing may have dropped this connection as a lagging spectator
+    if (!handleWritable(worker, fd)) return false;
+    return !peerClosed;
+}
+
+bool GameServer::handleWritable(Worker& worker, int fd) {
+    ServerConnection* found = worker.connections.find(fd);
+    if (!found) return false;
+    ServerConnection& conn = *found;
+
+    for (;;) {
+        iovec iov[MAX_IOV];
+        const int count = conn.output.gather(iov, MAX_IOV);
+        if (count == 0) break;
+
+        msghdr msg{};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = static_cast<std::size_t>(count);
+        ssize_t w = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+        if (w < 0 && errno == EINTR) continue;
+        if (w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (w <= 0) return false;
+        conn.output.retire(static_cast<std::size_t>(w));
+    }
+
+    const bool pending = !conn.output.empty();
+
+    if (pending != conn.waitingWritable) {
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET | (pending ? EPOLLOUT : 0u);
+        ev.data.fd = fd;
+        ::epoll_ctl(worker.epollFd, EPOLL_CTL_MOD, fd, &ev);
+        conn.waitingWritable = pending;
+    }
+    return true;
+}
+
+void GameServer::closeConnection(Worker& worker, int fd) {
+    ServerConnection* conn = worker.connections.find(fd);
+    if (!conn) return;
+
+    const std::uint64_t id = conn->id;
+    for (std::uint32_t session : conn->subscriptions) {
+        m_sessions.withSession(session, [id](Session& watched) {
+            auto& spectators = watched.spectators;
+            spectators.erase(std::remove_if(spectators.begin(), spectators.end(),
+                                            [id](const Subscriber& s) { return s.connection == id; }),
+                             spectators.end());
+        });
+    }
+
+    ::epoll_ctl(worker.epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    worker.connections.close(fd);
+}
+
+void GameServer::publishUpdates(Worker& worker) {
+    std::vector<int> touched;
+    for (PendingUpdate& update : worker.updates) {
+        for (const Subscriber& subscriber : update.subscribers) {
+            if (subscriber.worker == worker.index) {
+                deliverUpdate(worker, subscriber.fd, subscriber.connection, update.frame, touched);
+            }
+            else if (subscriber.worker < worker.outgoing.size()) {
+                worker.outgoing[subscriber.worker].push_back(Delivery{ subscriber.fd, subscriber.connection, update.frame });
+            }
+        }
+    }
+    worker.updates.clear();
+
+    for (std::size_t target = 0; target < worker.outgoing.size(); ++target) {
+        std::vector<Delivery>& deliveries = worker.outgoing[target];
+        if (deliveries.empty()) continue;
+        Worker& receiver = *m_workers[target];
+        bool wake = false;
+        {
+            std::lock_guard<std::mutex> lock(receiver.inboxMutex);
+            // A non-empty inbox has already been signalled and not drained yet
+            wake = receiver.inbox.empty();
+            receiver.inbox.insert(receiver.inbox.end(), std::make_move_iterator(deliveries.begin()),
+                                  std::make_move_iterator(deliveries.end()));
+        }
+        deliveries.clear();
+        if (wake) {
+            std::uint64_t one = 1;
+            ssize_t ignored = ::write(receiver.wakeFd, &one, sizeof(one));
+            (void)ignored;
+        }
+    }
+    flushTouched(worker, touched);
+}
+
+void GameServer::drainInbox(Worker& worker) {
+    std::vector<Delivery> deliveries;
+    {
+        std::lock_guard<std::mutex> lock(worker.inboxMutex);
+        deliveries.swap(worker.inbox);
+    }
+    std::vector<int> touched;
+    for (const Delivery& delivery : deliveries) {
+        deliverUpdate(worker, delivery.fd, delivery.connection, delivery.frame, touched);
+    }
+    flushTouched(worker, touched);
+}
+
+void GameServer::deliverUpdate(Worker& worker, int fd, std::uint64_t connection, const SharedFrame& frame,
+                               std::vector<int>& touched) {
+    bool wasIdle = false;
+    switch (worker.connections.deliver(fd, connection, frame, m_config.spectatorBacklog, wasIdle)) {
+    case ConnectionTable::DeliveryResult::QUEUED:
+        if (wasIdle) touched.push_back(fd);
+        break;
+    case ConnectionTable::DeliveryResult::LAGGING:
+        closeConnection(worker, fd);
+        break;
+    case ConnectionTable::DeliveryResult::GONE:
+        break;
+    }
+}
+
+void GameServer::flushTouched(Worker& worker, std::vector<int>& touched) {
+    for (int fd : touched) {
+        if (!worker.connections.find(fd)) continue;
+        if (!handleWritable(worker, fd)) closeConnection(worker, fd);
+    }
+    touched.clear();
+}
+
+void GameServer::handleRequest(Worker& worker, int fd, ServerConnection& conn, const Protocol::Request& request, std::uint64_t& lsn) {
+    using Protocol::Opcode;
+    using Protocol::Status;
+
+    std::vector<std::uint8_t>& out = conn.output.responses();
+    const unsigned shard = worker.index;
+    bool changed = false;
+
+    // Logged while the session's shard lock is held, so entries of a session
+    // are in the order they were applied; also marks the request as a change
+    auto journal = [&](Session* session, std::uint32_t id, JournalOp op, int a, int b) {
+        changed = true;
+        if (!m_journal) return;
+        const std::uint64_t entry = m_journal->log(id, op, a, b);
+        if (session) session->lastLsn = entry;
+        // A rejected entry (0) must fail the batch; no LSN is ever durable past the maximum
+        lsn = entry == 0 ? std::numeric_limits<std::uint64_t>::max() : std::max(lsn, entry);
+    };
+
+    if (request.opcode == Opcode::CREATE) {
+        const std::uint32_t id = m_sessions.create(shard, [&](std::uint32_t created, Session& session) {
+            journal(&session, created, JournalOp::CREATE, 0, 0);
+        });
+        const std::uint8_t payload[4] = {
+            static_cast<std::uint8_t>(id & 0xFF), static_cast<std::uint8_t>((id >> 8) & 0xFF),
+            static_cast<std::uint8_t>((id >> 16) & 0xFF), static_cast<std::uint8_t>((id >> 24) & 0xFF)
+        };
+        Protocol::encodeResponse(Status::OK, payload, sizeof(payload), out);
+        return;
+    }
+
+    if (request.opcode == Opcode::CLOSE) {
+        const bool existed = m_sessions.destroy(request.session);
+        if (existed) journal(nullptr, request.session, JournalOp::CLOSE, 0, 0);
+        Protocol::encodeResponse(existed ? Status::OK : Status::UNKNOWN_SESSION, nullptr, 0, out);
+        return;
+    }
+
+    std::uint8_t payload[Protocol::STATE_SIZE];
+    std::size_t payloadSize = 0;
+    Status status = Status::OK;
+
+    const bool found = m_sessions.withSession(request.session, [&](Session& session) {
+        HeadlessGame& game = session.game;
+        switch (request.opcode) {
+        case Opcode::START:
+            game.start();
+            session.history.clear();
+            journal(&session, request.session, JournalOp::START, 0, 0);
+            break;
+        case Opcode::ROLL_OPENING: {
+            const GamePhase before = game.getPhase();
+            game.rollOpeningDice();
+            if (before == GamePhase::OPENING_ROLL_WHITE) {
+                journal(&session, request.session, JournalOp::OPENING_ROLL, game.getOpeningDiceWhite(), 0);
+            }
+            else if (before == GamePhase::OPENING_ROLL_BLACK) {
+                journal(&session, request.session, JournalOp::OPENING_ROLL, game.getOpeningDiceBlack(), 0);
+            }
+            break;
+        }
+        case Opcode::START_AFTER_OPENING: {
+            // Ignored outside the opening comparison; not a change to log or broadcast
+            const GamePhase before = game.getPhase();
+            game.startGameAfterOpening();
+            if (game.getPhase() != before) journal(&session, request.session, JournalOp::START_AFTER_OPENING, 0, 0);
+            break;
+        }
+        case Opcode::ROLL: {
+            const bool rolls = game.getPhase() == GamePhase::IN_PROGRESS;
+            game.rollDice();
+            const auto dice = game.getDice();
+            if (rolls) journal(&session, request.session, JournalOp::ROLL, dice[0], dice[1]);
+            payload[0] = static_cast<std::uint8_t>(dice[0]);
+            payload[1] = static_cast<std::uint8_t>(dice[1]);
+            payloadSize = 2;
+            break;
+        }
+        case Opcode::MOVE: {
+            const Color player = game.getCurrentPlayer();
+            const MoveResult result = game.makeMove(request.arg0, request.arg1);
+            if (result == MoveResult::SUCCESS) {
+                session.history.push_back(MoveRecord{ player, request.arg0, request.arg1 });
+                journal(&session, request.session, JournalOp::MOVE, request.arg0, request.arg1);
+            }
+            payload[0] = static_cast<std::uint8_t>(result);
+            payloadSize = 1;
+            break;
+        }
+        case Opcode::PLAY: {
+            const Color player = game.getCurrentPlayer();
+            const MoveResult result = game.makePlay(request.play);
+            if (result == MoveResult::SUCCESS) {
+                // Journaled as the single moves (or a pass), which replay to the same turn
+                for (int i = 0; i < request.play.count; ++i) {
+                    const CheckerMove& move = request.play.moves[i];
+                    session.history.push_back(MoveRecord{ player, move.fromIndex, move.toIndex });
+                    journal(&session, request.session, JournalOp::MOVE, move.fromIndex, move.toIndex);
+                }
+                if (request.play.count == 0) journal(&session, request.session, JournalOp::PASS, 0, 0);
+            }
+            payload[0] = static_cast<std::uint8_t>(result);
+            payloadSize = 1;
+            break;
+        }
+        case Opcode::PASS: {
+            const Color player = game.getCurrentPlayer();
+            game.passTurn();
+            if (game.getCurrentPlayer() != player) journal(&session, request.session, JournalOp::PASS, 0, 0);
+            break;
+        }
+        case Opcode::STATE:
+            Protocol::encodeState(game.getState(), game.getPhase(), payload);
+            payloadSize = Protocol::STATE_SIZE;
+            break;
+        case Opcode::SUBSCRIBE: {
+            auto& spectators = session.spectators;
+            const bool already = std::any_of(spectators.begin(), spectators.end(),
+                                             [&](const Subscriber& s) { return s.connection == conn.id; });
+            if (!already) {
+                spectators.push_back(Subscriber{ worker.index, fd, conn.id });
+                conn.subscriptions.push_back(request.session);
+            }
+            Protocol::encodeState(game.getState(), game.getPhase(), payload);
+            payloadSize = Protocol::STATE_SIZE;
+            break;
+        }
+        case Opcode::UNSUBSCRIBE: {
+            auto& spectators = session.spectators;
+            spectators.erase(std::remove_if(spectators.begin(), spectators.end(),
+                                            [&](const Subscriber& s) { return s.connection == conn.id; }),
+                             spectators.end());
+            auto& subscriptions = conn.subscriptions;
+            subscriptions.erase(std::remove(subscriptions.begin(), subscriptions.end(), request.session), subscriptions.end());
+            break;
+        }
+        case Opcode::LEGAL_TARGETS: {
+            std::pmr::vector<int>& targets = session.targets;
+            game.getLegalTargets(request.arg0, targets);
+            payload[0] = static_cast<std::uint8_t>(targets.size());
+            for (std::size_t i = 0; i < targets.size() && i + 1 < sizeof(payload); ++i) {
+                payload[i + 1] = static_cast<std::uint8_t>(static_cast<std::int8_t>(targets[i]));
+            }
+            payloadSize = 1 + targets.size();
+            break;
+        }
+        default:
+            status = Status::BAD_REQUEST;
+            break;
+        }
+
+        // Encoded once here; every subscriber is sent the same bytes
+        if (changed && !session.spectators.empty()) {
+            auto frame = std::make_shared<std::vector<std::uint8_t>>();
+            frame->reserve(Protocol::LENGTH_PREFIX_SIZE + Protocol::UPDATE_BODY_SIZE);
+            Protocol::encodeUpdate(request.session, game.getState(), game.getPhase(), *frame);
+            worker.updates.push_back(PendingUpdate{ std::move(frame), session.spectators });
+        }
+    });
+
+    if (!found) status = Status::UNKNOWN_SESSION;
+    Protocol::encodeResponse(status, payload, status == Status::OK ? payloadSize : 0, out);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file Protocol.cpp
+ * @brief Implementation of the binary server protocol encoders and decoders.
+ */
+
+#include "Protocol.hpp"
+
+#include <algorithm>
+
+namespace Protocol {
+
+namespace {
+    void appendLength(std::size_t length, std::vector<std::uint8_t>& out) {
+        out.push_back(static_cast<std::uint8_t>(length & 0xFF));
+        out.push_back(static_cast<std::uint8_t>((length >> 8) & 0xFF));
+    }
+
+    std::size_t readLength(const std::uint8_t* data) {
+        return static_cast<std::size_t>(data[0]) | (static_cast<std::size_t>(data[1]) << 8);
+    }
+
+    /// Reads the frame header; returns INCOMPLETE or MALFORMED, or COMPLETE with bodySize set
+    DecodeResult readFrame(const std::uint8_t* data, std::size_t size, std::size_t& bodySize) {
+        if (size < LENGTH_PREFIX_SIZE) return DecodeResult::INCOMPLETE;
+        bodySize = readLength(data);
+        if (bodySize == 0 || bodySize > MAX_BODY_SIZE) return DecodeResult::MALFORMED;
+        if (size < LENGTH_PREFIX_SIZE + bodySize) return DecodeResult::INCOMPLETE;
+        return DecodeResult::COMPLETE;
+    }
+}
+
+void encodeRequest(const Request& request, std::vector<std::uint8_t>& out) {
+    const bool isPlay = request.opcode == Opcode::PLAY;
+    const int moves = isPlay ? std::min<int>(request.play.count, Play::MAX_MOVES) : 0;
+    appendLength(REQUEST_BODY_SIZE + 2 * static_cast<std::size_t>(moves), out);
+    out.push_back(static_cast<std::uint8_t>(request.opcode));
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<std::uint8_t>((request.session >> shift) & 0xFF));
+    }
+    out.push_back(static_cast<std::uint8_t>(isPlay ? moves : request.arg0));
+    out.push_back(static_cast<std::uint8_t>(request.arg1));
+    for (int i = 0; i < moves; ++i) {
+        out.push_back(static_cast<std::uint8_t>(request.play.moves[i].fromIndex));
+        out.push_back(static_cast<std::uint8_t>(request.play.moves[i].toIndex));
+    }
+}
+
+DecodeResult decodeRequest(const std::uint8_t* data, std::size_t size, Request& out, std::size_t& consumed) {
+    std::size_t bodySize = 0;
+    DecodeResult r = readFrame(data, size, bodySize);
+    if (r != DecodeResult::COMPLETE) return r;
+    if (bodySize < REQUEST_BODY_SIZE) return DecodeResult::MALFORMED;
+
+    const std::uint8_t* body = data + LENGTH_PREFIX_SIZE;
+    out.opcode = static_cast<Opcode>(body[0]);
+    out.session = static_cast<std::uint32_t>(body[1]) | (static_cast<std::uint32_t>(body[2]) << 8) |
+                  (static_cast<std::uint32_t>(body[3]) << 16) | (static_cast<std::uint32_t>(body[4]) << 24);
+    out.arg0 = static_cast<std::int8_t>(body[5]);
+    out.arg1 = static_cast<std::int8_t>(body[6]);
+    out.play = Play();
+    if (out.opcode == Opcode::PLAY) {
+        if (out.arg0 < 0 || out.arg0 > Play::MAX_MOVES) return DecodeResult::MALFORMED;
+        if (bodySize < REQUEST_BODY_SIZE + 2 * static_cast<std::size_t>(out.arg0)) return DecodeResult::MALFORMED;
+        for (int i = 0; i < out.arg0; ++i) {
+            out.play.push(static_cast<std::int8_t>(body[REQUEST_BODY_SIZE + 2 * i]),
+                          static_cast<std::int8_t>(body[REQUEST_BODY_SIZE + 2 * i + 1]));
+        }
+    }
+    consumed = LENGTH_PREFIX_SIZE + bodySize;
+    return DecodeResult::COMPLETE;
+}
+
+void encodeResponse(Status status, const std::uint8_t* payload, std::size_t size, std::vector<std::uint8_t>& out) {
+    appendLength(size + 1, out);
+    out.push_back(static_cast<std::uint8_t>(status));
+    if (size > 0) out.insert(out.end(), payload, payload + size);
+}
+
+void encodeUpdate(std::uint32_t session, const GameStateDTO& state, GamePhase phase, std::vector<std::uint8_t>& out) {
+    appendLength(UPDATE_BODY_SIZE, out);
+    out.push_back(static_cast<std::uint8_t>(Status::UPDATE));
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<std::uint8_t>((session >> shift) & 0xFF));
+    }
+    const std::size_t stateOffset = out.size();
+    out.resize(stateOffset + STATE_SIZE);
+    encodeState(state, phase, out.data() + stateOffset);
+}
+
+DecodeResult decodeResponse(const std::uint8_t* data, std::size_t size, Status& status,
+                            const std::uint8_t*& payload, std::size_t& payloadSize, std::size_t& consumed) {
+    std::size_t bodySize = 0;
+    DecodeResult r = readFrame(data, size, bodySize);
+    if (r != DecodeResult::COMPLETE) return r;
+
+    status = static_cast<Status>(data[LENGTH_PREFIX_SIZE]);
+    payload = data + LENGTH_PREFIX_SIZE + 1;
+    payloadSize = bodySize - 1;
+    consumed = LENGTH_PREFIX_SIZE + bodySize;
+    return DecodeResult::COMPLETE;
+}
+
+void encodeState(const GameStateDTO& state, GamePhase phase, std::uint8_t* out) {
+    out[0] = static_cast<std::uint8_t>(phase);
+    out[1] = static_cast<std::uint8_t>(state.currentPlayer);
+    out[2] = static_cast<std::uint8_t>(state.dice1);
+    out[3] = static_cast<std::uint8_t>(state.dice2);
+    out[4] = static_cast<std::uint8_t>(state.openingDiceWhite);
+    out[5] = static_cast<std::uint8_t>(state.openingDiceBlack);
+    out[6] = static_cast<std::uint8_t>(state.barWhite);
+    out[7] = static_cast<std::uint8_t>(state.barBlack);
+    out[8] = static_cast<std::uint8_t>(state.borneOffWhite);
+    out[9] = static_cast<std::uint8_t>(state.borneOffBlack);
+    for (int i = 0; i < 24; ++i) {
+        int count = state.pieceCounts[i];
+        if (state.colors[i] == Color::BLACK) count = -count;
+        out[10 + i] = static_cast<std::uint8_t>(static_cast<std::int8_t>(count));
+    }
+}
+
+void decodeState(const std::uint8_t* data, GameStateDTO& state, GamePhase& phase) {
+    phase = static_cast<GamePhase>(data[0]);
+    state.currentPlayer = static_cast<Color>(data[1]);
+    state.dice1 = data[2];
+    state.dice2 = data[3];
+    state.openingDiceWhite = data[4];
+    state.openingDiceBlack = data[5];
+    state.barWhite = data[6];
+    state.barBlack = data[7];
+    state.borneOffWhite = data[8];
+    state.borneOffBlack = data[9];
+    for (int i = 0; i < 24; ++i) {
+        int count = static_cast<std::int8_t>(data[10 + i]);
+        state.pieceCounts[i] = count < 0 ? -count : count;
+        state.colors[i] = count > 0 ? Color::WHITE : (count < 0 ? Color::BLACK : Color::NONE);
+    }
+}
+
+} // namespace Protocol
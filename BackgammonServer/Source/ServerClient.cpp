@@ -0,0 +1,106 @@
+/**
+ * @file ServerClient.cpp
+ * @brief Implementation of the blocking game server client.
+ */
+
+#include "ServerClient.hpp"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+ServerClient::ServerClient() : m_fd(-1) {
+}
+
+ServerClient::~ServerClient() {
+    if (m_fd >= 0) ::close(m_fd);
+}
+
+bool ServerClient::connectUnix(const std::string& path) {
+    sockaddr_un addr{};
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+    m_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_fd < 0) return false;
+    return ::connect(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+}
+
+bool ServerClient::connectTcp(std::uint16_t port) {
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    m_fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_fd < 0) return false;
+    int one = 1;
+    ::setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return ::connect(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+}
+
+Protocol::Status ServerClient::call(const Protocol::Request& request, std::vector<std::uint8_t>& payload) {
+    payload.clear();
+    if (m_fd < 0) return Protocol::Status::BAD_REQUEST;
+
+    m_buffer.clear();
+    Protocol::encodeRequest(request, m_buffer);
+    std::size_t sent = 0;
+    while (sent < m_buffer.size()) {
+        ssize_t w = ::send(m_fd, m_buffer.data() + sent, m_buffer.size() - sent, MSG_NOSIGNAL);
+        if (w < 0 && errno == EINTR) continue;
+        if (w <= 0) return Protocol::Status::BAD_REQUEST;
+        sent += static_cast<std::size_t>(w);
+    }
+
+    Protocol::Status status;
+    for (;;) {
+        if (!receive(status, payload)) return Protocol::Status::BAD_REQUEST;
+        if (status != Protocol::Status::UPDATE) return status;
+        m_updates.push_back(payload);
+    }
+}
+
+bool ServerClient::nextUpdate(std::uint32_t& session, GameStateDTO& state, GamePhase& phase) {
+    std::vector<std::uint8_t> payload;
+    if (!m_updates.empty()) {
+        payload = std::move(m_updates.front());
+        m_updates.pop_front();
+    }
+    else {
+        Protocol::Status status;
+        if (m_fd < 0 || !receive(status, payload) || status != Protocol::Status::UPDATE) return false;
+    }
+    if (payload.size() != Protocol::UPDATE_BODY_SIZE - 1) return false;
+
+    session = payload[0] | (payload[1] << 8) | (payload[2] << 16) | (static_cast<std::uint32_t>(payload[3]) << 24);
+    Protocol::decodeState(payload.data() + 4, state, phase);
+    return true;
+}
+
+bool ServerClient::receive(Protocol::Status& status, std::vector<std::uint8_t>& payload) {
+    std::uint8_t chunk[512];
+    for (;;) {
+        const std::uint8_t* body = nullptr;
+        std::size_t bodySize = 0;
+        std::size_t consumed = 0;
+        Protocol::DecodeResult r = Protocol::decodeResponse(m_in.data(), m_in.size(), status, body, bodySize, consumed);
+        if (r == Protocol::DecodeResult::COMPLETE) {
+            payload.assign(body, body + bodySize);
+            m_in.erase(m_in.begin(), m_in.begin() + static_cast<std::ptrdiff_t>(consumed));
+            return true;
+        }
+        if (r == Protocol::DecodeResult::MALFORMED) return false;
+
+        ssize_t n = ::recv(m_fd, chunk, sizeof(chunk), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        m_in.insert(m_in.end(), chunk, chunk + n);
+    }
+}
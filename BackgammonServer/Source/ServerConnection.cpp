@@ -0,0 +1,116 @@
+/**
+ * @file ServerConnection.cpp
+ * @brief Implementation of the connection output queue and connection table.
+ */
+
+#include "ServerConnection.hpp"
+
+#include <algorithm>
+
+std::vector<std::uint8_t>& OutputQueue::responses() {
+    return m_out;
+}
+
+bool OutputQueue::pushUpdate(const SharedFrame& frame, std::size_t backlog) {
+    if (m_updateBytes + frame->size() > backlog) return false;
+    m_updates.push_back(frame);
+    m_updateBytes += frame->size();
+    return true;
+}
+
+int OutputQueue::gather(iovec* iov, int maxIov) const {
+    int count = 0;
+    std::size_t firstUpdate = 0;
+    if (m_updateOffset > 0 && count < maxIov) {
+        const std::vector<std::uint8_t>& front = *m_updates.front();
+        iov[count++] = iovec{ const_cast<std::uint8_t*>(front.data()) + m_updateOffset, front.size() - m_updateOffset };
+        firstUpdate = 1;
+    }
+    if (m_outOffset < m_out.size() && count < maxIov) {
+        iov[count++] = iovec{ const_cast<std::uint8_t*>(m_out.data()) + m_outOffset, m_out.size() - m_outOffset };
+    }
+    for (std::size_t i = firstUpdate; i < m_updates.size() && count < maxIov; ++i) {
+        const std::vector<std::uint8_t>& frame = *m_updates[i];
+        iov[count++] = iovec{ const_cast<std::uint8_t*>(frame.data()), frame.size() };
+    }
+    return count;
+}
+
+void OutputQueue::retire(std::size_t sent) {
+    // Same order as gather(): a partly sent update, the responses, the other updates
+    if (m_updateOffset > 0) retireUpdates(sent, 1);
+    const std::size_t outSent = std::min(sent, m_out.size() - m_outOffset);
+    m_outOffset += outSent;
+    sent -= outSent;
+    if (m_outOffset >= m_out.size()) {
+        m_out.clear();
+        m_outOffset = 0;
+    }
+    retireUpdates(sent, m_updates.size());
+}
+
+void OutputQueue::retireUpdates(std::size_t& sent, std::size_t limit) {
+    for (std::size_t i = 0; i < limit && sent > 0 && !m_updates.empty(); ++i) {
+        const std::size_t size = m_updates.front()->size();
+        const std::size_t left = size - m_updateOffset;
+        if (sent < left) {
+            m_updateOffset += sent;
+            sent = 0;
+            return;
+        }
+        sent -= left;
+        m_updateBytes -= size;
+        m_updateOffset = 0;
+        m_updates.pop_front();
+    }
+}
+
+bool OutputQueue::empty() const {
+    return m_out.size() == m_outOffset && m_updates.empty();
+}
+
+bool OutputQueue::hasUpdates() const {
+    return !m_updates.empty();
+}
+
+std::size_t OutputQueue::updateBytes() const {
+    return m_updateBytes;
+}
+
+ServerConnection& ConnectionTable::open(int fd, std::uint64_t id) {
+    ServerConnection& conn = m_connections[fd];
+    conn = ServerConnection{};
+    conn.id = id;
+    return conn;
+}
+
+void ConnectionTable::close(int fd) {
+    m_connections.erase(fd);
+}
+
+ServerConnection* ConnectionTable::find(int fd) {
+    auto it = m_connections.find(fd);
+    return it == m_connections.end() ? nullptr : &it->second;
+}
+
+ServerConnection* ConnectionTable::find(int fd, std::uint64_t id) {
+    ServerConnection* conn = find(fd);
+    return (conn && conn->id == id) ? conn : nullptr;
+}
+
+ConnectionTable::DeliveryResult ConnectionTable::deliver(int fd, std::uint64_t id, const SharedFrame& frame,
+                                                         std::size_t backlog, bool& wasIdle) {
+    ServerConnection* conn = find(fd, id);
+    if (!conn) return DeliveryResult::GONE;
+    // Connections with queued updates were already touched or are waiting for EPOLLOUT
+    wasIdle = !conn->output.hasUpdates() && !conn->waitingWritable;
+    if (!conn->output.pushUpdate(frame, backlog)) return DeliveryResult::LAGGING;
+    return DeliveryResult::QUEUED;
+}
+
+std::vector<int> ConnectionTable::sockets() const {
+    std::vector<int> fds;
+    fds.reserve(m_connections.size());
+    for (const auto& entry : m_connections) fds.push_back(entry.first);
+    return fds;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file ServerMain.cpp
+ * @brief Entry point of the Backgammon game server.
+ *
+ * Usage: BackgammonServer [--unix PATH | --port PORT] [--workers N]
+ *                         [--metrics-file PATH] [--metrics-interval SECONDS]
+ *                         [--journal PREFIX] [--snapshot-interval ENTRIES]
+ *
+ * With --metrics-file the engine metrics (see Instrumentation.hpp) are
+ * rewritten periodically in Prometheus text format, e.g. for the node
+ * exporter textfile collector. A path ending in ".json" selects JSON.
+ *
+ * With --journal, sessions are journaled to files starting with PREFIX and
+ * restored from them on the next start, e.g. after a crash.
+ */
+
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include "GameServer.hpp"
+#include "Instrumentation.hpp"
+
+namespace {
+    volatile std::sig_atomic_t g_stopRequested = 0;  ///< Set by SIGINT/SIGTERM
+
+    void onSignal(int) {
+        g_stopRequested = 1;
+    }
+}
+
+/**
+ * @brief Main entry point of the server.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return Process exit code
+ */
+int main(int argc, char* argv[]) {
+    ServerConfig config;
+    config.tcpPort = 7500;
+    std::string metricsPath;
+    unsigned metricsInterval = 10;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--unix" && i + 1 < argc) config.unixSocketPath = argv[++i];
+        else if (arg == "--port" && i + 1 < argc) config.tcpPort = static_cast<std::uint16_t>(std::atoi(argv[++i]));
+        else if (arg == "--workers" && i + 1 < argc) config.workerCount = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (arg == "--metrics-file" && i + 1 < argc) metricsPath = argv[++i];
+        else if (arg == "--metrics-interval" && i + 1 < argc) metricsInterval = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (arg == "--journal" && i + 1 < argc) config.journalPath = argv[++i];
+        else if (arg == "--snapshot-interval" && i + 1 < argc) config.snapshotInterval = std::strtoull(argv[++i], nullptr, 10);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--unix PATH | --port PORT] [--workers N]"
+                      << " [--metrics-file PATH] [--metrics-interval SECONDS]"
+                      << " [--journal PREFIX] [--snapshot-interval ENTRIES]\n";
+            return 2;
+        }
+    }
+
+    GameServer server(config);
+    std::size_t recovered = 0;
+    std::size_t replayed = 0;
+    if (!server.recover(recovered, replayed)) {
+        std::cerr << "Could not recover sessions from journal " << config.journalPath << std::endl;
+        return 1;
+    }
+    if (!config.journalPath.empty()) {
+        std::cout << "Recovered " << recovered << " sessions (" << replayed << " journal entries replayed)" << std::endl;
+    }
+    if (!server.start()) {
+        std::cerr << "Failed to listen: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    std::cout << "Backgammon server listening on "
+              << (config.unixSocketPath.empty() ? "127.0.0.1:" + std::to_string(config.tcpPort) : config.unixSocketPath)
+              << " with " << server.sessions().shardCount() << " workers" << std::endl;
+
+    const Instrumentation::Format metricsFormat =
+        metricsPath.size() >= 5 && metricsPath.compare(metricsPath.size() - 5, 5, ".json") == 0
+            ? Instrumentation::Format::JSON : Instrumentation::Format::PROMETHEUS;
+    if (!metricsPath.empty() && !Instrumentation::ENABLED) {
+        std::cerr << "Warning: built without BACKGAMMON_INSTRUMENTATION, metrics will stay empty" << std::endl;
+    }
+
+    while (!g_stopRequested) {
+        if (metricsPath.empty()) {
+            ::pause();
+            continue;
+        }
+        if (!Instrumentation::writeFile(metricsPath, metricsFormat)) {
+            std::cerr << "Could not write " << metricsPath << std::endl;
+        }
+        ::sleep(metricsInterval > 0 ? metricsInterval : 1);
+    }
+
+    server.stop();
+    if (!metricsPath.empty()) Instrumentation::writeFile(metricsPath, metricsFormat);
+    return 0;
+}
@@ -0,0 +1,260 @@
+/**
+ * @file SessionJournal.cpp
+ * @brief Implementation of session journaling, snapshots and crash recovery.
+ */
+
+#include "SessionJournal.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include "Protocol.hpp"
+
+namespace {
+    constexpr char SNAPSHOT_MAGIC[4] = { 'B', 'G', 'J', 'S' };
+    constexpr std::uint32_t SNAPSHOT_VERSION = 2;
+    constexpr std::size_t HEADER_SIZE = 20;
+    constexpr std::size_t SESSION_HEADER_SIZE = 12 + Protocol::STATE_SIZE + 1 + 4;
+    constexpr std::size_t MOVE_SIZE = 3;
+
+    void putU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    void putU64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        for (int i = 0; i < 8; ++i) out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    std::uint32_t getU32(const std::uint8_t* in) {
+        std::uint32_t value = 0;
+        for (int i = 3; i >= 0; --i) value = value << 8 | in[i];
+        return value;
+    }
+
+    std::uint64_t getU64(const std::uint8_t* in) {
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) value = value << 8 | in[i];
+        return value;
+    }
+
+    /**
+     * @brief Writes a file under a temporary name, syncs it and renames it over the target.
+     */
+    bool replaceFile(const std::string& path, const std::vector<std::uint8_t>& bytes) {
+        const std::string temporary = path + ".tmp";
+        std::FILE* file = std::fopen(temporary.c_str(), "wb");
+        if (!file) return false;
+        bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size() &&
+                  std::fflush(file) == 0 && ::fsync(::fileno(file)) == 0;
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+
+        // The rename itself is only durable once the directory is synced
+        const std::size_t slash = path.find_last_of('/');
+        const std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+        const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0) return false;
+        ok = ::fsync(fd) == 0;
+        ::close(fd);
+        return ok;
+    }
+}
+
+SessionJournal::SessionJournal(SessionStore& sessions, std::string prefix, std::uint64_t snapshotInterval)
+    : m_sessions(sessions), m_prefix(std::move(prefix)), m_snapshotInterval(snapshotInterval),
+      m_snapshotRequested(false), m_stop(false), m_snapshotLsn(0) {
+}
+
+SessionJournal::~SessionJournal() {
+    if (m_snapshotter.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_stop = true;
+        }
+        m_snapshotWake.notify_one();
+        m_snapshotter.join();
+    }
+    m_journal.close();
+}
+
+bool SessionJournal::recover(std::size_t& sessionCount, std::size_t& replayed) {
+    sessionCount = 0;
+    replayed = 0;
+
+    std::uint64_t boundary = 0;
+    if (!loadSnapshot(boundary, sessionCount)) return false;
+
+    std::uint64_t firstLsn = 1;
+    std::vector<JournalEntry> entries;
+    GameJournal::readAll(m_prefix, firstLsn, entries);
+    // Entries between the snapshot and the oldest segment are gone
+    if (!entries.empty() && firstLsn > boundary + 1) return false;
+
+    std::uint64_t lsn = firstLsn - 1;
+    for (const JournalEntry& entry : entries) {
+        ++lsn;
+        if (lsn <= boundary) continue;
+        ++replayed;
+
+        if (entry.op == JournalOp::CREATE) {
+            m_sessions.restore(entry.session, [&](Session& session) { session.lastLsn = lsn; });
+            continue;
+        }
+        if (entry.op == JournalOp::CLOSE) {
+            m_sessions.destroy(entry.session);
+            continue;
+        }
+        m_sessions.withSession(entry.session, [&](Session& session) {
+            // The snapshot already contains changes logged while it was taken
+            if (lsn <= session.lastLsn) return;
+            session.lastLsn = lsn;
+
+            if (entry.op == JournalOp::MOVE) {
+                const Color player = session.game.getCurrentPlayer();
+                if (session.game.makeMove(entry.a, entry.b) == MoveResult::SUCCESS) {
+                    session.history.push_back(MoveRecord{ player, entry.a, entry.b });
+                }
+                return;
+            }
+            entry.apply(session.game);
+            if (entry.op == JournalOp::START) session.history.clear();
+        });
+    }
+    sessionCount = m_sessions.size();
+
+    m_snapshotLsn = boundary;
+    if (!m_journal.open(m_prefix, std::max(lsn, boundary) + 1)) return false;
+    if (m_snapshotInterval > 0) m_snapshotter = std::thread([this]() { runSnapshots(); });
+    return true;
+}
+
+std::uint64_t SessionJournal::log(std::uint32_t session, JournalOp op, int a, int b) {
+    JournalEntry entry;
+    entry.session = session;
+    entry.op = op;
+    entry.a = static_cast<std::int8_t>(a);
+    entry.b = static_cast<std::int8_t>(b);
+    return m_journal.append(entry);
+}
+
+bool SessionJournal::waitDurable(std::uint64_t lsn) {
+    return m_journal.waitDurable(lsn);
+}
+
+void SessionJournal::maybeSnapshot() {
+    if (m_snapshotInterval == 0) return;
+    if (m_journal.lastLsn() - m_snapshotLsn.load(std::memory_order_relaxed) < m_snapshotInterval) return;
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        if (m_snapshotRequested) return;
+        m_snapshotRequested = true;
+    }
+    m_snapshotWake.notify_one();
+}
+
+bool SessionJournal::snapshot() {
+    std::lock_guard<std::mutex> snapshotLock(m_snapshotMutex);
+
+    // Everything up to the boundary is on disk in closed segments; sessions
+    // may move on while they are captured, which their last LSN records
+    const std::uint64_t boundary = m_journal.rotate();
+
+    std::vector<std::uint8_t> bytes(SNAPSHOT_MAGIC, SNAPSHOT_MAGIC + sizeof SNAPSHOT_MAGIC);
+    putU32(bytes, SNAPSHOT_VERSION);
+    putU64(bytes, boundary);
+    putU32(bytes, 0);
+
+    std::uint32_t count = 0;
+    std::uint8_t state[Protocol::STATE_SIZE];
+    m_sessions.forEachSession([&](std::uint32_t id, const Session& session) {
+        putU32(bytes, id);
+        putU64(bytes, session.lastLsn);
+        // The state encoding cannot tell leftover dice from playable ones
+        const GameMemento memento = session.game.saveMemento();
+        Protocol::encodeState(memento.state, memento.phase, state);
+        bytes.insert(bytes.end(), state, state + sizeof state);
+        bytes.push_back(memento.diceRolled ? 1 : 0);
+        putU32(bytes, static_cast<std::uint32_t>(session.history.size()));
+        for (const MoveRecord& move : session.history) {
+            bytes.push_back(static_cast<std::uint8_t>(move.player));
+            bytes.push_back(static_cast<std::uint8_t>(move.from));
+            bytes.push_back(static_cast<std::uint8_t>(move.to));
+        }
+        ++count;
+    });
+    for (int i = 0; i < 4; ++i) bytes[16 + i] = static_cast<std::uint8_t>(count >> (8 * i));
+
+    if (!replaceFile(m_prefix + ".snapshot", bytes)) return false;
+    GameJournal::removeSegmentsBefore(m_prefix, boundary + 1);
+    m_snapshotLsn = boundary;
+    return true;
+}
+
+bool SessionJournal::loadSnapshot(std::uint64_t& boundary, std::size_t& sessionCount) {
+    boundary = 0;
+    sessionCount = 0;
+
+    std::FILE* file = std::fopen((m_prefix + ".snapshot").c_str(), "rb");
+    if (!file) return true;
+    std::vector<std::uint8_t> bytes;
+    std::uint8_t chunk[65536];
+    for (std::size_t n; (n = std::fread(chunk, 1, sizeof chunk, file)) > 0;) bytes.insert(bytes.end(), chunk, chunk + n);
+    std::fclose(file);
+
+    if (bytes.size() < HEADER_SIZE || std::memcmp(bytes.data(), SNAPSHOT_MAGIC, sizeof SNAPSHOT_MAGIC) != 0 ||
+        getU32(bytes.data() + 4) != SNAPSHOT_VERSION) {
+        return false;
+    }
+    boundary = getU64(bytes.data() + 8);
+    const std::uint32_t count = getU32(bytes.data() + 16);
+
+    std::size_t offset = HEADER_SIZE;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (bytes.size() - offset < SESSION_HEADER_SIZE) return false;
+        const std::uint8_t* in = bytes.data() + offset;
+        const std::uint32_t id = getU32(in);
+        const std::uint64_t lastLsn = getU64(in + 4);
+        const std::uint8_t diceRolled = in[12 + Protocol::STATE_SIZE];
+        const std::uint32_t moves = getU32(in + 13 + Protocol::STATE_SIZE);
+        offset += SESSION_HEADER_SIZE;
+        if (diceRolled > 1 || (bytes.size() - offset) / MOVE_SIZE < moves) return false;
+
+        GameMemento memento;
+        Protocol::decodeState(in + 12, memento.state, memento.phase);
+        memento.diceRolled = diceRolled != 0;
+        const std::uint8_t* history = bytes.data() + offset;
+        const bool restored = m_sessions.restore(id, [&](Session& session) {
+            session.game.restoreMemento(memento);
+            session.lastLsn = lastLsn;
+            session.history.reserve(moves);
+            for (std::uint32_t m = 0; m < moves; ++m) {
+                session.history.push_back(MoveRecord{ static_cast<Color>(history[3 * m]),
+                                                      static_cast<std::int8_t>(history[3 * m + 1]),
+                                                      static_cast<std::int8_t>(history[3 * m + 2]) });
+            }
+        });
+        if (!restored) return false;
+        offset += static_cast<std::size_t>(moves) * MOVE_SIZE;
+    }
+    sessionCount = count;
+    return offset == bytes.size();
+}
+
+void SessionJournal::runSnapshots() {
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    for (;;) {
+        m_snapshotWake.wait(lock, [&]() { return m_stop || m_snapshotRequested; });
+        if (m_stop) return;
+        lock.unlock();
+        snapshot();
+        lock.lock();
+        m_snapshotRequested = false;
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file SessionStore.cpp
+ * @brief Implementation of the sharded session store.
+ */
+
+#include "SessionStore.hpp"
+
+Session::Session() : history(arena.resource()), targets(arena.resource()) {
+}
+
+void Session::reset() {
+    game.reset();
+    history = std::pmr::vector<MoveRecord>(arena.resource());
+    targets = std::pmr::vector<int>(arena.resource());
+    arena.release();
+    lastLsn = 0;
+    spectators.clear();
+}
+
+SessionStore::SessionStore(unsigned shardCount) {
+    if (shardCount == 0) shardCount = 1;
+    m_shards.reserve(shardCount);
+    for (unsigned i = 0; i < shardCount; ++i) {
+        m_shards.push_back(std::make_unique<Shard>());
+    }
+}
+
+unsigned SessionStore::shardCount() const {
+    return static_cast<unsigned>(m_shards.size());
+}
+
+std::uint32_t SessionStore::create(unsigned shard) {
+    return create(shard, [](std::uint32_t, Session&) {});
+}
+
+bool SessionStore::destroy(std::uint32_t id) {
+    Shard& shard = shardFor(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.sessions.erase(id) > 0;
+}
+
+std::size_t SessionStore::size() const {
+    std::size_t total = 0;
+    for (const auto& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->sessions.size();
+    }
+    return total;
+}
+
+SessionStore::Shard& SessionStore::shardFor(std::uint32_t id) {
+    return *m_shards[id % m_shards.size()];
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include "Board.hpp"
+#include "Game.hpp"
+
+// =============================
+// BOARD & STATE LOADING TESTS
+// =============================
+
+TEST(BoardTests, SetBarAndBorneOffCounts) {
+    Board b;
+    b.setBarCount(0, 2);
+    b.setBorneOffCount(1, 7);
+
+    EXPECT_EQ(b.getBarCount(0), 2);
+    EXPECT_EQ(b.getBorneOffCount(1), 7);
+}
+
+TEST(BoardTests, LoadStateRoundTrips) {
+    Game g;
+    g.start();
+    GameStateDTO s = g.getState();
+    s.pieceCounts[0] = 1;
+    s.barWhite = 1;
+    s.dice1 = 3;
+    s.dice2 = 5;
+
+    HeadlessGame h;
+    h.loadState(s);
+
+    GameStateDTO r = h.getState();
+    EXPECT_EQ(r.pieceCounts, s.pieceCounts);
+    EXPECT_EQ(r.colors, s.colors);
+    EXPECT_EQ(r.barWhite, 1);
+    EXPECT_EQ(h.getPhase(), GamePhase::IN_PROGRESS);
+    EXPECT_TRUE(h.canSelectPoint(Game::BAR_INDEX));
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <sstream>
+#include "CommandHistory.hpp"
+#include "Game.hpp"
+#include "GameRecordStream.hpp"
+#include "GameRecorder.hpp"
+#include "SnapshotPublisher.hpp"
+
+// =============================
+// COMMAND HISTORY TESTS
+// =============================
+
+namespace {
+    /// Starts a game with white on roll after opening rolls of 5 and 2
+    void startWhite(IGame& game, CommandHistory& history) {
+        game.start();
+        ASSERT_EQ(history.execute(game, RollOpeningDiceCommand(5)), MoveResult::SUCCESS);
+        ASSERT_EQ(history.execute(game, RollOpeningDiceCommand(2)), MoveResult::SUCCESS);
+        ASSERT_EQ(history.execute(game, StartAfterOpeningCommand()), MoveResult::SUCCESS);
+    }
+
+    void expectSameState(const IGame& game, const GameMemento& expected) {
+        const GameMemento actual = game.saveMemento();
+        for (int i = 0; i < 24; ++i) {
+            EXPECT_EQ(actual.state.pieceCounts[i], expected.state.pieceCounts[i]) << "column " << i;
+            EXPECT_EQ(actual.state.colors[i], expected.state.colors[i]) << "column " << i;
+        }
+        EXPECT_EQ(actual.state.barWhite, expected.state.barWhite);
+        EXPECT_EQ(actual.state.barBlack, expected.state.barBlack);
+        EXPECT_EQ(actual.state.currentPlayer, expected.state.currentPlayer);
+        EXPECT_EQ(actual.state.dice1, expected.state.dice1);
+        EXPECT_EQ(actual.state.dice2, expected.state.dice2);
+        EXPECT_EQ(actual.phase, expected.phase);
+        EXPECT_EQ(actual.diceRolled, expected.diceRolled);
+    }
+}
+
+TEST(CommandHistoryTests, UndoRestoresExactState) {
+    HeadlessGame game;
+    CommandHistory history;
+    startWhite(game, history);
+    EXPECT_EQ(game.getPhase(), GamePhase::IN_PROGRESS);
+
+    const GameMemento beforeRoll = game.saveMemento();
+    ASSERT_EQ(history.execute(game, RollDiceCommand(3, 1)), MoveResult::SUCCESS);
+    const GameMemento beforeMoves = game.saveMemento();
+    ASSERT_EQ(history.execute(game, MoveCommand(16, 19)), MoveResult::SUCCESS);
+    ASSERT_EQ(history.execute(game, MoveCommand(18, 19)), MoveResult::SUCCESS);
+    EXPECT_EQ(game.getCurrentPlayer(), Color::BLACK);
+    EXPECT_EQ(history.undoCount(), 6u);
+
+    EXPECT_TRUE(history.undo(game));
+    EXPECT_TRUE(history.undo(game));
+    expectSameState(game, beforeMoves);
+    EXPECT_TRUE(history.undo(game));
+    expectSameState(game, beforeRoll);
+    EXPECT_EQ(history.redoCount(), 3u);
+
+    // Back to before the opening rolls
+    while (history.undo(game)) {}
+    EXPECT_EQ(game.getPhase(), GamePhase::OPENING_ROLL_WHITE);
+    EXPECT_EQ(history.redoCount(), 6u);
+}
+
+TEST(CommandHistoryTests, RedoReplaysTheSameRandomRoll) {
+    HeadlessGame game;
+    CommandHistory history;
+    startWhite(game, history);
+
+    ASSERT_EQ(history.execute(game, RollDiceCommand()), MoveResult::SUCCESS);
+    const GameMemento rolled = game.saveMemento();
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(history.undo(game));
+        EXPECT_EQ(game.getDice()[0], 0);
+        ASSERT_TRUE(history.redo(game));
+        expectSameState(game, rolled);
+    }
+    EXPECT_FALSE(history.redo(game));
+}
+
+TEST(CommandHistoryTests, PlayUndoesAsOneStep) {
+    HeadlessGame game;
+    CommandHistory history;
+    startWhite(game, history);
+    ASSERT_EQ(history.execute(game, RollDiceCommand(3, 1)), MoveResult::SUCCESS);
+    const GameMemento before = game.saveMemento();
+
+    Play play;
+    play.push(16, 19);
+    play.push(18, 19);
+    ASSERT_EQ(history.execute(game, PlayCommand(play)), MoveResult::SUCCESS);
+    const GameMemento after = game.saveMemento();
+
+    ASSERT_TRUE(history.undo(game));
+    expectSameState(game, before);
+    ASSERT_TRUE(history.redo(game));
+    expectSameState(game, after);
+}
+
+TEST(CommandHistoryTests, FailedCommandsAreNotRecorded) {
+    HeadlessGame game;
+    CommandHistory history;
+    startWhite(game, history);
+    ASSERT_EQ(history.execute(game, RollDiceCommand(3, 1)), MoveResult::SUCCESS);
+    ASSERT_TRUE(history.undo(game));
+
+    // Wrong phase and an illegal move change nothing, not even the redo entry
+    EXPECT_EQ(history.execute(game, RollOpeningDiceCommand(4)), MoveResult::GAME_NOT_STARTED);
+    EXPECT_NE(history.execute(game, MoveCommand(16, 19)), MoveResult::SUCCESS);
+    EXPECT_EQ(history.undoCount(), 3u);
+    EXPECT_EQ(history.redoCount(), 1u);
+
+    ASSERT_TRUE(history.redo(game));
+    EXPECT_EQ(game.getDice()[0], 3);
+    EXPECT_EQ(game.getDice()[1], 1);
+}
+
+TEST(CommandHistoryTests, NewCommandClearsRedo) {
+    HeadlessGame game;
+    CommandHistory history;
+    startWhite(game, history);
+    ASSERT_EQ(history.execute(game, RollDiceCommand(3, 1)), MoveResult::SUCCESS);
+    ASSERT_TRUE(history.undo(game));
+    EXPECT_EQ(history.redoCount(), 1u);
+
+    ASSERT_EQ(history.execute(game, RollDiceCommand(6, 4)), MoveResult::SUCCESS);
+    EXPECT_EQ(history.redoCount(), 0u);
+    EXPECT_FALSE(history.redo(game));
+    EXPECT_EQ(game.getDice()[0], 6);
+}
+
+TEST(CommandHistoryTests, FullRingForgetsOldestCommand) {
+    HeadlessGame game;
+    CommandHistory history(4);
+    startWhite(game, history);
+    ASSERT_EQ(history.execute(game, RollDiceCommand(3, 1)), MoveResult::SUCCESS);
+    const GameMemento afterRoll = game.saveMemento();
+    ASSERT_EQ(history.execute(game, PassCommand()), MoveResult::SUCCESS);
+    ASSERT_EQ(history.execute(game, RollDiceCommand(6, 5)), MoveResult::SUCCESS);
+    ASSERT_EQ(history.execute(game, PassCommand()), MoveResult::SUCCESS);
+    EXPECT_EQ(history.undoCount(), 4u);
+
+    // Only the last four commands can be undone
+    for (int i = 0; i < 3; ++i) ASSERT_TRUE(history.undo(game));
+    expectSameState(game, afterRoll);
+    EXPECT_TRUE(history.undo(game));
+    EXPECT_FALSE(history.undo(game));
+    EXPECT_EQ(game.getPhase(), GamePhase::IN_PROGRESS);
+
+    // Redo walks forward across the ring's wrap-around
+    for (int i = 0; i < 4; ++i) ASSERT_TRUE(history.redo(game));
+    EXPECT_EQ(game.getCurrentPlayer(), Color::WHITE);
+    EXPECT_EQ(history.undoCount(), 4u);
+
+    history.clear();
+    EXPECT_FALSE(history.undo(game));
+    EXPECT_EQ(history.capacity(), 4u);
+}
+
+TEST(CommandHistoryTests, ImpossibleDiceAreRejected) {
+    HeadlessGame game;
+    CommandHistory history;
+    game.start();
+    EXPECT_EQ(history.execute(game, RollOpeningDiceCommand(7)), MoveResult::INVALID_MOVE);
+    startWhite(game, history);
+    EXPECT_EQ(history.execute(game, RollDiceCommand(7, 0)), MoveResult::INVALID_MOVE);
+    EXPECT_EQ(history.undoCount(), 3u);
+}
+
+TEST(CommandHistoryTests, UndoUpdatesObserversOfGame) {
+    Game game;
+    SnapshotPublisher publisher(game);
+    GameRecorder recorder(game);
+    game.addObserver(&publisher);
+    game.addObserver(&recorder);
+    CommandHistory history;
+    startWhite(game, history);
+    ASSERT_EQ(history.execute(game, RollDiceCommand(3, 1)), MoveResult::SUCCESS);
+    const std::size_t eventsAfterRoll = recorder.record().events.size();
+    ASSERT_EQ(history.execute(game, MoveCommand(16, 19)), MoveResult::SUCCESS);
+    ASSERT_EQ(history.execute(game, MoveCommand(18, 19)), MoveResult::SUCCESS);
+    const std::uint64_t versionAfterMoves = publisher.current()->version;
+
+    ASSERT_TRUE(history.undo(game));
+    ASSERT_TRUE(history.undo(game));
+    EXPECT_GT(publisher.current()->version, versionAfterMoves);
+    EXPECT_EQ(publisher.current()->state.pieceCounts[16], 3);
+    EXPECT_EQ(publisher.current()->state.currentPlayer, Color::WHITE);
+    EXPECT_EQ(recorder.record().events.size(), eventsAfterRoll);
+
+    // Redone moves are recorded again and the record still replays to the game
+    ASSERT_TRUE(history.redo(game));
+    ASSERT_TRUE(history.redo(game));
+    EXPECT_EQ(recorder.record().events.size(), eventsAfterRoll + 2);
+    HeadlessGame replayed;
+    ASSERT_TRUE(recorder.record().replay(replayed));
+    expectSameState(replayed, game.saveMemento());
+}
+
+TEST(CommandHistoryTests, RedoneWinIsWrittenOnce) {
+    std::stringstream file(std::ios::in | std::ios::out | std::ios::binary);
+    GameRecordWriter writer(file);
+    Game game;
+    GameRecorder recorder(game, &writer);
+    game.addObserver(&recorder);
+
+    // White's last checker on 23 against black's fifteen at home
+    std::array<int, 24> columns{};
+    columns[0] = -15;
+    columns[23] = 1;
+    const GameStateDTO position = GameStateDTO::fromColumns(columns, 0, 0, 14, 0, Color::WHITE);
+    game.loadState(position);
+    recorder.beginFromPosition(position);
+
+    CommandHistory history;
+    ASSERT_EQ(history.execute(game, RollDiceCommand(1, 2)), MoveResult::SUCCESS);
+    ASSERT_EQ(history.execute(game, MoveCommand(23, 24)), MoveResult::SUCCESS);
+    ASSERT_EQ(game.getPhase(), GamePhase::FINISHED);
+    EXPECT_EQ(writer.recordCount(), 1u);
+
+    ASSERT_TRUE(history.undo(game));
+    EXPECT_FALSE(recorder.record().finished);
+    EXPECT_EQ(recorder.record().events.size(), 1u);
+    ASSERT_TRUE(history.redo(game));
+    EXPECT_TRUE(recorder.record().finished);
+    EXPECT_EQ(recorder.record().events.size(), 2u);
+    EXPECT_EQ(writer.recordCount(), 1u);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include "GameArchive.hpp"
+
+// =============================
+// GAME ARCHIVE TESTS
+// =============================
+
+namespace {
+    /// Short custom game: white bears off its last two checkers with 1-2
+    GameRecord bearOffRecord(std::uint64_t id) {
+        GameRecord r;
+        r.gameId = id;
+        r.standardStart = false;
+        r.startPosition.pieceCounts[23] = 2;
+        r.startPosition.colors[23] = Color::WHITE;
+        r.startPosition.pieceCounts[0] = 2;
+        r.startPosition.colors[0] = Color::BLACK;
+        r.startPosition.borneOffWhite = 13;
+        r.startPosition.borneOffBlack = 13;
+        r.startPosition.currentPlayer = Color::WHITE;
+        r.events.push_back({ GameEventType::ROLL, 1, 2 });
+        r.events.push_back({ GameEventType::MOVE, 23, 24 });
+        r.events.push_back({ GameEventType::MOVE, 23, 24 });
+        r.finished = true;
+        r.winner = Color::WHITE;
+        return r;
+    }
+
+    std::string tempPath(const char* name) {
+        return ::testing::TempDir() + name;
+    }
+}
+
+TEST(GameArchiveTests, SeeksToGameAndEvent) {
+    const std::string path = tempPath("archive_seek.bga");
+    {
+        GameArchiveWriter writer(path);
+        ASSERT_TRUE(writer.isOpen());
+        for (std::uint64_t id = 0; id < 100; ++id) writer.append(bearOffRecord(id));
+        ASSERT_TRUE(writer.finish());
+    }
+
+    GameArchive archive;
+    ASSERT_TRUE(archive.open(path));
+    ASSERT_EQ(archive.gameCount(), 100u);
+
+    const GameView view = archive.game(42);
+    GameRecord header;
+    ASSERT_TRUE(view.header(header));
+    EXPECT_EQ(header.gameId, 42u);
+    ASSERT_EQ(view.eventCount(), 3u);
+    EXPECT_EQ(view.event(1).type, GameEventType::MOVE);
+    EXPECT_EQ(view.event(1).b, 24);
+
+    HeadlessGame game;
+    ASSERT_TRUE(view.replay(game, 2));
+    EXPECT_EQ(game.getBorneOffCount(Color::WHITE), 14);
+    ASSERT_TRUE(view.replay(game));
+    EXPECT_EQ(game.getPhase(), GamePhase::FINISHED);
+    std::remove(path.c_str());
+}
+
+TEST(GameArchiveTests, OutOfRangeIndexesGiveInvalidResults) {
+    const std::string path = tempPath("archive_range.bga");
+    {
+        GameArchiveWriter writer(path);
+        writer.append(bearOffRecord(7));
+        ASSERT_TRUE(writer.finish());
+    }
+
+    GameArchive archive;
+    ASSERT_TRUE(archive.open(path));
+    EXPECT_TRUE(archive.game(0).isValid());
+
+    const GameView missing = archive.game(1);
+    EXPECT_FALSE(missing.isValid());
+    EXPECT_EQ(missing.eventCount(), 0u);
+    GameRecord record;
+    EXPECT_FALSE(missing.header(record));
+    EXPECT_FALSE(missing.decode(record));
+    HeadlessGame game;
+    EXPECT_FALSE(missing.replay(game));
+
+    // An event past the end decodes to an event the engine refuses
+    const GameView view = archive.game(0);
+    EXPECT_FALSE(view.event(view.eventCount()).isValid());
+    EXPECT_FALSE(GameView().event(0).isValid());
+    std::remove(path.c_str());
+}
+
+TEST(GameArchiveTests, RejectsFileWithoutTrailer) {
+    const std::string path = tempPath("archive_trailing.bga");
+    const std::string validPath = tempPath("archive_valid.bga");
+    for (const std::string& p : { path, validPath }) {
+        GameArchiveWriter writer(p);
+        writer.append(bearOffRecord(1));
+        ASSERT_TRUE(writer.finish());
+    }
+
+    // Bytes appended after the trailer hide it from the reader
+    std::FILE* out = std::fopen(path.c_str(), "ab");
+    ASSERT_NE(out, nullptr);
+    std::fputc(0, out);
+    std::fclose(out);
+
+    GameArchive archive;
+    ASSERT_TRUE(archive.open(validPath));
+    EXPECT_EQ(archive.gameCount(), 1u);
+
+    // A failed open leaves the archive closed, not holding the earlier mapping
+    EXPECT_FALSE(archive.open(path));
+    EXPECT_FALSE(archive.isOpen());
+    EXPECT_EQ(archive.gameCount(), 0u);
+    std::remove(path.c_str());
+    std::remove(validPath.c_str());
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <latch>
+#include <optional>
+#include <set>
+#include <thread>
+#include "Executor.hpp"
+#include "Game.hpp"
+#include "GameDriver.hpp"
+#include "RandomBot.hpp"
+#include "Task.hpp"
+
+// =============================
+// GAME DRIVER TESTS
+// =============================
+
+namespace {
+    Task<int> one() {
+        co_return 1;
+    }
+
+    Task<long> sumOfOnes(int count) {
+        long sum = 0;
+        for (int i = 0; i < count; ++i) sum += co_await one();
+        co_return sum;
+    }
+
+    Task<int> countDown(int depth, int& started) {
+        ++started;
+        if (depth == 0) co_return 0;
+        co_return 1 + co_await countDown(depth - 1, started);
+    }
+
+    template <typename T>
+    DetachedTask runInto(Task<T> task, std::optional<T>& result, std::latch& done) {
+        result = co_await std::move(task);
+        done.count_down();
+    }
+
+    Task<std::thread::id> threadAfterSchedule(Executor& executor) {
+        co_await executor.schedule();
+        co_return std::this_thread::get_id();
+    }
+
+    /**
+     * @brief Agent that always proposes the same move, legal or not.
+     */
+    class StubbornAgent : public IPlayerAgent {
+    public:
+        Task<std::optional<AgentMove>> chooseMove(const IGame&) override {
+            ++asked;
+            co_return AgentMove{ 0, 0 };
+        }
+
+        int asked = 0;  ///< Number of moves requested
+    };
+}
+
+TEST(GameDriverTests, TaskStartsOnlyWhenAwaited) {
+    int started = 0;
+    Task<int> task = countDown(3, started);
+    EXPECT_EQ(started, 0);
+
+    std::optional<int> result;
+    std::latch done(1);
+    runInto(std::move(task), result, done);
+    EXPECT_TRUE(done.try_wait());
+    EXPECT_EQ(started, 4);
+    EXPECT_EQ(result, 3);
+}
+
+TEST(GameDriverTests, SymmetricTransferKeepsTheStackFlat) {
+    // Without symmetric transfer every completed await would nest a resume on the stack
+    std::optional<long> result;
+    std::latch done(1);
+    runInto(sumOfOnes(1000000), result, done);
+    EXPECT_TRUE(done.try_wait());
+    EXPECT_EQ(result, 1000000);
+}
+
+TEST(GameDriverTests, ScheduleResumesOnAnExecutorThread) {
+    std::set<std::thread::id> pool;
+    std::optional<std::thread::id> resumedOn;
+    {
+        Executor executor(2);
+        EXPECT_EQ(executor.threadCount(), 2u);
+        std::latch done(1);
+        runInto(threadAfterSchedule(executor), resumedOn, done);
+        done.wait();
+
+        // Every coroutine posted is resumed, on one of the pool threads
+        constexpr int COUNT = 64;
+        std::vector<std::optional<std::thread::id>> ids(COUNT);
+        std::latch all(COUNT);
+        for (auto& id : ids) runInto(threadAfterSchedule(executor), id, all);
+        all.wait();
+        for (const auto& id : ids) pool.insert(*id);
+    }
+    ASSERT_TRUE(resumedOn.has_value());
+    EXPECT_NE(*resumedOn, std::this_thread::get_id());
+    EXPECT_EQ(pool.count(std::this_thread::get_id()), 0u);
+    EXPECT_LE(pool.size(), 2u);
+}
+
+TEST(GameDriverTests, BotsOnTheExecutorFinishTheGame) {
+    Executor executor(2);
+    HeadlessGame game;
+    RandomBot white(1, &executor);
+    RandomBot black(2, &executor);
+
+    std::optional<Color> winner;
+    std::latch done(1);
+    runInto(runGame(game, white, black), winner, done);
+    done.wait();
+    ASSERT_TRUE(winner.has_value());
+    EXPECT_EQ(game.getPhase(), GamePhase::FINISHED);
+    EXPECT_EQ(game.getBorneOffCount(*winner), 15);
+}
+
+TEST(GameDriverTests, AgentRepeatingIllegalMovesForfeits) {
+    HeadlessGame game;
+    StubbornAgent white;
+    StubbornAgent black;
+
+    std::optional<Color> winner;
+    std::latch done(1);
+    runInto(runGame(game, white, black), winner, done);
+    ASSERT_TRUE(done.try_wait());
+    ASSERT_TRUE(winner.has_value());
+
+    // Only the forfeiting player was asked, and the game stays unfinished
+    const Color loser = game.getCurrentPlayer();
+    EXPECT_NE(*winner, loser);
+    EXPECT_EQ((loser == Color::WHITE ? white : black).asked, MAX_REJECTED_MOVES);
+    EXPECT_EQ((loser == Color::WHITE ? black : white).asked, 0);
+    EXPECT_EQ(game.getPhase(), GamePhase::IN_PROGRESS);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Game.hpp"
+#include "GameJournal.hpp"
+
+// =============================
+// GAME JOURNAL TESTS
+// =============================
+
+namespace {
+    std::string journalPrefix(const char* name) {
+        const std::string prefix = ::testing::TempDir() + name;
+        GameJournal::removeSegmentsBefore(prefix, UINT64_MAX);
+        return prefix;
+    }
+
+    JournalEntry entryFor(std::uint32_t session, JournalOp op, int a = 0, int b = 0) {
+        JournalEntry entry;
+        entry.session = session;
+        entry.op = op;
+        entry.a = static_cast<std::int8_t>(a);
+        entry.b = static_cast<std::int8_t>(b);
+        return entry;
+    }
+}
+
+TEST(GameJournalTests, AppendsFromManyThreadsDurably) {
+    const std::string prefix = journalPrefix("bg_journal_append");
+    GameJournal journal;
+    ASSERT_TRUE(journal.open(prefix, 1));
+
+    const int threads = 4;
+    const int perThread = 500;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; ++t) {
+        writers.emplace_back([&, t] {
+            for (int i = 0; i < perThread; ++i) {
+                const std::uint64_t lsn = journal.append(entryFor(static_cast<std::uint32_t>(t), JournalOp::MOVE, i % 100, t));
+                if (i % 50 == 0) {
+                    EXPECT_TRUE(journal.waitDurable(lsn));
+                }
+            }
+        });
+    }
+    for (auto& w : writers) w.join();
+    EXPECT_EQ(journal.lastLsn(), static_cast<std::uint64_t>(threads * perThread));
+    ASSERT_TRUE(journal.waitDurable(journal.lastLsn()));
+    journal.close();
+
+    std::uint64_t firstLsn = 0;
+    std::vector<JournalEntry> entries;
+    GameJournal::readAll(prefix, firstLsn, entries);
+    EXPECT_EQ(firstLsn, 1u);
+    ASSERT_EQ(entries.size(), static_cast<std::size_t>(threads * perThread));
+
+    // Each thread's entries appear in its own append order
+    std::vector<int> next(threads, 0);
+    for (const JournalEntry& e : entries) {
+        ASSERT_EQ(e.op, JournalOp::MOVE);
+        ASSERT_LT(e.session, static_cast<std::uint32_t>(threads));
+        EXPECT_EQ(e.a, next[e.session]++ % 100);
+        EXPECT_EQ(e.b, static_cast<int>(e.session));
+    }
+}
+
+TEST(GameJournalTests, RotatesAndDropsOldSegments) {
+    const std::string prefix = journalPrefix("bg_journal_rotate");
+    GameJournal journal;
+    ASSERT_TRUE(journal.open(prefix, 1));
+    for (int i = 0; i < 10; ++i) journal.append(entryFor(1, JournalOp::PASS));
+    const std::uint64_t boundary = journal.rotate();
+    EXPECT_EQ(boundary, 10u);
+    EXPECT_EQ(journal.durableLsn(), 10u);
+    for (int i = 0; i < 5; ++i) journal.append(entryFor(2, JournalOp::PASS));
+    journal.close();
+
+    std::uint64_t firstLsn = 0;
+    std::vector<JournalEntry> entries;
+    GameJournal::readAll(prefix, firstLsn, entries);
+    EXPECT_EQ(firstLsn, 1u);
+    EXPECT_EQ(entries.size(), 15u);
+
+    GameJournal::removeSegmentsBefore(prefix, boundary + 1);
+    GameJournal::readAll(prefix, firstLsn, entries);
+    EXPECT_EQ(firstLsn, 11u);
+    ASSERT_EQ(entries.size(), 5u);
+    EXPECT_EQ(entries[0].session, 2u);
+
+    // Reopening continues the numbering in a new segment
+    ASSERT_TRUE(journal.open(prefix, firstLsn + entries.size()));
+    EXPECT_EQ(journal.append(entryFor(3, JournalOp::START)), 16u);
+    journal.close();
+    GameJournal::readAll(prefix, firstLsn, entries);
+    ASSERT_EQ(entries.size(), 6u);
+    EXPECT_EQ(entries.back().session, 3u);
+}
+
+TEST(GameJournalTests, StopsAtTornEntry) {
+    const std::string prefix = journalPrefix("bg_journal_torn");
+    {
+        GameJournal journal;
+        ASSERT_TRUE(journal.open(prefix, 1));
+        for (int i = 0; i < 3; ++i) journal.append(entryFor(7, JournalOp::ROLL, 3, 4));
+    }
+    // Half an entry, as left by a crash during a write
+    {
+        std::ofstream out(prefix + ".0000000000000001.log", std::ios::binary | std::ios::app);
+        out.write("\x07\x00\x00", 3);
+    }
+    std::uint64_t firstLsn = 0;
+    std::vector<JournalEntry> entries;
+    GameJournal::readAll(prefix, firstLsn, entries);
+    EXPECT_EQ(entries.size(), 3u);
+
+    // A corrupt check byte ends the journal as well
+    std::uint8_t bytes[JournalEntry::ENCODED_SIZE];
+    entryFor(7, JournalOp::ROLL, 3, 4).encode(bytes);
+    bytes[5] ^= 1;
+    JournalEntry decoded;
+    EXPECT_FALSE(JournalEntry::decode(bytes, decoded));
+}
+
+TEST(GameJournalTests, ReplayReproducesGame) {
+    HeadlessGame game;
+    std::vector<JournalEntry> log;
+    auto record = [&](JournalOp op, int a = 0, int b = 0) { log.push_back(entryFor(1, op, a, b)); };
+
+    game.start();
+    record(JournalOp::START);
+    game.rollOpeningDice(5);
+    record(JournalOp::OPENING_ROLL, 5);
+    game.rollOpeningDice(2);
+    record(JournalOp::OPENING_ROLL, 2);
+    game.startGameAfterOpening();
+    record(JournalOp::START_AFTER_OPENING);
+    ASSERT_EQ(game.getCurrentPlayer(), Color::WHITE);
+    game.rollDice(5, 2);
+    record(JournalOp::ROLL, 5, 2);
+    ASSERT_EQ(game.makeMove(11, 16), MoveResult::SUCCESS);
+    record(JournalOp::MOVE, 11, 16);
+    ASSERT_EQ(game.makeMove(16, 18), MoveResult::SUCCESS);
+    record(JournalOp::MOVE, 16, 18);
+    game.rollDice(6, 6);
+    record(JournalOp::ROLL, 6, 6);
+    game.passTurn();
+    record(JournalOp::PASS);
+
+    HeadlessGame replayed;
+    for (const JournalEntry& e : log) {
+        std::uint8_t bytes[JournalEntry::ENCODED_SIZE];
+        e.encode(bytes);
+        JournalEntry decoded;
+        ASSERT_TRUE(JournalEntry::decode(bytes, decoded));
+        EXPECT_TRUE(decoded.apply(replayed));
+    }
+    EXPECT_EQ(replayed.positionKey(), game.positionKey());
+    EXPECT_EQ(replayed.getPhase(), game.getPhase());
+    EXPECT_EQ(replayed.getCurrentPlayer(), game.getCurrentPlayer());
+    EXPECT_FALSE(entryFor(1, JournalOp::CREATE).apply(replayed));
+}
+
+TEST(GameJournalTests, ReplayRejectsImpossibleDice) {
+    HeadlessGame game;
+    ASSERT_TRUE(entryFor(1, JournalOp::START).apply(game));
+    EXPECT_FALSE(entryFor(1, JournalOp::OPENING_ROLL, 7).apply(game));
+    EXPECT_EQ(game.getPhase(), GamePhase::OPENING_ROLL_WHITE);
+    ASSERT_TRUE(entryFor(1, JournalOp::OPENING_ROLL, 5).apply(game));
+    ASSERT_TRUE(entryFor(1, JournalOp::OPENING_ROLL, 2).apply(game));
+    ASSERT_TRUE(entryFor(1, JournalOp::START_AFTER_OPENING).apply(game));
+    EXPECT_FALSE(entryFor(1, JournalOp::ROLL, 7, 0).apply(game));
+    EXPECT_TRUE(entryFor(1, JournalOp::ROLL, 6, 1).apply(game));
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+
+// =============================
+// OBSERVER TESTS
+// =============================
+
+namespace {
+    struct CountingObserver : IGameObserver {
+        int started = 0;
+        int diceRolled = 0;
+        int turnChanged = 0;
+
+        void onGameStarted() override { ++started; }
+        void onDiceRolled(Color, int, int) override { ++diceRolled; }
+        void onTurnChanged(Color) override { ++turnChanged; }
+    };
+}
+
+TEST(GameObserverTests, GameNotifiesRegisteredObserver) {
+    Game g;
+    CountingObserver obs;
+    g.addObserver(&obs);
+
+    g.start();
+    g.rollOpeningDice();
+
+    EXPECT_EQ(obs.started, 1);
+    EXPECT_EQ(obs.diceRolled, 1);
+}
+
+TEST(GameObserverTests, RemovedObserverIsNotNotified) {
+    Game g;
+    CountingObserver obs;
+    g.addObserver(&obs);
+    g.removeObserver(&obs);
+
+    g.start();
+
+    EXPECT_EQ(obs.started, 0);
+}
+
+TEST(GameObserverTests, HeadlessGameIgnoresObservers) {
+    HeadlessGame g;
+    CountingObserver obs;
+    g.addObserver(&obs);
+
+    g.start();
+    g.rollOpeningDice();
+    g.rollOpeningDice();
+
+    EXPECT_EQ(obs.started, 0);
+    EXPECT_EQ(obs.diceRolled, 0);
+    EXPECT_EQ(g.getPhase(), GamePhase::OPENING_ROLL_COMPARE);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Game.hpp"
+#include "MoveGenerator.hpp"
+
+// =============================
+// WHOLE-PLAY TESTS
+// =============================
+
+namespace {
+    /// Opening layout with white on roll and no dice rolled
+    GameStateDTO openingState() {
+        return GameStateDTO::fromColumns({ 2, 0, 0, 0, 0, -5, 0, -3, 0, 0, 0, 5, -5, 0, 0, 0, 3, 0, 5, 0, 0, 0, 0, -2 },
+                                         0, 0, 0, 0, Color::WHITE);
+    }
+
+    Play playOf(std::initializer_list<std::pair<int, int>> moves) {
+        Play play;
+        for (const auto& m : moves) play.push(m.first, m.second);
+        return play;
+    }
+
+    class CountingObserver : public IGameObserver {
+    public:
+        int moves = 0;
+        int plays = 0;
+        int turns = 0;
+        Play lastPlay;
+
+        void onMoveMade(Color, int, int, MoveResult) override { ++moves; }
+        void onPlayMade(Color, const Play& play) override {
+            ++plays;
+            lastPlay = play;
+        }
+        void onTurnChanged(Color) override { ++turns; }
+    };
+}
+
+TEST(GamePlayTests, PlayIsAppliedWithOneNotification) {
+    Game game;
+    game.loadState(openingState());
+    game.rollDice(3, 1);
+    CountingObserver observer;
+    game.addObserver(&observer);
+
+    EXPECT_EQ(game.makePlay(playOf({ { 16, 19 }, { 18, 19 } })), MoveResult::SUCCESS);
+    EXPECT_EQ(game.getColumnCount(19), 2);
+    EXPECT_EQ(game.getColumnColor(19), Color::WHITE);
+    EXPECT_EQ(game.getCurrentPlayer(), Color::BLACK);
+    EXPECT_EQ(observer.plays, 1);
+    EXPECT_EQ(observer.moves, 0);
+    EXPECT_EQ(observer.turns, 1);
+    EXPECT_EQ(observer.lastPlay.count, 2);
+}
+
+TEST(GamePlayTests, IllegalMoveRollsBackTheWholePlay) {
+    Game game;
+    game.loadState(openingState());
+    game.rollDice(3, 1);
+    CountingObserver observer;
+    game.addObserver(&observer);
+    const GameStateDTO before = game.getState();
+
+    // The first move is legal, the second lands on black's five-checker point
+    EXPECT_EQ(game.makePlay(playOf({ { 16, 19 }, { 11, 12 } })), MoveResult::BLOCKED_BY_OPPONENT);
+    const GameStateDTO after = game.getState();
+    for (int i = 0; i < 24; ++i) EXPECT_EQ(after.pieceCounts[i], before.pieceCounts[i]);
+    EXPECT_EQ(after.dice1, 3);
+    EXPECT_EQ(after.dice2, 1);
+    EXPECT_EQ(game.getCurrentPlayer(), Color::WHITE);
+    EXPECT_EQ(observer.plays + observer.moves + observer.turns, 0);
+}
+
+TEST(GamePlayTests, PlayMustUseEveryPlayableDie) {
+    HeadlessGame game;
+    game.loadState(openingState());
+    game.rollDice(3, 1);
+
+    EXPECT_EQ(game.makePlay(playOf({ { 16, 19 } })), MoveResult::INVALID_MOVE);
+    EXPECT_EQ(game.makePlay(Play()), MoveResult::INVALID_MOVE);
+    EXPECT_EQ(game.getColumnCount(16), 3);
+    EXPECT_EQ(game.getCurrentPlayer(), Color::WHITE);
+}
+
+TEST(GamePlayTests, EmptyPlayPassesWhenBlocked) {
+    HeadlessGame game;
+    GameStateDTO s = openingState();
+    s.barWhite = 1;
+    s.pieceCounts[0] = 1;
+    for (int i = 0; i < 6; ++i) {
+        s.pieceCounts[i] = 2;
+        s.colors[i] = Color::BLACK;
+    }
+    game.loadState(s);
+    game.rollDice(2, 5);
+
+    EXPECT_EQ(game.makePlay(Play()), MoveResult::SUCCESS);
+    EXPECT_EQ(game.getCurrentPlayer(), Color::BLACK);
+    EXPECT_EQ(game.getDice()[0], 0);
+    EXPECT_EQ(game.getDice()[1], 0);
+}
+
+TEST(GamePlayTests, GeneratedPlaysMatchSingleMoves) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> die(1, 6);
+
+    for (int g = 0; g < 20; ++g) {
+        HeadlessGame game;
+        do {
+            game.start();
+            game.rollOpeningDice(die(rng));
+            game.rollOpeningDice(die(rng));
+        } while (game.getOpeningDiceWhite() == game.getOpeningDiceBlack());
+        game.startGameAfterOpening();
+
+        while (game.getPhase() == GamePhase::IN_PROGRESS) {
+            game.rollDice(die(rng), die(rng));
+            const auto plays = MoveGenerator::generatePlays(game);
+            ASSERT_FALSE(plays.empty());
+            for (const GeneratedPlay& p : plays) {
+                HeadlessGame copy = game;
+                ASSERT_EQ(copy.makePlay(p.play), MoveResult::SUCCESS);
+                EXPECT_TRUE(MoveGenerator::samePosition(copy, p.after));
+                EXPECT_EQ(copy.getPhase(), p.after.getPhase());
+                if (copy.getPhase() == GamePhase::IN_PROGRESS) {
+                    EXPECT_EQ(copy.getCurrentPlayer(), p.after.getCurrentPlayer());
+                }
+            }
+            ASSERT_EQ(game.makePlay(plays[rng() % plays.size()].play), MoveResult::SUCCESS);
+        }
+    }
+}
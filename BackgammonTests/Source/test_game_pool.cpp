@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "GamePool.hpp"
+#include "SessionArena.hpp"
+
+// =============================
+// GAME POOL & ARENA TESTS
+// =============================
+
+TEST(GamePoolTests, ReleasedGameIsRecycledAndReset) {
+    GamePool<HeadlessGame> pool(4);
+
+    HeadlessGame* first = nullptr;
+    {
+        auto g = pool.acquire();
+        first = g.get();
+        g->start();
+        g->rollOpeningDice();
+        EXPECT_EQ(g->getPhase(), GamePhase::OPENING_ROLL_BLACK);
+    }
+
+    auto g = pool.acquire();
+    EXPECT_EQ(g.get(), first);
+    EXPECT_EQ(g->getPhase(), GamePhase::NOT_STARTED);
+    EXPECT_EQ(g->getOpeningDiceWhite(), 0);
+}
+
+TEST(GamePoolTests, GrowsBySlab) {
+    GamePool<HeadlessGame> pool(2);
+    auto a = pool.acquire();
+    auto b = pool.acquire();
+    auto c = pool.acquire();
+
+    EXPECT_EQ(pool.capacity(), 4u);
+    EXPECT_EQ(pool.available(), 1u);
+}
+
+TEST(SessionArenaTests, ReleaseReusesInlineStorage) {
+    SessionArena arena;
+    void* first = nullptr;
+    {
+        std::pmr::vector<int> moves(arena.resource());
+        moves.reserve(16);
+        first = moves.data();
+    }
+    arena.release();
+
+    std::pmr::vector<int> moves(arena.resource());
+    moves.reserve(16);
+    EXPECT_EQ(static_cast<void*>(moves.data()), first);
+}
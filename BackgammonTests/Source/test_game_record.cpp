@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "Game.hpp"
+#include "GameRecord.hpp"
+#include "GameRecordStream.hpp"
+#include "GameRecorder.hpp"
+
+// =============================
+// GAME RECORD TESTS
+// =============================
+
+namespace {
+    /// Plays a full game taking the first legal move every time
+    void playFirstMoveGame(Game& g) {
+        do {
+            g.start();
+            g.rollOpeningDice();
+            g.rollOpeningDice();
+        } while (g.getOpeningDiceWhite() == g.getOpeningDiceBlack());
+        g.startGameAfterOpening();
+
+        for (int turn = 0; turn < 5000 && g.getPhase() == GamePhase::IN_PROGRESS; ++turn) {
+            g.rollDice();
+            if (!g.hasMovesAvailable()) {
+                g.passTurn();
+                continue;
+            }
+            const Color mover = g.getCurrentPlayer();
+            while (g.getPhase() == GamePhase::IN_PROGRESS && g.getCurrentPlayer() == mover) {
+                bool moved = false;
+                for (int from = 0; from <= Game::BAR_INDEX && !moved; ++from) {
+                    if (!g.canSelectPoint(from)) continue;
+                    const std::vector<int> targets = g.getLegalTargets(from);
+                    if (!targets.empty()) moved = g.makeMove(from, targets.front()) == MoveResult::SUCCESS;
+                }
+                if (!moved) {
+                    g.passTurn();
+                    break;
+                }
+            }
+        }
+    }
+}
+
+TEST(GameRecordTests, EventCodesRoundTrip) {
+    const GameEvent events[] = {
+        { GameEventType::OPENING_ROLL, 6, 1 }, { GameEventType::ROLL, 5, 5 },
+        { GameEventType::MOVE, Game::BAR_INDEX, 3 }, { GameEventType::MOVE, 2, -1 },
+        { GameEventType::MOVE, 20, 24 }, { GameEventType::PASS, 0, 0 }
+    };
+    for (const GameEvent& e : events) {
+        const GameEvent d = GameEvent::decode(e.encode());
+        EXPECT_EQ(d.type, e.type);
+        EXPECT_EQ(d.a, e.a);
+        EXPECT_EQ(d.b, e.b);
+    }
+}
+
+TEST(GameRecordTests, RecordedGameReplaysToSameFinalState) {
+    Game g;
+    GameRecorder recorder(g);
+    g.addObserver(&recorder);
+    playFirstMoveGame(g);
+    ASSERT_EQ(g.getPhase(), GamePhase::FINISHED);
+
+    std::vector<std::uint8_t> bytes;
+    recorder.record().encode(bytes);
+    GameRecord decoded;
+    std::size_t consumed = 0;
+    ASSERT_TRUE(decoded.decode(bytes.data(), bytes.size(), consumed));
+    EXPECT_EQ(consumed, bytes.size());
+    EXPECT_TRUE(decoded.finished);
+
+    HeadlessGame replayed;
+    ASSERT_TRUE(decoded.replay(replayed));
+    EXPECT_EQ(replayed.getPhase(), GamePhase::FINISHED);
+    EXPECT_EQ(replayed.getBorneOffCount(decoded.winner), 15);
+    for (int i = 0; i < 24; ++i) {
+        EXPECT_EQ(replayed.getColumnCount(i), g.getColumnCount(i));
+    }
+}
+
+TEST(GameRecordTests, PassesWithoutRollOrAfterMovesAreRecorded) {
+    Game g;
+    GameRecorder recorder(g);
+    g.addObserver(&recorder);
+    g.start();
+    g.rollOpeningDice(5);
+    g.rollOpeningDice(2);
+    g.startGameAfterOpening();
+
+    // White passes without rolling, black passes after one of two moves
+    g.passTurn();
+    g.rollDice(6, 4);
+    bool moved = false;
+    for (int from = 0; from <= Game::BAR_INDEX && !moved; ++from) {
+        const std::vector<int> targets = g.getLegalTargets(from);
+        if (!targets.empty()) moved = g.makeMove(from, targets.front()) == MoveResult::SUCCESS;
+    }
+    ASSERT_TRUE(moved);
+    ASSERT_EQ(g.getCurrentPlayer(), Color::BLACK);
+    g.passTurn();
+    g.rollDice(3, 1);
+    ASSERT_EQ(g.makeMove(16, 19), MoveResult::SUCCESS);
+    ASSERT_EQ(g.makeMove(18, 19), MoveResult::SUCCESS);
+
+    const std::vector<GameEvent>& events = recorder.record().events;
+    int passes = 0;
+    for (const GameEvent& e : events) {
+        if (e.type == GameEventType::PASS) ++passes;
+    }
+    EXPECT_EQ(passes, 2);
+
+    HeadlessGame replayed;
+    ASSERT_TRUE(recorder.record().replay(replayed));
+    EXPECT_EQ(replayed.positionKey(), g.positionKey());
+    EXPECT_EQ(replayed.getCurrentPlayer(), Color::BLACK);
+}
+
+TEST(GameRecordTests, ImpossibleDiceAreRejected) {
+    HeadlessGame game;
+    game.start();
+    game.rollOpeningDice(5);
+    game.rollOpeningDice(2);
+    game.startGameAfterOpening();
+
+    // Dice are 3-bit fields in a record, so 0 and 7 can be read from a damaged file
+    EXPECT_FALSE(GameRecord::applyEvent(game, GameEvent{ GameEventType::ROLL, 7, 0 }));
+    EXPECT_FALSE(GameRecord::applyEvent(game, GameEvent{ GameEventType::MOVE, 24, 3 }));
+    EXPECT_TRUE(GameRecord::applyEvent(game, GameEvent{ GameEventType::ROLL, 6, 1 }));
+
+    GameRecord record;
+    record.events.push_back({ GameEventType::OPENING_ROLL, 5, 2 });
+    record.events.push_back({ GameEventType::ROLL, 7, 0 });
+    std::vector<std::uint8_t> bytes;
+    record.encode(bytes);
+    GameRecord decoded;
+    std::size_t consumed = 0;
+    EXPECT_FALSE(decoded.decode(bytes.data(), bytes.size(), consumed));
+}
+
+TEST(GameRecordTests, CustomStartPositionRoundTrips) {
+    GameRecord record;
+    record.standardStart = false;
+    record.gameId = 123456789;
+    record.startPosition.pieceCounts[23] = 2;
+    record.startPosition.colors[23] = Color::WHITE;
+    record.startPosition.pieceCounts[0] = 1;
+    record.startPosition.colors[0] = Color::BLACK;
+    record.startPosition.borneOffWhite = 13;
+    record.startPosition.borneOffBlack = 14;
+    record.startPosition.currentPlayer = Color::WHITE;
+    record.events.push_back({ GameEventType::ROLL, 1, 2 });
+    record.events.push_back({ GameEventType::MOVE, 23, 24 });
+    record.events.push_back({ GameEventType::MOVE, 23, 24 });
+
+    std::vector<std::uint8_t> bytes;
+    record.encode(bytes);
+    GameRecord decoded;
+    std::size_t consumed = 0;
+    ASSERT_TRUE(decoded.decode(bytes.data(), bytes.size(), consumed));
+    EXPECT_EQ(decoded.gameId, 123456789u);
+    EXPECT_EQ(decoded.startPosition.pieceCounts[0], 1);
+    EXPECT_EQ(decoded.startPosition.colors[0], Color::BLACK);
+
+    HeadlessGame replayed;
+    ASSERT_TRUE(decoded.replay(replayed));
+    EXPECT_EQ(replayed.getPhase(), GamePhase::FINISHED);
+}
+
+TEST(GameRecordTests, StreamWriterAndReaderRoundTrip) {
+    std::stringstream file(std::ios::in | std::ios::out | std::ios::binary);
+    std::vector<GameRecord> written;
+    {
+        GameRecordWriter writer(file);
+        Game g;
+        GameRecorder recorder(g, &writer);
+        g.addObserver(&recorder);
+        for (int i = 0; i < 20; ++i) {
+            recorder.setGameId(static_cast<std::uint64_t>(i));
+            playFirstMoveGame(g);
+            written.push_back(recorder.record());
+        }
+        EXPECT_TRUE(writer.finish());
+        EXPECT_EQ(writer.recordCount(), 20u);
+    }
+
+    GameRecordReader reader(file);
+    GameRecord record;
+    std::size_t count = 0;
+    while (reader.next(record)) {
+        ASSERT_LT(count, written.size());
+        EXPECT_EQ(record.gameId, written[count].gameId);
+        EXPECT_EQ(record.events.size(), written[count].events.size());
+        ++count;
+    }
+    EXPECT_FALSE(reader.failed());
+    EXPECT_EQ(count, written.size());
+}
@@ -0,0 +1,329 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "GameJournal.hpp"
+#include "GameServer.hpp"
+#include "ServerClient.hpp"
+
+// =============================
+// GAME SERVER TESTS
+// =============================
+
+namespace {
+    std::string socketPath(const char* name) {
+        return ::testing::TempDir() + "bg_" + name + "_" + std::to_string(::getpid()) + ".sock";
+    }
+
+    Protocol::Request request(Protocol::Opcode opcode, std::uint32_t session = 0, int arg0 = 0, int arg1 = 0) {
+        Protocol::Request r;
+        r.opcode = opcode;
+        r.session = session;
+        r.arg0 = static_cast<std::int8_t>(arg0);
+        r.arg1 = static_cast<std::int8_t>(arg1);
+        return r;
+    }
+
+    std::uint32_t idOf(const std::vector<std::uint8_t>& payload) {
+        return static_cast<std::uint32_t>(payload[0]) | (static_cast<std::uint32_t>(payload[1]) << 8) |
+               (static_cast<std::uint32_t>(payload[2]) << 16) | (static_cast<std::uint32_t>(payload[3]) << 24);
+    }
+}
+
+TEST(GameServerTests, ProtocolFramesRoundTrip) {
+    Protocol::Request play = request(Protocol::Opcode::PLAY, 0x01020304u);
+    play.play.push(16, 19);
+    play.play.push(18, 19);
+    std::vector<std::uint8_t> bytes;
+    Protocol::encodeRequest(play, bytes);
+    Protocol::encodeRequest(request(Protocol::Opcode::MOVE, 7, 11, -1), bytes);
+
+    Protocol::Request decoded;
+    std::size_t consumed = 0;
+    ASSERT_EQ(Protocol::decodeRequest(bytes.data(), bytes.size(), decoded, consumed), Protocol::DecodeResult::COMPLETE);
+    EXPECT_EQ(decoded.opcode, Protocol::Opcode::PLAY);
+    EXPECT_EQ(decoded.session, 0x01020304u);
+    ASSERT_EQ(decoded.play.count, 2);
+    EXPECT_EQ(decoded.play.moves[1].fromIndex, 18);
+
+    const std::size_t second = consumed;
+    EXPECT_EQ(Protocol::decodeRequest(bytes.data() + second, 3, decoded, consumed), Protocol::DecodeResult::INCOMPLETE);
+    ASSERT_EQ(Protocol::decodeRequest(bytes.data() + second, bytes.size() - second, decoded, consumed),
+              Protocol::DecodeResult::COMPLETE);
+    EXPECT_EQ(decoded.arg0, 11);
+    EXPECT_EQ(decoded.arg1, -1);
+
+    const std::uint8_t empty[2] = { 0, 0 };
+    EXPECT_EQ(Protocol::decodeRequest(empty, sizeof(empty), decoded, consumed), Protocol::DecodeResult::MALFORMED);
+
+    HeadlessGame game;
+    game.start();
+    game.rollOpeningDice(5);
+    game.rollOpeningDice(2);
+    game.startGameAfterOpening();
+    game.rollDice(3, 1);
+    std::vector<std::uint8_t> update;
+    Protocol::encodeUpdate(9, game.getState(), game.getPhase(), update);
+    ASSERT_EQ(update.size(), Protocol::LENGTH_PREFIX_SIZE + Protocol::UPDATE_BODY_SIZE);
+
+    Protocol::Status status = Protocol::Status::OK;
+    const std::uint8_t* payload = nullptr;
+    std::size_t payloadSize = 0;
+    ASSERT_EQ(Protocol::decodeResponse(update.data(), update.size(), status, payload, payloadSize, consumed),
+              Protocol::DecodeResult::COMPLETE);
+    EXPECT_EQ(status, Protocol::Status::UPDATE);
+    ASSERT_EQ(payloadSize, 4 + Protocol::STATE_SIZE);
+    GameStateDTO state;
+    GamePhase phase = GamePhase::NOT_STARTED;
+    Protocol::decodeState(payload + 4, state, phase);
+    EXPECT_EQ(phase, GamePhase::IN_PROGRESS);
+    EXPECT_EQ(state.dice1, 3);
+    EXPECT_EQ(state.pieceCounts, game.getState().pieceCounts);
+    EXPECT_EQ(state.colors, game.getState().colors);
+}
+
+TEST(GameServerTests, AnswersRequestsOverTheSocket) {
+    ServerConfig config;
+    config.unixSocketPath = socketPath("requests");
+    config.workerCount = 2;
+    GameServer server(config);
+    ASSERT_TRUE(server.start());
+
+    ServerClient client;
+    ASSERT_TRUE(client.connectUnix(config.unixSocketPath));
+    std::vector<std::uint8_t> payload;
+    ASSERT_EQ(client.call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+    ASSERT_EQ(payload.size(), 4u);
+    const std::uint32_t id = idOf(payload);
+    EXPECT_TRUE(server.sessions().withSession(id, [](Session&) {}));
+
+    EXPECT_EQ(client.call(request(Protocol::Opcode::START, id), payload), Protocol::Status::OK);
+    EXPECT_TRUE(payload.empty());
+    ASSERT_EQ(client.call(request(Protocol::Opcode::STATE, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(payload.size(), Protocol::STATE_SIZE);
+    GameStateDTO state;
+    GamePhase phase = GamePhase::NOT_STARTED;
+    Protocol::decodeState(payload.data(), state, phase);
+    EXPECT_EQ(phase, GamePhase::OPENING_ROLL_WHITE);
+    EXPECT_EQ(state.pieceCounts[11], 5);
+
+    // A move before the opening is decided is answered with the engine's result
+    ASSERT_EQ(client.call(request(Protocol::Opcode::MOVE, id, 11, 16), payload), Protocol::Status::OK);
+    ASSERT_EQ(payload.size(), 1u);
+    EXPECT_NE(static_cast<MoveResult>(payload[0]), MoveResult::SUCCESS);
+
+    // Roll until the opening is decided, then the roll returns two dice
+    for (int i = 0; i < 100 && phase != GamePhase::IN_PROGRESS; ++i) {
+        client.call(request(Protocol::Opcode::ROLL_OPENING, id), payload);
+        client.call(request(Protocol::Opcode::ROLL_OPENING, id), payload);
+        client.call(request(Protocol::Opcode::START_AFTER_OPENING, id), payload);
+        client.call(request(Protocol::Opcode::STATE, id), payload);
+        Protocol::decodeState(payload.data(), state, phase);
+    }
+    ASSERT_EQ(phase, GamePhase::IN_PROGRESS);
+    ASSERT_EQ(client.call(request(Protocol::Opcode::ROLL, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(payload.size(), 2u);
+    EXPECT_GE(payload[0], 1);
+    EXPECT_LE(payload[0], 6);
+
+    ASSERT_EQ(client.call(request(Protocol::Opcode::LEGAL_TARGETS, id, 11), payload), Protocol::Status::OK);
+    ASSERT_FALSE(payload.empty());
+    EXPECT_EQ(payload.size(), 1u + payload[0]);
+
+    EXPECT_EQ(client.call(request(Protocol::Opcode::STATE, id + 2), payload), Protocol::Status::UNKNOWN_SESSION);
+    EXPECT_EQ(client.call(request(static_cast<Protocol::Opcode>(0x7F), id), payload), Protocol::Status::BAD_REQUEST);
+
+    EXPECT_EQ(client.call(request(Protocol::Opcode::CLOSE, id), payload), Protocol::Status::OK);
+    EXPECT_EQ(client.call(request(Protocol::Opcode::CLOSE, id), payload), Protocol::Status::UNKNOWN_SESSION);
+    EXPECT_FALSE(server.sessions().withSession(id, [](Session&) {}));
+    server.stop();
+}
+
+TEST(GameServerTests, SessionsLiveInTheShardOfTheirWorker) {
+    ServerConfig config;
+    config.unixSocketPath = socketPath("shards");
+    config.workerCount = 3;
+    GameServer server(config);
+    ASSERT_TRUE(server.start());
+    ASSERT_EQ(server.sessions().shardCount(), 3u);
+
+    // Every connection creates in its own worker's shard, and can use sessions of any shard
+    std::vector<std::uint32_t> ids;
+    for (int c = 0; c < 6; ++c) {
+        ServerClient client;
+        ASSERT_TRUE(client.connectUnix(config.unixSocketPath));
+        std::vector<std::uint8_t> payload;
+        ASSERT_EQ(client.call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+        const std::uint32_t first = idOf(payload);
+        ASSERT_EQ(client.call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+        EXPECT_EQ(idOf(payload) % 3, first % 3);
+        ids.push_back(first);
+        for (std::uint32_t id : ids) {
+            EXPECT_EQ(client.call(request(Protocol::Opcode::START, id), payload), Protocol::Status::OK);
+        }
+    }
+    EXPECT_EQ(server.sessions().size(), 12u);
+    server.stop();
+}
+
+TEST(GameServerTests, LaggingSpectatorIsDisconnected) {
+    ServerConfig config;
+    config.unixSocketPath = socketPath("lagging");
+    config.workerCount = 2;
+    config.spectatorBacklog = 1024;
+    GameServer server(config);
+    ASSERT_TRUE(server.start());
+
+    ServerClient player;
+    ServerClient spectator;
+    ASSERT_TRUE(player.connectUnix(config.unixSocketPath));
+    ASSERT_TRUE(spectator.connectUnix(config.unixSocketPath));
+    std::vector<std::uint8_t> payload;
+    ASSERT_EQ(player.call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+    const std::uint32_t id = idOf(payload);
+    ASSERT_EQ(spectator.call(request(Protocol::Opcode::SUBSCRIBE, id), payload), Protocol::Status::OK);
+
+    // The spectator stops reading; once the socket buffer and the backlog fill up it is dropped
+    auto watchers = [&] {
+        std::size_t count = 0;
+        server.sessions().withSession(id, [&](Session& session) { count = session.spectators.size(); });
+        return count;
+    };
+    int changes = 0;
+    for (; changes < 100000 && watchers() > 0; ++changes) {
+        ASSERT_EQ(player.call(request(Protocol::Opcode::START, id), payload), Protocol::Status::OK);
+    }
+    EXPECT_EQ(watchers(), 0u);
+
+    // What was sent before the drop can still be read, then the stream ends
+    std::uint32_t session = 0;
+    GameStateDTO state;
+    GamePhase phase = GamePhase::NOT_STARTED;
+    int received = 0;
+    while (spectator.nextUpdate(session, state, phase)) ++received;
+    EXPECT_LT(received, changes);
+
+    // The player is not affected
+    EXPECT_EQ(player.call(request(Protocol::Opcode::STATE, id), payload), Protocol::Status::OK);
+    server.stop();
+}
+
+TEST(GameServerTests, UpdatesReachSpectatorsOfOtherWorkers) {
+    ServerConfig config;
+    config.unixSocketPath = socketPath("crossworker");
+    config.workerCount = 2;
+    GameServer server(config);
+    ASSERT_TRUE(server.start());
+
+    // The shard of a created session tells which worker serves the connection
+    std::vector<std::unique_ptr<ServerClient>> clients;
+    std::vector<std::uint32_t> owned;
+    std::vector<std::uint8_t> payload;
+    auto connect = [&] {
+        clients.push_back(std::make_unique<ServerClient>());
+        EXPECT_TRUE(clients.back()->connectUnix(config.unixSocketPath));
+        EXPECT_EQ(clients.back()->call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+        owned.push_back(idOf(payload));
+        return clients.size() - 1;
+    };
+    const std::size_t player = connect();
+    std::vector<std::size_t> remote;
+    for (int i = 0; i < 64 && remote.size() < 2; ++i) {
+        const std::size_t c = connect();
+        if (owned[c] % 2 != owned[player] % 2) remote.push_back(c);
+    }
+    ASSERT_EQ(remote.size(), 2u) << "accepts never reached the other worker";
+    const std::uint32_t id = owned[player];
+    ServerClient& closing = *clients[remote[0]];
+    ServerClient& watching = *clients[remote[1]];
+    ASSERT_EQ(closing.call(request(Protocol::Opcode::SUBSCRIBE, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(watching.call(request(Protocol::Opcode::SUBSCRIBE, id), payload), Protocol::Status::OK);
+
+    std::uint32_t session = 0;
+    GameStateDTO state;
+    GamePhase phase = GamePhase::NOT_STARTED;
+    ASSERT_EQ(clients[player]->call(request(Protocol::Opcode::START, id), payload), Protocol::Status::OK);
+    ASSERT_TRUE(closing.nextUpdate(session, state, phase));
+    EXPECT_EQ(session, id);
+    ASSERT_TRUE(watching.nextUpdate(session, state, phase));
+    EXPECT_EQ(phase, GamePhase::OPENING_ROLL_WHITE);
+
+    // A new connection takes the socket number of the closed spectator
+    clients[remote[0]].reset();
+    for (int i = 0; i < 1000; ++i) {
+        std::size_t count = 0;
+        server.sessions().withSession(id, [&](Session& s) { count = s.spectators.size(); });
+        if (count == 1) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ServerClient newcomer;
+    ASSERT_TRUE(newcomer.connectUnix(config.unixSocketPath));
+    ASSERT_EQ(newcomer.call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+    const std::uint32_t own = idOf(payload);
+    ASSERT_EQ(newcomer.call(request(Protocol::Opcode::SUBSCRIBE, own), payload), Protocol::Status::OK);
+
+    // Updates of the watched session go to the live spectator only, in order
+    ASSERT_EQ(clients[player]->call(request(Protocol::Opcode::START, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(clients[player]->call(request(Protocol::Opcode::START, own), payload), Protocol::Status::OK);
+    ASSERT_TRUE(watching.nextUpdate(session, state, phase));
+    EXPECT_EQ(session, id);
+    ASSERT_TRUE(newcomer.nextUpdate(session, state, phase));
+    EXPECT_EQ(session, own);
+    server.stop();
+}
+
+TEST(GameServerTests, IgnoredRequestsAreNotJournaledOrBroadcast) {
+    const std::string prefix = ::testing::TempDir() + "bg_server_noop_" + std::to_string(::getpid());
+    ServerConfig config;
+    config.unixSocketPath = socketPath("noop");
+    config.workerCount = 2;
+    config.journalPath = prefix;
+    config.snapshotInterval = 0;
+    GameServer server(config);
+    std::size_t recovered = 0;
+    std::size_t replayed = 0;
+    ASSERT_TRUE(server.recover(recovered, replayed));
+    EXPECT_EQ(recovered, 0u);
+    ASSERT_TRUE(server.start());
+
+    ServerClient player;
+    ServerClient spectator;
+    ASSERT_TRUE(player.connectUnix(config.unixSocketPath));
+    ASSERT_TRUE(spectator.connectUnix(config.unixSocketPath));
+    std::vector<std::uint8_t> payload;
+    ASSERT_EQ(player.call(request(Protocol::Opcode::CREATE), payload), Protocol::Status::OK);
+    const std::uint32_t id = idOf(payload);
+    ASSERT_EQ(spectator.call(request(Protocol::Opcode::SUBSCRIBE, id), payload), Protocol::Status::OK);
+
+    // Passing or ending the opening is ignored before the game and during the opening rolls
+    ASSERT_EQ(player.call(request(Protocol::Opcode::PASS, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(player.call(request(Protocol::Opcode::START_AFTER_OPENING, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(player.call(request(Protocol::Opcode::START, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(player.call(request(Protocol::Opcode::START_AFTER_OPENING, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(player.call(request(Protocol::Opcode::PASS, id), payload), Protocol::Status::OK);
+    ASSERT_EQ(player.call(request(Protocol::Opcode::ROLL_OPENING, id), payload), Protocol::Status::OK);
+
+    // The spectator sees exactly the two changes
+    std::uint32_t session = 0;
+    GameStateDTO state;
+    GamePhase phase = GamePhase::NOT_STARTED;
+    ASSERT_TRUE(spectator.nextUpdate(session, state, phase));
+    EXPECT_EQ(phase, GamePhase::OPENING_ROLL_WHITE);
+    ASSERT_TRUE(spectator.nextUpdate(session, state, phase));
+    EXPECT_EQ(phase, GamePhase::OPENING_ROLL_BLACK);
+    server.stop();
+
+    std::uint64_t firstLsn = 0;
+    std::vector<JournalEntry> entries;
+    GameJournal::readAll(prefix, firstLsn, entries);
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].op, JournalOp::CREATE);
+    EXPECT_EQ(entries[1].op, JournalOp::START);
+    EXPECT_EQ(entries[2].op, JournalOp::OPENING_ROLL);
+    GameJournal::removeSegmentsBefore(prefix, UINT64_MAX);
+    std::remove((prefix + ".snapshot").c_str());
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "Game.hpp"
+#include "Instrumentation.hpp"
+
+// =============================
+// INSTRUMENTATION TESTS
+// =============================
+
+TEST(InstrumentationTests, RecordFillsLog2Histogram) {
+    Instrumentation::reset();
+    Instrumentation::record(InstrumentedOp::GET_STATE, 1);
+    Instrumentation::record(InstrumentedOp::GET_STATE, 1000);
+    Instrumentation::record(InstrumentedOp::GET_STATE, 1024);
+    Instrumentation::record(InstrumentedOp::GET_STATE, 1025);
+
+    // Bucket i ends at 2^i inclusive
+    const OpMetrics m = Instrumentation::snapshot(InstrumentedOp::GET_STATE);
+    EXPECT_EQ(m.calls, 4u);
+    EXPECT_EQ(m.totalNanoseconds, 3050u);
+    EXPECT_EQ(m.buckets[0], 1u);
+    EXPECT_EQ(m.buckets[10], 2u);
+    EXPECT_EQ(m.buckets[11], 1u);
+    Instrumentation::reset();
+}
+
+TEST(InstrumentationTests, ExportsJsonAndPrometheus) {
+    Instrumentation::reset();
+    Instrumentation::record(InstrumentedOp::MAKE_MOVE, 300);
+
+    std::ostringstream json;
+    Instrumentation::write(json, Instrumentation::Format::JSON);
+    EXPECT_NE(json.str().find("{\"op\":\"make_move\",\"calls\":1,\"total_ns\":300"), std::string::npos);
+
+    std::ostringstream prom;
+    Instrumentation::write(prom, Instrumentation::Format::PROMETHEUS);
+    EXPECT_NE(prom.str().find("# TYPE backgammon_op_duration_seconds histogram"), std::string::npos);
+    EXPECT_NE(prom.str().find("backgammon_op_duration_seconds_count{op=\"make_move\"} 1"), std::string::npos);
+    EXPECT_NE(prom.str().find("backgammon_op_duration_seconds_bucket{op=\"make_move\",le=\"+Inf\"} 1"), std::string::npos);
+    Instrumentation::reset();
+}
+
+TEST(InstrumentationTests, PrometheusBucketsAreInclusive) {
+    Instrumentation::reset();
+    Instrumentation::record(InstrumentedOp::MAKE_MOVE, 512);
+    Instrumentation::record(InstrumentedOp::MAKE_MOVE, std::uint64_t{ 1 } << 45);
+
+    // A call of exactly 2^9 ns is within le=2^9 ns; the overflow bucket only shows under +Inf
+    std::ostringstream prom;
+    Instrumentation::write(prom, Instrumentation::Format::PROMETHEUS);
+    const std::string text = prom.str();
+    EXPECT_NE(text.find("backgammon_op_duration_seconds_bucket{op=\"make_move\",le=\"2.56e-07\"} 0"), std::string::npos);
+    EXPECT_NE(text.find("backgammon_op_duration_seconds_bucket{op=\"make_move\",le=\"5.12e-07\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("backgammon_op_duration_seconds_bucket{op=\"make_move\",le=\"274.878\"} 1"), std::string::npos);
+    EXPECT_EQ(text.find("backgammon_op_duration_seconds_bucket{op=\"make_move\",le=\"549.756\"}"), std::string::npos);
+    EXPECT_NE(text.find("backgammon_op_duration_seconds_bucket{op=\"make_move\",le=\"+Inf\"} 2"), std::string::npos);
+    Instrumentation::reset();
+}
+
+TEST(InstrumentationTests, GameEntryPointsAreCountedWhenEnabled) {
+    Instrumentation::reset();
+    HeadlessGame game;
+    game.getState();
+    game.hasMovesAvailable();
+
+    const std::uint64_t expected = Instrumentation::ENABLED ? 1u : 0u;
+    EXPECT_EQ(Instrumentation::snapshot(InstrumentedOp::GET_STATE).calls, expected);
+    EXPECT_EQ(Instrumentation::snapshot(InstrumentedOp::HAS_MOVES_AVAILABLE).calls, expected);
+    Instrumentation::reset();
+}
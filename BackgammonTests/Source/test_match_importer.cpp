@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "MatchImporter.hpp"
+
+// =============================
+// MATCH IMPORTER TESTS
+// =============================
+
+namespace {
+    const std::string TRANSCRIPT =
+        " 1 point match\n"
+        "\n"
+        " Game 1\n"
+        " Alice : 0                            Bob : 0\n"
+        "  1) 31: 8/5 6/5                      64: 24/14\n"
+        "  2) 52: 13/8 13/11*                  Doubles => 2\n"
+        "  3)  Drops\n"
+        "      Wins 1 point\n"
+        "\n"
+        " Game 2\n"
+        " Alice : 1                            Bob : 0\n"
+        "  1)                                  42: 8/4 6/4\n"
+        "  2) 66: 24/18(2) 13/7(2)\n";
+}
+
+TEST(MatchImporterTests, SplitsTranscriptIntoGames) {
+    const auto games = MatchImporter::splitGames(TRANSCRIPT);
+    ASSERT_EQ(games.size(), 2u);
+    EXPECT_EQ(games[0].find("Game 1"), 1u);
+    EXPECT_EQ(games[1].find("Game 2"), 1u);
+}
+
+TEST(MatchImporterTests, ImportsAndValidatesGame) {
+    const auto games = MatchImporter::splitGames(TRANSCRIPT);
+    GameRecord record;
+    std::string error;
+    ASSERT_TRUE(MatchImporter::importGame(games[0], record, error)) << error;
+
+    // Opening, then three turns; Bob's 24/14 is split into two checker moves
+    ASSERT_EQ(record.events.size(), 10u);
+    EXPECT_EQ(record.events[0].type, GameEventType::OPENING_ROLL);
+    EXPECT_EQ(record.events[0].a, 3);
+    EXPECT_EQ(record.events[0].b, 1);
+    EXPECT_FALSE(record.finished);
+
+    HeadlessGame game;
+    ASSERT_TRUE(record.replay(game));
+    EXPECT_EQ(game.getBarCount(Color::BLACK), 1);
+    EXPECT_EQ(game.getCurrentPlayer(), Color::BLACK);
+}
+
+TEST(MatchImporterTests, RejectsDoublesPlayedFourTimes) {
+    const auto games = MatchImporter::splitGames(TRANSCRIPT);
+    GameRecord record;
+    std::string error;
+    EXPECT_FALSE(MatchImporter::importGame(games[1], record, error));
+    EXPECT_NE(error.find("doubles"), std::string::npos);
+}
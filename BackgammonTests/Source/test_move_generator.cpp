@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "MoveGenerator.hpp"
+
+// =============================
+// MOVE GENERATOR TESTS
+// =============================
+
+namespace {
+    /// Opening layout with white on roll and no dice rolled
+    GameStateDTO openingState() {
+        return GameStateDTO::fromColumns({ 2, 0, 0, 0, 0, -5, 0, -3, 0, 0, 0, 5, -5, 0, 0, 0, 3, 0, 5, 0, 0, 0, 0, -2 },
+                                         0, 0, 0, 0, Color::WHITE);
+    }
+}
+
+TEST(MoveGeneratorTests, EveryPlayHandsOverTheTurn) {
+    HeadlessGame game;
+    game.loadState(openingState());
+    game.rollDice(3, 1);
+
+    const auto plays = MoveGenerator::generatePlays(game);
+    ASSERT_FALSE(plays.empty());
+    for (const auto& p : plays) {
+        EXPECT_EQ(p.play.count, 2);
+        EXPECT_EQ(p.after.getCurrentPlayer(), Color::BLACK);
+    }
+}
+
+TEST(MoveGeneratorTests, TranspositionsAreReportedOnce) {
+    HeadlessGame game;
+    game.loadState(openingState());
+    game.rollDice(3, 1);
+
+    const auto plays = MoveGenerator::generatePlays(game);
+    for (std::size_t i = 0; i < plays.size(); ++i) {
+        for (std::size_t j = i + 1; j < plays.size(); ++j) {
+            EXPECT_FALSE(MoveGenerator::samePosition(plays[i].after, plays[j].after));
+        }
+    }
+}
+
+TEST(MoveGeneratorTests, BlockedPlayerPasses) {
+    HeadlessGame game;
+    GameStateDTO s = openingState();
+    s.barWhite = 1;
+    s.pieceCounts[0] = 1;
+    for (int i = 0; i < 6; ++i) {
+        s.pieceCounts[i] = 2;
+        s.colors[i] = Color::BLACK;
+    }
+    game.loadState(s);
+    game.rollDice(2, 5);
+
+    const auto plays = MoveGenerator::generatePlays(game);
+    ASSERT_EQ(plays.size(), 1u);
+    EXPECT_EQ(plays[0].play.count, 0);
+    EXPECT_EQ(plays[0].after.getCurrentPlayer(), Color::BLACK);
+}
+
+TEST(MoveGeneratorTests, ImpossibleDiceAreIgnored) {
+    HeadlessGame game;
+    game.start();
+    game.rollOpeningDice(7);
+    EXPECT_EQ(game.getPhase(), GamePhase::OPENING_ROLL_WHITE);
+
+    // 7 and 0 would otherwise make moves like 11->18 legal
+    game.loadState(openingState());
+    game.rollDice(7, 0);
+    EXPECT_EQ(game.getDice()[0], 0);
+    EXPECT_TRUE(game.getLegalTargets(11).empty());
+}
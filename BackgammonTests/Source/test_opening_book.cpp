@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Board.hpp"
+#include "Game.hpp"
+#include "HeuristicEvaluator.hpp"
+#include "OpeningBook.hpp"
+
+// =============================
+// OPENING BOOK TESTS
+// =============================
+
+namespace {
+    /// Sorted (from, to) pairs of a play, independent of move order
+    std::vector<std::pair<int, int>> movesOf(const Play& play) {
+        std::vector<std::pair<int, int>> moves;
+        for (int i = 0; i < play.count; ++i) moves.emplace_back(play.moves[i].fromIndex, play.moves[i].toIndex);
+        std::sort(moves.begin(), moves.end());
+        return moves;
+    }
+
+    HeadlessGame startWithRoll(Color onRoll, int die1, int die2) {
+        HeadlessGame game(PositionId::encode(Board(), onRoll), onRoll);
+        game.rollDice(die1, die2);
+        return game;
+    }
+}
+
+TEST(OpeningBookTests, HeuristicMakesTheFivePointWithThreeOne) {
+    Play white;
+    Play black;
+    float whiteEquity = 0.0f;
+    float blackEquity = 0.0f;
+    ASSERT_TRUE(HeuristicEvaluator::bestPlay(startWithRoll(Color::WHITE, 3, 1), white, whiteEquity));
+    ASSERT_TRUE(HeuristicEvaluator::bestPlay(startWithRoll(Color::BLACK, 3, 1), black, blackEquity));
+
+    // 8/5 6/5 for both colors
+    EXPECT_EQ(movesOf(white), (std::vector<std::pair<int, int>>{ { 16, 19 }, { 18, 19 } }));
+    EXPECT_EQ(movesOf(black), (std::vector<std::pair<int, int>>{ { 5, 4 }, { 7, 4 } }));
+    EXPECT_FLOAT_EQ(whiteEquity, blackEquity);
+}
+
+TEST(OpeningBookTests, RankedPlaysStartWithBestPlay) {
+    const HeadlessGame game = startWithRoll(Color::WHITE, 6, 4);
+    Play best;
+    float bestEquity = 0.0f;
+    ASSERT_TRUE(HeuristicEvaluator::bestPlay(game, best, bestEquity));
+
+    std::vector<RankedPlay> ranked;
+    ASSERT_TRUE(HeuristicEvaluator::rankPlays(game, 3, ranked));
+    ASSERT_EQ(ranked.size(), 3u);
+    EXPECT_EQ(movesOf(ranked[0].play), movesOf(best));
+    EXPECT_FLOAT_EQ(ranked[0].equity, bestEquity);
+    EXPECT_GE(ranked[0].equity, ranked[1].equity);
+    EXPECT_GE(ranked[1].equity, ranked[2].equity);
+
+    const std::atomic<bool> cancelled(true);
+    EXPECT_FALSE(HeuristicEvaluator::rankPlays(game, 3, ranked, &cancelled));
+    EXPECT_TRUE(ranked.empty());
+}
+
+TEST(OpeningBookTests, LookupServesBothColors) {
+    const std::string path = ::testing::TempDir() + "bg_opening_book.bgb";
+    std::vector<OpeningBookEntry> entries;
+    for (int d1 = 1; d1 <= 6; ++d1) {
+        for (int d2 = d1 + 1; d2 <= 6; ++d2) {
+            OpeningBookEntry entry;
+            entry.key = PositionId::encode(Board(), Color::WHITE);
+            entry.die1 = d2; // stored under the same roll whichever die comes first
+            entry.die2 = d1;
+            entry.onRoll = Color::WHITE;
+            ASSERT_TRUE(HeuristicEvaluator::bestPlay(startWithRoll(Color::WHITE, d1, d2), entry.play, entry.equity));
+            entries.push_back(entry);
+        }
+    }
+    ASSERT_TRUE(OpeningBook::write(path, entries));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    EXPECT_EQ(book.size(), 15u);
+
+    for (Color onRoll : { Color::WHITE, Color::BLACK }) {
+        HeadlessGame game = startWithRoll(onRoll, 6, 1);
+        Play fromBook;
+        float equity = 0.0f;
+        ASSERT_TRUE(book.lookup(game, fromBook, equity));
+
+        Play searched;
+        float searchedEquity = 0.0f;
+        ASSERT_TRUE(HeuristicEvaluator::bestPlay(game, searched, searchedEquity));
+        EXPECT_EQ(movesOf(fromBook), movesOf(searched));
+        EXPECT_FLOAT_EQ(equity, searchedEquity);
+
+        for (int i = 0; i < fromBook.count; ++i) {
+            EXPECT_EQ(game.makeMove(fromBook.moves[i].fromIndex, fromBook.moves[i].toIndex), MoveResult::SUCCESS);
+        }
+    }
+
+    Play play;
+    float equity = 0.0f;
+    EXPECT_FALSE(book.lookup(startWithRoll(Color::WHITE, 3, 3), play, equity));
+    book.close();
+    std::remove(path.c_str());
+}
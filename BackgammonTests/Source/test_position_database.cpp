@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Board.hpp"
+#include "Game.hpp"
+#include "PositionDatabase.hpp"
+
+// =============================
+// POSITION DATABASE TESTS
+// =============================
+
+namespace {
+    std::string databasePath(const char* name) {
+        const std::string path = ::testing::TempDir() + name;
+        std::remove((path + ".dat").c_str());
+        std::remove((path + ".idx").c_str());
+        return path;
+    }
+
+    /// Distinct keys; the database does not require them to be legal positions
+    PositionKey keyFor(int i) {
+        PositionKey key = PositionId::encode(Board(), Color::WHITE);
+        key[8] = static_cast<std::uint8_t>(i);
+        key[9] = static_cast<std::uint8_t>(i >> 8);
+        return key;
+    }
+
+    PositionAnalysis analysisFor(int i) {
+        PositionAnalysis a;
+        a.equity = static_cast<float>(i) / 1000.0f;
+        a.winChance = 0.5f;
+        a.gammonChance = 0.125f;
+        a.depth = static_cast<std::uint8_t>(i % 7);
+        a.timestamp = 1700000000ull + static_cast<std::uint64_t>(i);
+        a.bestPlay.push(Game::BAR_INDEX, 3);
+        a.bestPlay.push(3, 5);
+        return a;
+    }
+}
+
+TEST(PositionDatabaseTests, StoresAndReopens) {
+    const std::string path = databasePath("bg_posdb_reopen");
+    const int count = 5000; // several index growths
+    {
+        PositionDatabase db;
+        ASSERT_TRUE(db.open(path));
+        for (int i = 0; i < count; ++i) {
+            ASSERT_TRUE(db.store(keyFor(i), 6, 1, analysisFor(i)));
+        }
+        // Same position, other roll and the pre-roll entry are separate entries
+        ASSERT_TRUE(db.store(keyFor(0), 0, 0, analysisFor(42)));
+        ASSERT_TRUE(db.store(keyFor(0), 1, 6, analysisFor(7))); // replaces 6-1
+        EXPECT_EQ(db.size(), static_cast<std::size_t>(count + 1));
+        EXPECT_TRUE(db.flush());
+    }
+
+    PositionDatabase db;
+    ASSERT_TRUE(db.open(path));
+    EXPECT_EQ(db.size(), static_cast<std::size_t>(count + 1));
+
+    PositionAnalysis a;
+    ASSERT_TRUE(db.lookup(keyFor(0), 6, 1, a));
+    EXPECT_EQ(a.timestamp, analysisFor(7).timestamp);
+    ASSERT_TRUE(db.lookup(keyFor(0), 0, 0, a));
+    EXPECT_EQ(a.timestamp, analysisFor(42).timestamp);
+    ASSERT_TRUE(db.lookup(keyFor(4321), 1, 6, a));
+    EXPECT_FLOAT_EQ(a.equity, 4.321f);
+    EXPECT_EQ(a.depth, 4321 % 7);
+    ASSERT_EQ(a.bestPlay.count, 2);
+    EXPECT_EQ(a.bestPlay.moves[0].fromIndex, Game::BAR_INDEX);
+    EXPECT_EQ(a.bestPlay.moves[1].toIndex, 5);
+    EXPECT_FALSE(db.lookup(keyFor(4321), 5, 5, a));
+    EXPECT_FALSE(db.lookup(keyFor(count), 6, 1, a));
+}
+
+TEST(PositionDatabaseTests, RebuildsIndexAfterTornWrite) {
+    const std::string path = databasePath("bg_posdb_rebuild");
+    {
+        PositionDatabase db;
+        ASSERT_TRUE(db.open(path));
+        for (int i = 0; i < 100; ++i) ASSERT_TRUE(db.store(keyFor(i), 3, 2, analysisFor(i)));
+    }
+    // Half a record at the end and a lost index, as after a crash
+    {
+        std::ofstream out(path + ".dat", std::ios::binary | std::ios::app);
+        out.write("garbage", 7);
+    }
+    std::remove((path + ".idx").c_str());
+
+    PositionDatabase db;
+    ASSERT_TRUE(db.open(path));
+    EXPECT_EQ(db.size(), 100u);
+    PositionAnalysis a;
+    ASSERT_TRUE(db.lookup(keyFor(99), 2, 3, a));
+    EXPECT_EQ(a.timestamp, analysisFor(99).timestamp);
+    ASSERT_TRUE(db.store(keyFor(100), 3, 2, analysisFor(100)));
+    ASSERT_TRUE(db.lookup(keyFor(100), 3, 2, a));
+    EXPECT_EQ(a.timestamp, analysisFor(100).timestamp);
+}
+
+TEST(PositionDatabaseTests, ReadersRunDuringWrites) {
+    const std::string path = databasePath("bg_posdb_concurrent");
+    PositionDatabase db;
+    ASSERT_TRUE(db.open(path));
+
+    const int count = 20000;
+    std::atomic<int> published{ 0 };
+    std::atomic<bool> failed{ false };
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            PositionAnalysis a;
+            while (published.load(std::memory_order_acquire) < count) {
+                const int limit = published.load(std::memory_order_acquire);
+                for (int i = limit - 1; i >= 0 && i > limit - 50; --i) {
+                    if (!db.lookup(keyFor(i), 4, 4, a) || a.timestamp != analysisFor(i).timestamp) failed = true;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(db.store(keyFor(i), 4, 4, analysisFor(i)));
+        published.store(i + 1, std::memory_order_release);
+    }
+    for (auto& t : readers) t.join();
+
+    EXPECT_FALSE(failed.load());
+    EXPECT_EQ(db.size(), static_cast<std::size_t>(count));
+}
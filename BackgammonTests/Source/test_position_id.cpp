@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "PositionId.hpp"
+
+// =============================
+// POSITION ID TESTS
+// =============================
+
+namespace {
+    void expectSameBoard(const Board& a, const Board& b) {
+        for (int i = 0; i < 24; ++i) {
+            EXPECT_EQ(a.getColumn(i).getPieceCount(), b.getColumn(i).getPieceCount()) << "column " << i;
+            EXPECT_EQ(a.getColumn(i).getColor(), b.getColumn(i).getColor()) << "column " << i;
+        }
+        for (int p = 0; p < 2; ++p) {
+            EXPECT_EQ(a.getBarCount(p), b.getBarCount(p));
+            EXPECT_EQ(a.getBorneOffCount(p), b.getBorneOffCount(p));
+        }
+    }
+}
+
+TEST(PositionIdTests, StartingPositionRoundTrips) {
+    const Board start;
+    const PositionKey key = PositionId::encode(start, Color::WHITE);
+    EXPECT_EQ(PositionId::toString(key), "4HPwATDgc/ABMA");
+    EXPECT_EQ(PositionId::encode(start, Color::BLACK), key);
+
+    expectSameBoard(Board(key, Color::WHITE), start);
+    expectSameBoard(Board(key, Color::BLACK), start);
+}
+
+TEST(PositionIdTests, GameFromKeyMatchesPlayedPosition) {
+    HeadlessGame game;
+    game.start();
+    game.rollOpeningDice(6);
+    game.rollOpeningDice(1);
+    game.startGameAfterOpening();
+    game.rollDice(6, 1);
+    ASSERT_EQ(game.makeMove(0, 6), MoveResult::SUCCESS);
+
+    // Put a black checker on the bar to exercise the bar slot
+    GameStateDTO state = game.getState();
+    state.pieceCounts[23] = 1;
+    state.barBlack = 1;
+    game.loadState(state);
+
+    const PositionKey key = game.positionKey();
+    EXPECT_EQ(key, PositionId::encode(game.getState()));
+
+    HeadlessGame copy(key, game.getCurrentPlayer());
+    EXPECT_EQ(copy.getPhase(), GamePhase::IN_PROGRESS);
+    EXPECT_EQ(copy.getCurrentPlayer(), game.getCurrentPlayer());
+    const GameStateDTO a = game.getState();
+    const GameStateDTO b = copy.getState();
+    for (int i = 0; i < 24; ++i) {
+        EXPECT_EQ(a.pieceCounts[i], b.pieceCounts[i]);
+    }
+    EXPECT_EQ(b.barBlack, 1);
+    EXPECT_EQ(b.borneOffBlack, 0);
+    EXPECT_EQ(b.borneOffWhite, 0);
+}
+
+TEST(PositionIdTests, RejectsMalformedKeysAndText) {
+    PositionKey key{};
+    EXPECT_FALSE(PositionId::fromString("4HPwATDgc/ABM", key));
+    EXPECT_FALSE(PositionId::fromString("4HPwATDgc/AB*A", key));
+    EXPECT_FALSE(PositionId::fromString("4HPwATDgc/ABMB", key)); // non-zero padding bits
+
+    // All ones: more than 15 checkers on one point
+    PositionKey full;
+    full.fill(0xFF);
+    EXPECT_FALSE(PositionId::isValid(full));
+    HeadlessGame game(full, Color::WHITE);
+    EXPECT_EQ(game.getPhase(), GamePhase::NOT_STARTED);
+
+    // One checker each on the same column
+    const PositionKey clash = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 };
+    EXPECT_FALSE(PositionId::isValid(clash));
+
+    // Stray bits after the last separator would give a second key for one position
+    PositionKey stray{};
+    stray[9] = 0x80;
+    EXPECT_FALSE(PositionId::isValid(stray));
+
+    // All checkers borne off is a legal (empty) layout
+    const PositionKey empty{};
+    ASSERT_TRUE(PositionId::isValid(empty));
+    Board board(empty, Color::WHITE);
+    EXPECT_EQ(board.getBorneOffCount(0), 15);
+    EXPECT_EQ(board.getBorneOffCount(1), 15);
+}
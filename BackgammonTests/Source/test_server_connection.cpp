@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ServerConnection.hpp"
+
+// =============================
+// SERVER CONNECTION TESTS
+// =============================
+
+namespace {
+    SharedFrame frameOf(std::size_t size, std::uint8_t fill) {
+        return std::make_shared<const std::vector<std::uint8_t>>(size, fill);
+    }
+
+    const std::uint8_t* base(const iovec& v) {
+        return static_cast<const std::uint8_t*>(v.iov_base);
+    }
+}
+
+TEST(ServerConnectionTests, PartialSendsRetireAcrossResponsesAndUpdates) {
+    OutputQueue queue;
+    const SharedFrame first = frameOf(10, 0xA1);
+    const SharedFrame second = frameOf(10, 0xB2);
+    ASSERT_TRUE(queue.pushUpdate(first, 100));
+    ASSERT_TRUE(queue.pushUpdate(second, 100));
+    queue.responses().assign(6, 0xEE);
+    EXPECT_EQ(queue.updateBytes(), 20u);
+
+    // Responses overtake updates that have not started
+    iovec iov[8];
+    ASSERT_EQ(queue.gather(iov, 8), 3);
+    EXPECT_EQ(iov[0].iov_len, 6u);
+    EXPECT_EQ(base(iov[1]), first->data());
+    EXPECT_EQ(base(iov[2]), second->data());
+
+    // The send ends inside the first update
+    queue.retire(9);
+    queue.responses().assign(4, 0xCC);
+    ASSERT_EQ(queue.gather(iov, 8), 3);
+    EXPECT_EQ(base(iov[0]), first->data() + 3);
+    EXPECT_EQ(iov[0].iov_len, 7u);
+    EXPECT_EQ(iov[1].iov_len, 4u);
+    EXPECT_EQ(base(iov[1])[0], 0xCC);
+    EXPECT_EQ(base(iov[2]), second->data());
+
+    // Now it ends inside the responses, after finishing the started update
+    queue.retire(9);
+    EXPECT_EQ(queue.updateBytes(), 10u);
+    ASSERT_EQ(queue.gather(iov, 8), 2);
+    EXPECT_EQ(iov[0].iov_len, 2u);
+    EXPECT_EQ(base(iov[1]), second->data());
+
+    queue.retire(12);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.hasUpdates());
+    EXPECT_EQ(queue.updateBytes(), 0u);
+    EXPECT_EQ(queue.gather(iov, 8), 0);
+}
+
+TEST(ServerConnectionTests, GatherStopsAtTheBufferLimit) {
+    OutputQueue queue;
+    for (std::uint8_t i = 0; i < 4; ++i) ASSERT_TRUE(queue.pushUpdate(frameOf(5, i), 100));
+
+    iovec iov[2];
+    ASSERT_EQ(queue.gather(iov, 2), 2);
+    queue.retire(10);
+    ASSERT_EQ(queue.gather(iov, 2), 2);
+    EXPECT_EQ(base(iov[0])[0], 2);
+    EXPECT_EQ(base(iov[1])[0], 3);
+    queue.retire(10);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ServerConnectionTests, UpdatesBeyondTheBacklogAreRefused) {
+    OutputQueue queue;
+    EXPECT_TRUE(queue.pushUpdate(frameOf(40, 1), 100));
+    EXPECT_TRUE(queue.pushUpdate(frameOf(60, 2), 100));
+    EXPECT_FALSE(queue.pushUpdate(frameOf(1, 3), 100));
+    EXPECT_EQ(queue.updateBytes(), 100u);
+
+    // Partly sent bytes still count until the whole frame is gone
+    queue.retire(39);
+    EXPECT_FALSE(queue.pushUpdate(frameOf(1, 3), 100));
+    queue.retire(1);
+    EXPECT_TRUE(queue.pushUpdate(frameOf(40, 3), 100));
+}
+
+TEST(ServerConnectionTests, DeliveryChecksTheConnectionIdOfTheSocket) {
+    ConnectionTable table;
+    table.open(7, 1);
+    const SharedFrame frame = frameOf(8, 0);
+
+    bool wasIdle = false;
+    EXPECT_EQ(table.deliver(7, 1, frame, 100, wasIdle), ConnectionTable::DeliveryResult::QUEUED);
+    EXPECT_TRUE(wasIdle);
+    EXPECT_EQ(table.deliver(7, 1, frame, 100, wasIdle), ConnectionTable::DeliveryResult::QUEUED);
+    EXPECT_FALSE(wasIdle);
+
+    // The socket is closed and reused by a new connection before an old delivery arrives
+    table.close(7);
+    EXPECT_EQ(table.deliver(7, 1, frame, 100, wasIdle), ConnectionTable::DeliveryResult::GONE);
+    ServerConnection& reused = table.open(7, 2);
+    EXPECT_TRUE(reused.output.empty());
+    EXPECT_EQ(table.deliver(7, 1, frame, 100, wasIdle), ConnectionTable::DeliveryResult::GONE);
+    EXPECT_TRUE(reused.output.empty());
+    EXPECT_EQ(table.find(7, 1), nullptr);
+    EXPECT_EQ(table.find(7, 2), &reused);
+
+    EXPECT_EQ(table.deliver(7, 2, frame, 8, wasIdle), ConnectionTable::DeliveryResult::QUEUED);
+    EXPECT_EQ(table.deliver(7, 2, frame, 8, wasIdle), ConnectionTable::DeliveryResult::LAGGING);
+    EXPECT_EQ(reused.output.updateBytes(), 8u);
+    EXPECT_EQ(table.sockets(), std::vector<int>{ 7 });
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Game.hpp"
+#include "GameJournal.hpp"
+#include "SessionJournal.hpp"
+#include "SessionStore.hpp"
+
+// =============================
+// SESSION JOURNAL TESTS
+// =============================
+
+namespace {
+    std::string journalPrefix(const char* name) {
+        const std::string prefix = ::testing::TempDir() + name;
+        GameJournal::removeSegmentsBefore(prefix, UINT64_MAX);
+        std::remove((prefix + ".snapshot").c_str());
+        return prefix;
+    }
+
+    /// Applies an operation to a session and logs it the way the server does
+    bool apply(SessionStore& store, SessionJournal& journal, std::uint32_t id, JournalOp op, int a = 0, int b = 0) {
+        bool ok = false;
+        store.withSession(id, [&](Session& session) {
+            if (op == JournalOp::MOVE) {
+                const Color player = session.game.getCurrentPlayer();
+                if (session.game.makeMove(a, b) != MoveResult::SUCCESS) return;
+                session.history.push_back(MoveRecord{ player, static_cast<std::int8_t>(a), static_cast<std::int8_t>(b) });
+            }
+            else {
+                JournalEntry entry;
+                entry.op = op;
+                entry.a = static_cast<std::int8_t>(a);
+                entry.b = static_cast<std::int8_t>(b);
+                if (!entry.apply(session.game)) return;
+            }
+            session.lastLsn = journal.log(id, op, a, b);
+            ok = session.lastLsn != 0;
+        });
+        return ok;
+    }
+
+    std::uint32_t createSession(SessionStore& store, SessionJournal& journal) {
+        return store.create(0, [&](std::uint32_t id, Session& session) {
+            session.lastLsn = journal.log(id, JournalOp::CREATE);
+        });
+    }
+
+    /// Starts a game with white on roll
+    void startGame(SessionStore& store, SessionJournal& journal, std::uint32_t id) {
+        ASSERT_TRUE(apply(store, journal, id, JournalOp::START));
+        ASSERT_TRUE(apply(store, journal, id, JournalOp::OPENING_ROLL, 5));
+        ASSERT_TRUE(apply(store, journal, id, JournalOp::OPENING_ROLL, 2));
+        ASSERT_TRUE(apply(store, journal, id, JournalOp::START_AFTER_OPENING));
+    }
+
+    /// Plays one random turn checker by checker; returns true if it ended with unplayable dice left
+    bool playTurn(SessionStore& store, SessionJournal& journal, std::uint32_t id, std::mt19937& rng) {
+        std::uniform_int_distribution<int> die(1, 6);
+        EXPECT_TRUE(apply(store, journal, id, JournalOp::ROLL, die(rng), die(rng)));
+
+        for (;;) {
+            Color player = Color::NONE;
+            int from = -1;
+            int to = -1;
+            store.withSession(id, [&](Session& session) {
+                player = session.game.getCurrentPlayer();
+                for (int f = 0; f <= Game::BAR_INDEX && from < 0; ++f) {
+                    const std::vector<int> targets = session.game.getLegalTargets(f);
+                    if (!targets.empty()) {
+                        from = f;
+                        to = targets.front();
+                    }
+                }
+            });
+            if (from < 0) {
+                EXPECT_TRUE(apply(store, journal, id, JournalOp::PASS));
+                return false;
+            }
+            EXPECT_TRUE(apply(store, journal, id, JournalOp::MOVE, from, to));
+
+            bool leftover = false;
+            bool turnOver = false;
+            store.withSession(id, [&](Session& session) {
+                const GameMemento memento = session.game.saveMemento();
+                turnOver = memento.state.currentPlayer != player || memento.phase != GamePhase::IN_PROGRESS;
+                leftover = turnOver && !memento.diceRolled && (memento.state.dice1 != 0 || memento.state.dice2 != 0);
+            });
+            if (turnOver) return leftover;
+        }
+    }
+
+    void expectSameSession(SessionStore& expected, SessionStore& actual, std::uint32_t id) {
+        GameMemento want;
+        GameMemento got;
+        std::vector<MoveRecord> wantHistory;
+        std::vector<MoveRecord> gotHistory;
+        ASSERT_TRUE(expected.withSession(id, [&](Session& s) {
+            want = s.game.saveMemento();
+            wantHistory.assign(s.history.begin(), s.history.end());
+        }));
+        ASSERT_TRUE(actual.withSession(id, [&](Session& s) {
+            got = s.game.saveMemento();
+            gotHistory.assign(s.history.begin(), s.history.end());
+        }));
+        for (int i = 0; i < 24; ++i) {
+            EXPECT_EQ(got.state.pieceCounts[i], want.state.pieceCounts[i]) << "column " << i;
+            EXPECT_EQ(got.state.colors[i], want.state.colors[i]) << "column " << i;
+        }
+        EXPECT_EQ(got.state.barWhite, want.state.barWhite);
+        EXPECT_EQ(got.state.barBlack, want.state.barBlack);
+        EXPECT_EQ(got.state.borneOffWhite, want.state.borneOffWhite);
+        EXPECT_EQ(got.state.borneOffBlack, want.state.borneOffBlack);
+        EXPECT_EQ(got.state.currentPlayer, want.state.currentPlayer);
+        EXPECT_EQ(got.state.dice1, want.state.dice1);
+        EXPECT_EQ(got.state.dice2, want.state.dice2);
+        EXPECT_EQ(got.phase, want.phase);
+        EXPECT_EQ(got.diceRolled, want.diceRolled);
+        ASSERT_EQ(gotHistory.size(), wantHistory.size());
+        for (std::size_t i = 0; i < wantHistory.size(); ++i) {
+            EXPECT_EQ(gotHistory[i].player, wantHistory[i].player);
+            EXPECT_EQ(gotHistory[i].from, wantHistory[i].from);
+            EXPECT_EQ(gotHistory[i].to, wantHistory[i].to);
+        }
+    }
+}
+
+TEST(SessionJournalTests, RecoversSnapshotAndTail) {
+    const std::string prefix = journalPrefix("bg_session_tail");
+    SessionStore live(2);
+    std::uint32_t id = 0;
+    {
+        SessionJournal journal(live, prefix, 0);
+        std::size_t sessions = 0;
+        std::size_t replayed = 0;
+        ASSERT_TRUE(journal.recover(sessions, replayed));
+        EXPECT_EQ(sessions, 0u);
+
+        id = createSession(live, journal);
+        startGame(live, journal, id);
+        std::mt19937 rng(3);
+        for (int turn = 0; turn < 6; ++turn) playTurn(live, journal, id, rng);
+        ASSERT_TRUE(journal.snapshot());
+
+        // The snapshot covers every segment written so far
+        std::uint64_t firstLsn = 0;
+        std::vector<JournalEntry> entries;
+        GameJournal::readAll(prefix, firstLsn, entries);
+        EXPECT_GT(firstLsn, 1u);
+        EXPECT_TRUE(entries.empty());
+
+        // Replayed on top of the snapshot; closing the journal makes them durable
+        for (int turn = 0; turn < 6; ++turn) playTurn(live, journal, id, rng);
+    }
+
+    SessionStore recovered(2);
+    SessionJournal journal(recovered, prefix, 0);
+    std::size_t sessions = 0;
+    std::size_t replayed = 0;
+    ASSERT_TRUE(journal.recover(sessions, replayed));
+    EXPECT_EQ(sessions, 1u);
+    EXPECT_GT(replayed, 0u);
+    expectSameSession(live, recovered, id);
+
+    // New sessions do not reuse the recovered id
+    EXPECT_NE(createSession(recovered, journal), id);
+}
+
+TEST(SessionJournalTests, SnapshotKeepsLeftoverDiceUnplayable) {
+    const std::string prefix = journalPrefix("bg_session_dice");
+    SessionStore live(1);
+    std::uint32_t id = 0;
+    {
+        SessionJournal journal(live, prefix, 0);
+        std::size_t sessions = 0;
+        std::size_t replayed = 0;
+        ASSERT_TRUE(journal.recover(sessions, replayed));
+
+        // Play until a turn ends on a blocked checker with a die left over
+        id = createSession(live, journal);
+        std::mt19937 rng(11);
+        bool leftover = false;
+        for (int game = 0; game < 50 && !leftover; ++game) {
+            startGame(live, journal, id);
+            for (int turn = 0; turn < 200 && !leftover; ++turn) {
+                bool inProgress = false;
+                live.withSession(id, [&](Session& s) { inProgress = s.game.getPhase() == GamePhase::IN_PROGRESS; });
+                if (!inProgress) break;
+                leftover = playTurn(live, journal, id, rng);
+            }
+        }
+        ASSERT_TRUE(leftover);
+        ASSERT_TRUE(journal.snapshot());
+    }
+
+    SessionStore recovered(1);
+    SessionJournal journal(recovered, prefix, 0);
+    std::size_t sessions = 0;
+    std::size_t replayed = 0;
+    ASSERT_TRUE(journal.recover(sessions, replayed));
+    EXPECT_EQ(replayed, 0u);
+    expectSameSession(live, recovered, id);
+
+    // The next player must roll before moving, as on the live server
+    recovered.withSession(id, [](Session& session) {
+        for (int from = 0; from <= Game::BAR_INDEX; ++from) EXPECT_TRUE(session.game.getLegalTargets(from).empty());
+    });
+}
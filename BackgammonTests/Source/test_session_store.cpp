@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <set>
+#include "SessionStore.hpp"
+
+// =============================
+// SESSION STORE TESTS
+// =============================
+
+TEST(SessionStoreTests, IdsEncodeTheOwningShard) {
+    SessionStore store(4);
+    EXPECT_EQ(store.shardCount(), 4u);
+
+    std::set<std::uint32_t> ids;
+    for (unsigned shard = 0; shard < 4; ++shard) {
+        for (int i = 0; i < 3; ++i) {
+            const std::uint32_t id = store.create(shard);
+            EXPECT_EQ(id % store.shardCount(), shard);
+            ids.insert(id);
+        }
+    }
+    EXPECT_EQ(ids.size(), 12u);
+    EXPECT_EQ(store.size(), 12u);
+
+    // Shard indexes wrap around the shard count
+    EXPECT_EQ(store.create(6) % 4, 2u);
+}
+
+TEST(SessionStoreTests, CreateWithSessionAndDestroy) {
+    SessionStore store(2);
+    std::uint32_t seen = 0;
+    const std::uint32_t id = store.create(1, [&](std::uint32_t created, Session& session) {
+        seen = created;
+        session.game.start();
+    });
+    EXPECT_EQ(seen, id);
+
+    GamePhase phase = GamePhase::NOT_STARTED;
+    EXPECT_TRUE(store.withSession(id, [&](Session& session) { phase = session.game.getPhase(); }));
+    EXPECT_EQ(phase, GamePhase::OPENING_ROLL_WHITE);
+    EXPECT_FALSE(store.withSession(id + 2, [](Session&) { FAIL() << "unknown session was visited"; }));
+
+    EXPECT_TRUE(store.destroy(id));
+    EXPECT_FALSE(store.destroy(id));
+    EXPECT_FALSE(store.withSession(id, [](Session&) { FAIL() << "destroyed session was visited"; }));
+    EXPECT_EQ(store.size(), 0u);
+
+    // A recycled session starts out idle
+    const std::uint32_t next = store.create(1);
+    EXPECT_NE(next, id);
+    EXPECT_TRUE(store.withSession(next, [&](Session& session) {
+        EXPECT_EQ(session.game.getPhase(), GamePhase::NOT_STARTED);
+        EXPECT_TRUE(session.history.empty());
+        EXPECT_TRUE(session.spectators.empty());
+    }));
+}
+
+TEST(SessionStoreTests, RestoredIdsAreNotHandedOutAgain) {
+    SessionStore store(2);
+    EXPECT_TRUE(store.restore(9, [](Session& session) { session.game.start(); }));
+    EXPECT_FALSE(store.restore(9, [](Session&) {}));
+
+    // 9 is sequence 4 of shard 1, so the shard continues after it
+    EXPECT_EQ(store.create(1), 11u);
+    EXPECT_EQ(store.create(0), 2u);
+
+    std::set<std::uint32_t> visited;
+    store.forEachSession([&](std::uint32_t id, const Session&) { visited.insert(id); });
+    EXPECT_EQ(visited, (std::set<std::uint32_t>{ 2, 9, 11 }));
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Game.hpp"
+#include "HeuristicEvaluator.hpp"
+#include "SnapshotPublisher.hpp"
+
+// =============================
+// SNAPSHOT PUBLISHER TESTS
+// =============================
+
+namespace {
+    int checkersOf(const GameStateDTO& state, Color color) {
+        int count = (color == Color::WHITE) ? state.barWhite + state.borneOffWhite : state.barBlack + state.borneOffBlack;
+        for (int i = 0; i < 24; ++i) {
+            if (state.colors[i] == color) count += state.pieceCounts[i];
+        }
+        return count;
+    }
+}
+
+TEST(SnapshotPublisherTests, PublishesOnEveryNotification) {
+    Game game;
+    SnapshotPublisher publisher(game, true);
+    EXPECT_EQ(publisher.current(), nullptr);
+    game.addObserver(&publisher);
+
+    game.start();
+    const auto started = publisher.current();
+    ASSERT_NE(started, nullptr);
+    EXPECT_EQ(started->phase, GamePhase::OPENING_ROLL_WHITE);
+    EXPECT_TRUE(started->legalMoves.empty());
+
+    game.rollOpeningDice(5);
+    game.rollOpeningDice(2);
+    game.startGameAfterOpening();
+    game.rollDice(5, 2);
+    const auto rolled = publisher.current();
+    EXPECT_GT(rolled->version, started->version);
+    EXPECT_EQ(rolled->phase, GamePhase::IN_PROGRESS);
+    EXPECT_EQ(rolled->targetsFrom(11), game.getLegalTargets(11));
+    EXPECT_FALSE(rolled->legalMoves.empty());
+
+    ASSERT_EQ(game.makeMove(11, 16), MoveResult::SUCCESS);
+    EXPECT_GT(publisher.current()->version, rolled->version);
+    // Snapshots taken earlier are left as they were
+    EXPECT_EQ(rolled->state.pieceCounts[11], 5);
+    EXPECT_EQ(publisher.current()->state.pieceCounts[11], 4);
+}
+
+TEST(SnapshotPublisherTests, ReadersSeeConsistentPositionsWhileWriterPlays) {
+    HeadlessGame game;
+    SnapshotPublisher publisher(game);
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> readers;
+    std::atomic<int> inconsistent(0);
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            std::uint64_t lastVersion = 0;
+            while (!done.load()) {
+                const std::shared_ptr<const GameSnapshot> snapshot = publisher.current();
+                if (!snapshot) continue;
+                if (snapshot->version < lastVersion) ++inconsistent;
+                lastVersion = snapshot->version;
+                if (snapshot->phase != GamePhase::NOT_STARTED &&
+                    (checkersOf(snapshot->state, Color::WHITE) != 15 || checkersOf(snapshot->state, Color::BLACK) != 15)) {
+                    ++inconsistent;
+                }
+            }
+        });
+    }
+
+    // No ASSERT_* while the readers run: returning early would destroy joinable threads
+    bool stuck = false;
+    for (int g = 0; g < 3 && !stuck; ++g) {
+        game.start();
+        game.rollOpeningDice(6);
+        game.rollOpeningDice(1);
+        game.startGameAfterOpening();
+        publisher.publish();
+        int roll = 0;
+        while (game.getPhase() == GamePhase::IN_PROGRESS) {
+            game.rollDice(1 + roll % 6, 1 + (roll / 6) % 6);
+            ++roll;
+            const Color mover = game.getCurrentPlayer();
+            Play play;
+            float equity = 0.0f;
+            if (!HeuristicEvaluator::bestPlay(game, play, equity)) {
+                stuck = true;
+                break;
+            }
+            for (int i = 0; i < play.count; ++i) {
+                game.makeMove(play.moves[i].fromIndex, play.moves[i].toIndex);
+                publisher.publish();
+            }
+            if (game.getPhase() == GamePhase::IN_PROGRESS && game.getCurrentPlayer() == mover) game.passTurn();
+        }
+    }
+    done = true;
+    for (auto& reader : readers) reader.join();
+
+    EXPECT_FALSE(stuck);
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(publisher.current()->phase, GamePhase::FINISHED);
+}
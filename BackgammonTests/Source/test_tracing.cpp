@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include "Tracing.hpp"
+
+// =============================
+// TRACING TESTS
+// =============================
+
+TEST(TracingTests, SpansFromEachThreadAreExported) {
+    Tracer::clear();
+    Tracer::setEnabled(true);
+    {
+        TraceSpan span("mainSpan");
+    }
+    std::thread worker([]() {
+        Tracer::setThreadName("worker");
+        TraceSpan span("workerSpan");
+    });
+    worker.join();
+    Tracer::setEnabled(false);
+
+    std::ostringstream out;
+    Tracer::writeChromeJson(out);
+    const std::string json = out.str();
+    EXPECT_NE(json.find("\"name\":\"mainSpan\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"workerSpan\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"worker\"}"), std::string::npos);
+    Tracer::clear();
+}
+
+TEST(TracingTests, NothingIsRecordedWhileDisabled) {
+    Tracer::clear();
+    Tracer::setEnabled(false);
+    {
+        TraceSpan span("disabledSpan");
+    }
+
+    std::ostringstream out;
+    Tracer::writeChromeJson(out);
+    EXPECT_EQ(out.str().find("disabledSpan"), std::string::npos);
+}
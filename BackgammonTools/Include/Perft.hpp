@@ -0,0 +1,64 @@
+/**
+ * @file Perft.hpp
+ * @brief Defines the Perft class walking the game tree over all dice rolls.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Game.hpp"
+
+/**
+ * @struct PerftCounts
+ * @brief Node counts collected by a tree walk.
+ */
+struct PerftCounts {
+    std::uint64_t rolls = 0;   ///< Dice rolls examined (chance nodes)
+    std::uint64_t plays = 0;   ///< Distinct legal plays found over all rolls
+    std::uint64_t leaves = 0;  ///< Positions reached at the requested depth (or at game end)
+};
+
+/**
+ * @class Perft
+ * @brief Counts the game tree below a position to a fixed depth.
+ *
+ * Each ply rolls all 21 distinct dice combinations for the player on move
+ * and expands every distinct play (see MoveGenerator). The counts depend
+ * only on the rules, so they double as a correctness check for the engine.
+ */
+class Perft {
+public:
+    /**
+     * @brief Walks the tree below a position.
+     * @param game Position with the player to move and no dice rolled
+     * @param depth Number of plies (turns) to expand
+     * @return Collected counts
+     */
+    static PerftCounts run(const HeadlessGame& game, int depth);
+
+    /**
+     * @brief Builds one of the built-in start positions.
+     * @param name "start", "bar" or "bearoff"
+     * @param game Receives the position
+     * @return False if the name is unknown
+     */
+    static bool builtinPosition(const std::string& name, HeadlessGame& game);
+
+    /**
+     * @brief Builds a built-in position or any position given by its key.
+     *
+     * A position key (see PositionId) is read with white on roll.
+     *
+     * @param text Built-in name or 14-character base64 position key
+     * @param game Receives the position
+     * @return False if the text is neither a known name nor a valid key
+     */
+    static bool position(const std::string& text, HeadlessGame& game);
+
+    /**
+     * @brief Gets the names accepted by builtinPosition.
+     * @return Built-in position names
+     */
+    static std::vector<std::string> builtinNames();
+};
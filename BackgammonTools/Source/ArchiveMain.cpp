@@ -0,0 +1,106 @@
+/**
+ * @file ArchiveMain.cpp
+ * @brief Command-line tool for building and browsing indexed game archives.
+ *
+ * Usage:
+ *   BackgammonArchive pack RECORD_FILE ARCHIVE   convert a game record stream into an archive
+ *   BackgammonArchive info ARCHIVE               print the number of games and events
+ *   BackgammonArchive show ARCHIVE GAME [EVENT]  print the position of a game after EVENT events
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "GameArchive.hpp"
+#include "GameRecordStream.hpp"
+
+namespace {
+    const char* colorName(Color c) {
+        return c == Color::WHITE ? "white" : (c == Color::BLACK ? "black" : "none");
+    }
+
+    int pack(const std::string& input, const std::string& output) {
+        std::ifstream in(input, std::ios::binary);
+        GameRecordReader reader(in);
+        GameArchiveWriter writer(output);
+        if (!in || !writer.isOpen()) {
+            std::cerr << "Cannot open " << (in ? output : input) << "\n";
+            return 1;
+        }
+
+        GameRecord record;
+        std::size_t count = 0;
+        while (reader.next(record)) {
+            writer.append(record);
+            ++count;
+        }
+        if (reader.failed()) {
+            std::cerr << input << " is corrupt after " << count << " games\n";
+            return 1;
+        }
+        if (!writer.finish()) {
+            std::cerr << "Could not write " << output << "\n";
+            return 1;
+        }
+        std::cout << count << " games written to " << output << "\n";
+        return 0;
+    }
+
+    int info(const GameArchive& archive) {
+        std::size_t events = 0;
+        for (std::size_t k = 0; k < archive.gameCount(); ++k) events += archive.game(k).eventCount();
+        std::cout << archive.gameCount() << " games, " << events << " events\n";
+        return 0;
+    }
+
+    int show(const GameArchive& archive, std::size_t gameIndex, std::size_t eventLimit) {
+        if (gameIndex >= archive.gameCount()) {
+            std::cerr << "Game " << gameIndex << " out of range (" << archive.gameCount() << " games)\n";
+            return 1;
+        }
+
+        const GameView view = archive.game(gameIndex);
+        HeadlessGame game;
+        if (!view.replay(game, eventLimit)) {
+            std::cerr << "Game " << gameIndex << " does not replay\n";
+            return 1;
+        }
+
+        const GameStateDTO s = game.getState();
+        std::cout << "game " << gameIndex << ", after " << (eventLimit < view.eventCount() ? eventLimit : view.eventCount())
+                  << " of " << view.eventCount() << " events, " << colorName(s.currentPlayer) << " to play\n";
+        for (int i = 0; i < 24; ++i) {
+            const int count = s.colors[i] == Color::BLACK ? -s.pieceCounts[i] : s.pieceCounts[i];
+            std::cout << count << (i == 23 ? "\n" : " ");
+        }
+        std::cout << "bar " << s.barWhite << "/" << s.barBlack << ", off " << s.borneOffWhite << "/" << s.borneOffBlack
+                  << ", dice " << s.dice1 << " " << s.dice2 << "\n";
+        return 0;
+    }
+}
+
+/**
+ * @brief Main entry point of the archive tool.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return 0 on success
+ */
+int main(int argc, char* argv[]) {
+    const std::string command = argc > 1 ? argv[1] : "";
+    if (command == "pack" && argc == 4) return pack(argv[2], argv[3]);
+
+    if ((command == "info" && argc == 3) || (command == "show" && (argc == 4 || argc == 5))) {
+        GameArchive archive;
+        if (!archive.open(argv[2])) {
+            std::cerr << argv[2] << " is not a valid archive\n";
+            return 1;
+        }
+        if (command == "info") return info(archive);
+        const std::size_t eventLimit = argc == 5 ? static_cast<std::size_t>(std::strtoull(argv[4], nullptr, 10)) : SIZE_MAX;
+        return show(archive, static_cast<std::size_t>(std::strtoull(argv[3], nullptr, 10)), eventLimit);
+    }
+
+    std::cerr << "Usage: " << argv[0] << " pack RECORD_FILE ARCHIVE | info ARCHIVE | show ARCHIVE GAME [EVENT]\n";
+    return 2;
+}
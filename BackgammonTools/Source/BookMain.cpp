@@ -0,0 +1,142 @@
+/**
+ * @file BookMain.cpp
+ * @brief Command-line tool for building and probing the opening book.
+ *
+ * Usage:
+ *   BackgammonBook build BOOK [--depth N]          precompute the first N turns (default 3)
+ *   BackgammonBook info BOOK                       print the number of entries
+ *   BackgammonBook probe BOOK POSITION DIE1 DIE2   print the book play (POSITION as base64 position ID)
+ *
+ * The book covers all 21 rolls from the starting position and, for each
+ * following turn, all 21 rolls in every position reached by the book's own
+ * best plays. Plays are chosen by HeuristicEvaluator.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Board.hpp"
+#include "Game.hpp"
+#include "HeuristicEvaluator.hpp"
+#include "OpeningBook.hpp"
+#include "PositionId.hpp"
+
+namespace {
+    constexpr int MAX_DEPTH = 4;
+
+    /**
+     * @brief Formats a play in the numbering of white (24-point to 1-point).
+     */
+    std::string describe(const Play& play) {
+        if (play.count == 0) return "(no move)";
+        std::string text;
+        for (int i = 0; i < play.count; ++i) {
+            const int from = play.moves[i].fromIndex;
+            const int to = play.moves[i].toIndex;
+            if (i > 0) text += ' ';
+            text += from == Game::BAR_INDEX ? std::string("bar") : std::to_string(24 - from);
+            text += '/';
+            text += to == 24 ? std::string("off") : std::to_string(24 - to);
+        }
+        return text;
+    }
+
+    int build(const std::string& path, int depth) {
+        const auto begin = std::chrono::steady_clock::now();
+        std::vector<OpeningBookEntry> entries;
+        std::vector<PositionKey> frontier{ PositionId::encode(Board(), Color::WHITE) };
+
+        for (int turn = 1; turn <= depth; ++turn) {
+            std::vector<PositionKey> next;
+            for (const PositionKey& key : frontier) {
+                for (int d1 = 1; d1 <= 6; ++d1) {
+                    // The first turn is rolled after the opening, so doubles occur there too
+                    for (int d2 = d1; d2 <= 6; ++d2) {
+                        HeadlessGame game(key, Color::WHITE);
+                        game.rollDice(d1, d2);
+
+                        OpeningBookEntry entry;
+                        entry.key = key;
+                        entry.die1 = d1;
+                        entry.die2 = d2;
+                        entry.onRoll = Color::WHITE;
+                        if (!HeuristicEvaluator::bestPlay(game, entry.play, entry.equity)) continue;
+                        entries.push_back(entry);
+
+                        for (int i = 0; i < entry.play.count; ++i) {
+                            game.makeMove(entry.play.moves[i].fromIndex, entry.play.moves[i].toIndex);
+                        }
+                        if (game.getPhase() != GamePhase::IN_PROGRESS) continue;
+                        if (game.getCurrentPlayer() == Color::WHITE) game.passTurn();
+                        next.push_back(game.positionKey());
+                    }
+                }
+            }
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+            std::cout << "turn " << turn << ": " << frontier.size() << " positions\n";
+            frontier = std::move(next);
+        }
+
+        if (!OpeningBook::write(path, entries)) {
+            std::cerr << "Could not write " << path << "\n";
+            return 1;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << entries.size() << " entries written to " << path << " in " << seconds << " s\n";
+        return 0;
+    }
+
+    int probe(const OpeningBook& book, const std::string& position, int die1, int die2) {
+        PositionKey key;
+        if (!PositionId::fromString(position, key) || !PositionId::isValid(key)) {
+            std::cerr << position << " is not a valid position ID\n";
+            return 1;
+        }
+        Play play;
+        float equity = 0.0f;
+        if (!book.lookup(key, Color::WHITE, die1, die2, play, equity)) {
+            std::cout << "not in book\n";
+            return 1;
+        }
+        std::cout << describe(play) << "  equity " << equity << "\n";
+        return 0;
+    }
+}
+
+/**
+ * @brief Main entry point of the opening book tool.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return 0 on success
+ */
+int main(int argc, char* argv[]) {
+    const std::string command = argc > 1 ? argv[1] : "";
+    if (command == "build" && (argc == 3 || (argc == 5 && std::string(argv[3]) == "--depth"))) {
+        const int depth = argc == 5 ? std::atoi(argv[4]) : 3;
+        if (depth < 1 || depth > MAX_DEPTH) {
+            std::cerr << "--depth must be between 1 and " << MAX_DEPTH << "\n";
+            return 2;
+        }
+        return build(argv[2], depth);
+    }
+
+    if ((command == "info" && argc == 3) || (command == "probe" && argc == 6)) {
+        OpeningBook book;
+        if (!book.open(argv[2])) {
+            std::cerr << argv[2] << " is not a valid opening book\n";
+            return 1;
+        }
+        if (command == "info") {
+            std::cout << book.size() << " entries\n";
+            return 0;
+        }
+        return probe(book, argv[3], std::atoi(argv[4]), std::atoi(argv[5]));
+    }
+
+    std::cerr << "Usage: " << argv[0] << " build BOOK [--depth N] | info BOOK | probe BOOK POSITION DIE1 DIE2\n";
+    return 2;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file ImportMain.cpp
+ * @brief Imports .mat match transcripts into a game record file.
+ *
+ * Usage: BackgammonImport [--threads N] [--verbose] OUTPUT.bgr INPUT.mat...
+ *
+ * Each input is memory-mapped and split into games. Games are imported in
+ * batches of BATCH_GAMES: contiguous ranges of a batch are parsed and
+ * validated on worker threads, then the accepted records are written in
+ * file order before the next batch starts, so memory stays bounded however
+ * large the input is. Games are numbered by their position across all
+ * inputs, rejected games included.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "GameRecordStream.hpp"
+#include "MappedFile.hpp"
+#include "MatchImporter.hpp"
+
+namespace {
+    /// Games parsed before their records are written out
+    constexpr std::size_t BATCH_GAMES = 4096;
+
+    /**
+     * @struct ImportedGame
+     * @brief Outcome of importing one game.
+     */
+    struct ImportedGame {
+        bool ok = false;      ///< True if the game was accepted
+        GameRecord record;    ///< Imported game
+        std::string error;    ///< Rejection reason
+    };
+}
+
+/**
+ * @brief Main entry point of the importer.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return 0 on success, 1 on I/O errors, 2 on usage errors
+ */
+int main(int argc, char* argv[]) {
+    unsigned threads = std::thread::hardware_concurrency();
+    bool verbose = false;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (arg == "--verbose") verbose = true;
+        else paths.push_back(arg);
+    }
+    if (paths.size() < 2) {
+        std::cerr << "Usage: " << argv[0] << " [--threads N] [--verbose] OUTPUT.bgr INPUT.mat...\n";
+        return 2;
+    }
+    if (threads == 0) threads = 1;
+
+    std::ofstream out(paths[0], std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Cannot create " << paths[0] << "\n";
+        return 1;
+    }
+    GameRecordWriter writer(out);
+
+    std::size_t total = 0;
+    std::size_t rejected = 0;
+    const auto begin = std::chrono::steady_clock::now();
+
+    for (std::size_t f = 1; f < paths.size(); ++f) {
+        MappedFile file;
+        if (!file.open(paths[f])) {
+            std::cerr << "Cannot open " << paths[f] << "\n";
+            return 1;
+        }
+
+        const std::string_view text(reinterpret_cast<const char*>(file.data()), file.size());
+        // Views into the mapping; only the records of one batch are held at a time
+        const std::vector<std::string_view> games = MatchImporter::splitGames(text);
+        std::vector<ImportedGame> results(std::min(games.size(), BATCH_GAMES));
+        // Ids continue across input files so every game in the output is unique
+        const std::size_t firstId = total + 1;
+
+        for (std::size_t base = 0; base < games.size(); base += BATCH_GAMES) {
+            const std::size_t count = std::min(games.size() - base, BATCH_GAMES);
+            const std::size_t workers = std::min<std::size_t>(threads, count);
+            const std::size_t chunk = (count + workers - 1) / workers;
+            std::vector<std::thread> pool;
+            for (std::size_t w = 0; w < workers; ++w) {
+                pool.emplace_back([&, w]() {
+                    const std::size_t first = w * chunk;
+                    const std::size_t last = std::min(count, first + chunk);
+                    for (std::size_t i = first; i < last; ++i) {
+                        ImportedGame& result = results[i];
+                        result.error.clear();
+                        result.ok = MatchImporter::importGame(games[base + i], result.record, result.error);
+                        result.record.gameId = firstId + base + i;
+                    }
+                });
+            }
+            for (auto& t : pool) t.join();
+
+            for (std::size_t i = 0; i < count; ++i) {
+                ++total;
+                if (results[i].ok) {
+                    writer.append(results[i].record);
+                }
+                else {
+                    ++rejected;
+                    if (verbose) std::cerr << paths[f] << " game " << (base + i + 1) << ": " << results[i].error << "\n";
+                }
+            }
+        }
+    }
+
+    if (!writer.finish()) {
+        std::cerr << "Could not write " << paths[0] << "\n";
+        return 1;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::cout << total << " games read, " << (total - rejected) << " imported, " << rejected << " rejected in "
+              << seconds << " s\n";
+    return 0;
+}
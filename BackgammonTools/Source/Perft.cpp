@@ -0,0 +1,68 @@
+/**
+ * @file Perft.cpp
+ * @brief Implementation of the Perft tree walk.
+ */
+
+#include "Perft.hpp"
+
+#include "MoveGenerator.hpp"
+#include "PositionId.hpp"
+
+PerftCounts Perft::run(const HeadlessGame& game, int depth) {
+    PerftCounts counts;
+    if (depth <= 0 || game.getPhase() != GamePhase::IN_PROGRESS) {
+        counts.leaves = 1;
+        return counts;
+    }
+
+    for (int d1 = 1; d1 <= 6; ++d1) {
+        for (int d2 = d1; d2 <= 6; ++d2) {
+            HeadlessGame rolled = game;
+            rolled.rollDice(d1, d2);
+            ++counts.rolls;
+
+            const std::vector<GeneratedPlay> plays = MoveGenerator::generatePlays(rolled);
+            counts.plays += plays.size();
+            for (const GeneratedPlay& p : plays) {
+                const PerftCounts sub = run(p.after, depth - 1);
+                counts.rolls += sub.rolls;
+                counts.plays += sub.plays;
+                counts.leaves += sub.leaves;
+            }
+        }
+    }
+    return counts;
+}
+
+bool Perft::builtinPosition(const std::string& name, HeadlessGame& game) {
+    //                                                   0   1   2   3   4   5   6   7   8   9  10  11  12  13  14  15  16  17  18  19  20  21  22  23
+    if (name == "start") {
+        game.loadState(GameStateDTO::fromColumns({  2,  0,  0,  0,  0, -5,  0, -3,  0,  0,  0,  5, -5,  0,  0,  0,  3,  0,  5,  0,  0,  0,  0, -2 },
+                                                 0, 0, 0, 0, Color::WHITE));
+        return true;
+    }
+    if (name == "bar") {
+        game.loadState(GameStateDTO::fromColumns({ -2, -2, -2,  0, -3, -3,  0,  0,  0,  0,  0,  3, -3,  0,  0,  0,  3,  0,  4,  3,  0,  0,  0,  0 },
+                                                 2, 0, 0, 0, Color::WHITE));
+        return true;
+    }
+    if (name == "bearoff") {
+        game.loadState(GameStateDTO::fromColumns({ -3, -3, -3, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  3,  3,  2,  1,  1 },
+                                                 0, 0, 3, 0, Color::WHITE));
+        return true;
+    }
+    return false;
+}
+
+bool Perft::position(const std::string& text, HeadlessGame& game) {
+    if (builtinPosition(text, game)) return true;
+
+    PositionKey key;
+    if (!PositionId::fromString(text, key) || !PositionId::isValid(key)) return false;
+    game = HeadlessGame(key, Color::WHITE);
+    return true;
+}
+
+std::vector<std::string> Perft::builtinNames() {
+    return { "start", "bar", "bearoff" };
+}
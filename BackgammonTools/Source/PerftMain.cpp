@@ -0,0 +1,105 @@
+/**
+ * @file PerftMain.cpp
+ * @brief Command-line front end for the Perft tree counter.
+ *
+ * Usage:
+ *   BackgammonPerft [--position POSITION] [--depth N]   print counts and timing per depth
+ *   BackgammonPerft --verify GOLDEN_FILE                compare against a golden table
+ *
+ * POSITION is a built-in name or a base64 position key with white on roll.
+ * Golden file lines: "<position> <depth> <rolls> <plays> <leaves>"; lines
+ * starting with '#' are ignored.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "Perft.hpp"
+
+namespace {
+    int verify(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "Cannot open " << path << "\n";
+            return 2;
+        }
+
+        int failures = 0;
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') continue;
+
+            std::istringstream fields(line);
+            std::string name;
+            int depth = 0;
+            PerftCounts expected;
+            if (!(fields >> name >> depth >> expected.rolls >> expected.plays >> expected.leaves)) {
+                std::cerr << "Malformed line: " << line << "\n";
+                return 2;
+            }
+
+            HeadlessGame game;
+            if (!Perft::position(name, game)) {
+                std::cerr << "Unknown position: " << name << "\n";
+                return 2;
+            }
+
+            const auto begin = std::chrono::steady_clock::now();
+            const PerftCounts actual = Perft::run(game, depth);
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+            const bool ok = actual.rolls == expected.rolls && actual.plays == expected.plays && actual.leaves == expected.leaves;
+            if (!ok) ++failures;
+            std::cout << (ok ? "PASS " : "FAIL ") << name << " depth " << depth
+                      << ": rolls " << actual.rolls << " plays " << actual.plays << " leaves " << actual.leaves
+                      << " (" << ms << " ms)";
+            if (!ok) {
+                std::cout << " expected rolls " << expected.rolls << " plays " << expected.plays << " leaves " << expected.leaves;
+            }
+            std::cout << "\n";
+        }
+        return failures == 0 ? 0 : 1;
+    }
+}
+
+/**
+ * @brief Main entry point of the perft tool.
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return 0 on success, 1 on golden mismatch, 2 on usage errors
+ */
+int main(int argc, char* argv[]) {
+    std::string position = "start";
+    int depth = 2;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--verify" && i + 1 < argc) return verify(argv[++i]);
+        if (arg == "--position" && i + 1 < argc) position = argv[++i];
+        else if (arg == "--depth" && i + 1 < argc) depth = std::atoi(argv[++i]);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--position NAME|KEY] [--depth N] | --verify GOLDEN_FILE\n";
+            return 2;
+        }
+    }
+
+    HeadlessGame game;
+    if (!Perft::position(position, game)) {
+        std::cerr << "Unknown position '" << position << "'. Give a valid position key or one of:";
+        for (const auto& n : Perft::builtinNames()) std::cerr << " " << n;
+        std::cerr << "\n";
+        return 2;
+    }
+
+    for (int d = 1; d <= depth; ++d) {
+        const auto begin = std::chrono::steady_clock::now();
+        const PerftCounts c = Perft::run(game, d);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << position << " " << d << " " << c.rolls << " " << c.plays << " " << c.leaves
+                  << "   # " << seconds << " s, " << (seconds > 0 ? c.leaves / seconds : 0) << " leaves/s\n";
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file AutoplayRunner.hpp
+ * @brief Defines the AutoplayRunner class playing bot-vs-bot games in the background.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "Game.hpp"
+#include "GameStateDTO.hpp"
+#include "SnapshotPublisher.hpp"
+
+/**
+ * @class AutoplayRunner
+ * @brief Plays heuristic bot against heuristic bot on a worker thread, as fast as it can.
+ *
+ * The games run on a HeadlessGame, so no observer or widget is involved in
+ * a move. After every roll and every play the runner publishes a
+ * snapshot; the UI samples the latest one at its own pace without locking
+ * and skips whatever happened in between.
+ */
+class AutoplayRunner {
+public:
+    /**
+     * @brief Constructor creating a stopped runner.
+     */
+    AutoplayRunner();
+
+    /**
+     * @brief Destructor stopping the worker thread.
+     */
+    ~AutoplayRunner();
+
+    AutoplayRunner(const AutoplayRunner&) = delete;
+    AutoplayRunner& operator=(const AutoplayRunner&) = delete;
+
+    /**
+     * @brief Starts playing games; does nothing if already running.
+     */
+    void start();
+
+    /**
+     * @brief Stops playing and waits for the worker thread to finish.
+     */
+    void stop();
+
+    /**
+     * @brief Checks whether games are being played.
+     * @return True between start() and stop()
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Gets the number of games finished since start().
+     * @return Finished games
+     */
+    std::uint64_t gamesPlayed() const;
+
+    /**
+     * @brief Copies the latest snapshot if it changed since a given version.
+     * @param version Version the caller has; updated to the returned snapshot's version
+     * @param state Receives the snapshot
+     * @return True if a newer snapshot was copied
+     */
+    bool latest(std::uint64_t& version, GameStateDTO& state) const;
+
+private:
+    /**
+     * @brief Worker thread body playing games until stopped.
+     */
+    void run();
+
+    std::thread m_thread;                   ///< Worker thread
+    std::atomic<bool> m_stop;               ///< Set to end the worker thread
+    std::atomic<std::uint64_t> m_games;     ///< Games finished since start()
+
+    HeadlessGame m_game;                    ///< Game being played (worker thread only)
+    SnapshotPublisher m_publisher;          ///< Shares m_game's positions with the UI
+};
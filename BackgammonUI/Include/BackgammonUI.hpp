@@ -5,15 +5,20 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
+#include <QElapsedTimer>
 #include <QMainWindow>
 
+#include "AutoplayRunner.hpp"
 #include "IGame.hpp"
 
 class BoardWidget;
+class QAction;
 class QPushButton;
 class QLabel;
+class QTimer;
 
 /**
  * @class BackgammonUI
@@ -24,6 +29,7 @@ class QLabel;
  * - Status displays (current player, dice values, game messages)
  * - Board widget for visual game representation
  * - Menu bar with game options
+ * - Autoplay mode watching bot-vs-bot games that run on a worker thread
  */
 class BackgammonUI : public QMainWindow
 {
@@ -63,6 +69,19 @@ public:
          */
     void onNewGame();
 
+    /**
+     * @brief Slot called when the autoplay menu action is toggled.
+     * @param enabled True to start playing bot-vs-bot games
+     */
+    void onAutoplayToggled(bool enabled);
+
+    /**
+     * @brief Slot called once per display frame during autoplay.
+     *
+     * Shows the latest snapshot and refreshes the games per second counter.
+     */
+    void onAutoplayFrame();
+
 private:
     /**
      * @brief Sets up the main UI layout and widgets.
@@ -99,13 +118,6 @@ private:
      */
     void updateOpeningRollDisplay() const;
 
-    /**
-     * @brief Creates a pixmap for a die with the specified value.
-     * @param value Die value (1-6)
-     * @return QPixmap showing the die face
-     */
-    [[nodiscard]] QPixmap dicePixmap(int value) const;
-
     std::unique_ptr<IGame> m_game;  ///< The game logic instance
 
     BoardWidget* m_boardWidget;              ///< Visual board representation
@@ -116,4 +128,11 @@ private:
     QLabel* m_diceImg2;                      ///< Image label for second die
     QLabel* m_openingDiceWhiteLabel;         ///< Label for white's opening die
     QLabel* m_openingDiceBlackLabel;         ///< Label for black's opening die
+    QAction* m_autoplayAction;               ///< Menu action toggling autoplay
+    QTimer* m_frameTimer;                    ///< Samples autoplay at the display refresh rate
+
+    AutoplayRunner m_autoplay;               ///< Bot-vs-bot games shown in autoplay mode
+    std::uint64_t m_snapshotVersion;         ///< Version of the autoplay snapshot on screen
+    std::uint64_t m_rateGames;               ///< Games finished when the rate clock was restarted
+    QElapsedTimer m_rateClock;               ///< Time since the games per second were last computed
 };
\ No newline at end of file
@@ -0,0 +1,178 @@
+/**
+ * @file BoardGeometry.hpp
+ * @brief Defines the layout of the board for a given widget size.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <QPoint>
+#include <QRect>
+#include <QSize>
+
+#include "Color.hpp"
+
+/**
+ * @enum BoardArea
+ * @brief Kind of board area under a position.
+ */
+enum class BoardArea {
+    NONE,     ///< Outside every area (e.g. leftover pixels next to a point)
+    POINT,    ///< One of the 24 points
+    BAR,      ///< The bar
+    BEAR_OFF  ///< The bear-off area
+};
+
+/**
+ * @struct BoardHit
+ * @brief Result of a hit test.
+ */
+struct BoardHit {
+    BoardArea area = BoardArea::NONE;  ///< Area under the position
+    int point = -1;                    ///< Point index (0-23) when area is POINT
+};
+
+/**
+ * @class BoardGeometry
+ * @brief Rectangles, triangles and checker positions of every board area.
+ *
+ * Computed once per size, so painting and hit-testing share the same numbers
+ * without redoing the layout math. The board is laid out as
+ *   top row:    11 10 9 8 7 6 | 5 4 3 2 1 0   | bear-off
+ *   bottom row: 12 13 14 15 16 17 | 18 19 20 21 22 23 | bear-off
+ * Only QtCore types are used, so the geometry also serves rendering into
+ * images without a widget.
+ */
+class BoardGeometry {
+public:
+    /// Width of the bear-off area on the right of the board
+    static constexpr int BEAR_OFF_WIDTH = 60;
+
+    /// Width of the bar between the two halves
+    static constexpr int BAR_WIDTH = 40;
+
+    /// Most checkers drawn on one stack
+    static constexpr int MAX_VISIBLE_CHECKERS = 15;
+
+    /// Checker radius on the bar
+    static constexpr int BAR_CHECKER_RADIUS = 18;
+
+    /// Checker radius in the bear-off area
+    static constexpr int BORNE_OFF_CHECKER_RADIUS = 12;
+
+    /**
+     * @brief Constructor creating the layout of an empty size.
+     */
+    BoardGeometry();
+
+    /**
+     * @brief Constructor computing the layout for a size.
+     * @param size Size of the whole board including the bear-off area
+     */
+    explicit BoardGeometry(const QSize& size);
+
+    /**
+     * @brief Gets the size the layout was computed for.
+     * @return Board size
+     */
+    QSize size() const;
+
+    /**
+     * @brief Gets the area of a point, covering its triangle and checkers.
+     * @param pointIndex Point index (0-23)
+     * @return Point area, empty for other indices
+     */
+    QRect pointRect(int pointIndex) const;
+
+    /**
+     * @brief Gets the base of a point's triangle.
+     * @param pointIndex Point index (0-23)
+     * @return Rectangle from the board edge to the tip of the triangle
+     */
+    QRect triangleRect(int pointIndex) const;
+
+    /**
+     * @brief Checks whether a point is in the top row.
+     * @param pointIndex Point index (0-23)
+     * @return True for points 0-11
+     */
+    static bool isTopRow(int pointIndex);
+
+    /**
+     * @brief Gets the area of the bar.
+     * @return Bar area
+     */
+    QRect barRect() const;
+
+    /**
+     * @brief Gets the bear-off area.
+     * @return Bear-off area
+     */
+    QRect bearOffRect() const;
+
+    /**
+     * @brief Gets the radius of checkers on the points.
+     * @return Radius in pixels
+     */
+    int checkerRadius() const;
+
+    /**
+     * @brief Gets the center of a checker on a point.
+     * @param pointIndex Point index (0-23)
+     * @param slot Position in the stack, 0 at the board edge
+     * @param count Checkers on the point (stacks of more than five are compressed)
+     * @return Checker center
+     */
+    QPoint checkerCenter(int pointIndex, int slot, int count) const;
+
+    /**
+     * @brief Gets the center of a checker on the bar.
+     * @param color Checker color (white stacks up from the middle, black down)
+     * @param slot Position in the stack, 0 nearest the middle
+     * @return Checker center
+     */
+    QPoint barCheckerCenter(Color color, int slot) const;
+
+    /**
+     * @brief Gets the center of a borne-off checker.
+     * @param color Checker color (white at the top, black at the bottom)
+     * @param slot Position in the stack, 0 at the board edge
+     * @param count Checkers borne off by the player
+     * @return Checker center
+     */
+    QPoint borneOffCheckerCenter(Color color, int slot, int count) const;
+
+    /**
+     * @brief Finds the area under a position in constant time.
+     * @param pos Position in board coordinates
+     * @return Area and point index
+     */
+    BoardHit hitTest(const QPoint& pos) const;
+
+private:
+    /// Column code of the x lookup table: 0-5 left half, 6-11 right half
+    static constexpr std::int8_t COLUMN_BAR = 12;
+    static constexpr std::int8_t COLUMN_BEAR_OFF = 13;
+    static constexpr std::int8_t COLUMN_NONE = -1;
+
+    /**
+     * @brief Gets the distance between stacked checkers.
+     * @param radius Checker radius
+     * @param count Checkers in the stack
+     * @return Step in pixels
+     */
+    static int stackSpacing(int radius, int count);
+
+    QSize m_size;                             ///< Board size
+    QRect m_barRect;                          ///< Bar area
+    QRect m_bearOffRect;                      ///< Bear-off area
+    std::array<QRect, 24> m_pointRects;       ///< Point areas
+    std::array<QRect, 24> m_triangleRects;    ///< Triangle bounds
+    std::array<QPoint, 24> m_firstCheckers;   ///< Center of the checker at the board edge
+    std::array<int, MAX_VISIBLE_CHECKERS + 1> m_pointSpacing;  ///< Stack step by checker count
+    int m_checkerRadius;                      ///< Radius of checkers on the points
+    std::vector<std::int8_t> m_columnAtX;     ///< Column code for every x coordinate
+};
@@ -7,11 +7,16 @@
 
 #include <vector>
 
+#include <QPixmap>
+#include <QRegion>
 #include <QWidget>
 
+#include "BoardGeometry.hpp"
 #include "GameStateDTO.hpp"
 #include "IGame.hpp"
 #include "IGameObserver.hpp"
+#include "MoveAnalyzer.hpp"
+#include "SpriteAtlas.hpp"
 
 class BackgammonUI;
 
@@ -26,6 +31,20 @@ class BackgammonUI;
  * - Move highlighting for selected pieces
  * - Mouse click handling for piece selection and movement
  * - Game over screen display
+ *
+ * Everything that only depends on the widget size (background, points, bar
+ * and bear-off area) is rendered once into a cached pixmap; the layout it is
+ * drawn from is kept in a BoardGeometry that painting and clicks share. State changes
+ * repaint only the regions of the points whose pieces or highlights changed.
+ *
+ * Observer callbacks do not touch the widget directly: they record what
+ * changed and queue a single flush() to the event loop, so the several
+ * notifications of one makeMove() (move, turn change, game end) cost one
+ * state pull, one repaint and one main window update.
+ *
+ * After every roll the position is analyzed on a worker thread and the best
+ * plays are drawn as hints once they arrive; any move or new game cancels
+ * the analysis and removes the hints.
  */
 class BoardWidget : public QWidget, public IGameObserver
 {
@@ -62,18 +81,52 @@ public:
      */
     void onMoveMade(Color player, int fromIndex, int toIndex, MoveResult result) override;
 
+    /**
+     * @brief Observer callback when a whole play is made.
+     * @param player Player who made the play
+     * @param play Moves of the play
+     */
+    void onPlayMade(Color player, const Play& play) override;
+
     /**
      * @brief Observer callback when the turn changes.
      * @param currentPlayer New current player
      */
     void onTurnChanged(Color currentPlayer) override;
 
+    /**
+     * @brief Observer callback when an earlier state is restored (undo).
+     */
+    void onStateRestored() override;
+
     /**
      * @brief Observer callback when the game finishes.
      * @param winner Winning player color
      */
     void onGameFinished(Color winner) override;
 
+    /**
+     * @brief Gets the dice and checker sprites for the widget's current device pixel ratio.
+     * @return Sprite atlas
+     */
+    const SpriteAtlas& sprites();
+
+    /**
+     * @brief Switches between playing the widget's game and only showing snapshots.
+     *
+     * In display-only mode clicks are ignored, no analysis runs and the board
+     * shows what showSnapshot() last passed. Leaving it shows the game again.
+     *
+     * @param displayOnly True to show snapshots only
+     */
+    void setDisplayOnly(bool displayOnly);
+
+    /**
+     * @brief Shows a state that does not come from the widget's game.
+     * @param state State to draw; only the regions that differ are repainted
+     */
+    void showSnapshot(const GameStateDTO& state);
+
 protected:
     /**
      * @brief Qt paint event handler - renders the board.
@@ -81,6 +134,12 @@ protected:
      */
     void paintEvent(QPaintEvent* event) override;
 
+    /**
+     * @brief Qt resize event handler - invalidates the cached board layer.
+     * @param event Resize event information
+     */
+    void resizeEvent(QResizeEvent* event) override;
+
     /**
      * @brief Qt mouse press event handler - handles piece selection and movement.
      * @param event Mouse event information
@@ -97,11 +156,33 @@ private:
 
     Color m_winner;  ///< Winner color when game is finished
 
+    QPixmap m_staticLayer;  ///< Cached board without pieces or highlights, at the device pixel ratio
+    SpriteAtlas m_sprites;  ///< Dice and checker images all drawing blits from
+    BoardGeometry m_geometry;  ///< Layout for the current widget size
+
+    MoveAnalyzer m_analyzer;          ///< Ranks the plays after each roll off the GUI thread
+    std::vector<RankedPlay> m_hints;  ///< Best plays of the latest analysis, best first
+
+    unsigned m_pendingFlush;  ///< Work collected for the next flush()
+    bool m_flushQueued;       ///< Whether a flush() is already queued
+    bool m_displayOnly;       ///< Whether snapshots are shown instead of the game
+
     /**
      * @brief Refreshes the cached game state from the game logic.
      */
     void refreshState();
 
+    /**
+     * @brief Records pending work and queues a flush() unless one is queued already.
+     * @param flags Work to add
+     */
+    void scheduleFlush(unsigned flags);
+
+    /**
+     * @brief Performs the work collected since the last flush, once per event-loop pass.
+     */
+    void flush();
+
     /**
      * @brief Clears the current piece selection.
      */
@@ -126,16 +207,13 @@ private:
     void drawTriangle(QPainter& painter, int x, int y, int width, int height, bool pointUp, int pointIndex);
 
     /**
-     * @brief Draws pieces stacked at a point.
+     * @brief Draws one piece.
      * @param painter QPainter for drawing
-     * @param centerX X coordinate of point center
-     * @param centerY Y coordinate of point center
-     * @param count Number of pieces
-     * @param color Color of pieces
-     * @param radius Radius of each piece
-     * @param isTopRow Whether this is the top row of the board
+     * @param sprite Checker sprite
+     * @param radius Radius the sprite was rendered at
+     * @param center Center of the piece
      */
-    void drawPiecesAtPoint(QPainter& painter, int centerX, int centerY, int count, Color color, int radius, bool isTopRow);
+    void drawChecker(QPainter& painter, const QPixmap& sprite, int radius, const QPoint& center);
 
     /**
      * @brief Draws pieces on the bar.
@@ -151,10 +229,16 @@ private:
     void drawBoard(QPainter& p);
 
     /**
-     * @brief Draws all pieces on the board.
+     * @brief Renders the board structure into the cached pixmap if the size or pixel ratio changed.
+     */
+    void ensureStaticLayer();
+
+    /**
+     * @brief Draws the pieces on the board that intersect a region.
      * @param p QPainter for drawing
+     * @param region Region being repainted
      */
-    void drawPieces(QPainter& p);
+    void drawPieces(QPainter& p, const QRegion& region);
 
     /**
      * @brief Draws selection and legal move highlights.
@@ -162,12 +246,63 @@ private:
      */
     void drawHighlights(QPainter& p);
 
+    /**
+     * @brief Draws the best plays of the latest analysis as arrows.
+     * @param p QPainter for drawing
+     */
+    void drawHints(QPainter& p);
+
     /**
      * @brief Draws the game over panel with winner announcement.
      * @param p QPainter for drawing
      */
     void drawGameOverPanel(QPainter& p);
 
+    /**
+     * @brief Gets the area of a point, covering its triangle and pieces.
+     * @param pointIndex Point index (0-23) or Game::BAR_INDEX
+     * @return Point area, empty for other indices
+     */
+    QRect pointRect(int pointIndex) const;
+
+    /**
+     * @brief Gets the region covered by the selection and legal move highlights.
+     * @return Highlighted region
+     */
+    QRegion highlightRegion() const;
+
+    /**
+     * @brief Gets the region covered by the hint arrows.
+     * @return Hint region
+     */
+    QRegion hintRegion() const;
+
+    /**
+     * @brief Gets the center of an area a hint arrow starts or ends at.
+     * @param index Point index, Game::BAR_INDEX or a bear-off value
+     * @return Center of the area
+     */
+    QPoint hintAnchor(int index) const;
+
+    /**
+     * @brief Shows the plays of a completed analysis.
+     * @param analysis Ranked plays
+     */
+    void showAnalysis(const MoveAnalysis& analysis);
+
+    /**
+     * @brief Cancels the running analysis and removes the hints.
+     */
+    void clearHints();
+
+    /**
+     * @brief Gets the region whose pieces differ between two states.
+     * @param before Previous state
+     * @param after New state
+     * @return Region to repaint
+     */
+    QRegion changedRegion(const GameStateDTO& before, const GameStateDTO& after) const;
+
     /**
      * @brief Converts screen coordinates to point index.
      * @param pos Mouse position
@@ -0,0 +1,112 @@
+/**
+ * @file MoveAnalyzer.hpp
+ * @brief Defines the MoveAnalyzer class ranking plays on a background thread.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QObject>
+#include <QThread>
+
+#include "GameStateDTO.hpp"
+#include "HeuristicEvaluator.hpp"
+
+/**
+ * @struct MoveAnalysis
+ * @brief Best plays found for one position.
+ */
+struct MoveAnalysis {
+    quint64 request = 0;            ///< Number of the request the analysis answers
+    std::vector<RankedPlay> plays;  ///< Best plays, best first
+};
+
+Q_DECLARE_METATYPE(MoveAnalysis)
+
+/**
+ * @class AnalysisWorker
+ * @brief Runs the analysis requests; lives on the analyzer's thread.
+ */
+class AnalysisWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Ranks the plays of a position and reports them unless cancelled.
+     * @param request Request number echoed in the result
+     * @param state Position with the dice rolled
+     * @param cancel Flag set by the analyzer once the result is no longer wanted
+     */
+    void analyze(quint64 request, const GameStateDTO& state, const std::shared_ptr<std::atomic<bool>>& cancel);
+
+signals:
+    /**
+     * @brief Emitted on the worker thread when an analysis completes.
+     * @param analysis Ranked plays
+     */
+    void finished(const MoveAnalysis& analysis);
+};
+
+/**
+ * @class MoveAnalyzer
+ * @brief Ranks the plays of a position without blocking the GUI thread.
+ *
+ * Requests are queued to a worker thread; results come back through a
+ * queued signal. Starting a new request or calling cancel() raises the
+ * cancel flag of the running one, which the search checks between
+ * candidate plays, and discards any result still in flight, so
+ * analysisReady is only emitted for the latest request.
+ */
+class MoveAnalyzer : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// Number of plays reported per analysis
+    static constexpr int MAX_PLAYS = 3;
+
+    /**
+     * @brief Constructor starting the worker thread.
+     * @param parent Optional parent object
+     */
+    explicit MoveAnalyzer(QObject* parent = nullptr);
+
+    /**
+     * @brief Destructor cancelling the analysis and stopping the worker thread.
+     */
+    ~MoveAnalyzer() override;
+
+    /**
+     * @brief Starts analyzing a position, cancelling the previous analysis.
+     * @param state Position with the dice rolled
+     */
+    void analyze(const GameStateDTO& state);
+
+    /**
+     * @brief Cancels the running analysis; its result is never reported.
+     */
+    void cancel();
+
+signals:
+    /**
+     * @brief Emitted on the GUI thread when the latest analysis completes.
+     * @param analysis Ranked plays
+     */
+    void analysisReady(const MoveAnalysis& analysis);
+
+private:
+    /**
+     * @brief Forwards a worker result unless a newer request superseded it.
+     * @param analysis Ranked plays
+     */
+    void onFinished(const MoveAnalysis& analysis);
+
+    QThread m_thread;                               ///< Thread the worker runs on
+    AnalysisWorker* m_worker;                       ///< Worker owned by this analyzer
+    quint64 m_request;                              ///< Number of the latest request
+    std::shared_ptr<std::atomic<bool>> m_cancel;    ///< Cancel flag of the running request
+};
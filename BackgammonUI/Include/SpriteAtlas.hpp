@@ -0,0 +1,90 @@
+/**
+ * @file SpriteAtlas.hpp
+ * @brief Defines the pre-rendered dice and checker images used by the UI.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <QPixmap>
+
+#include "Color.hpp"
+
+/**
+ * @class SpriteAtlas
+ * @brief Dice faces and checkers rendered once at the current device pixel ratio.
+ *
+ * Dice images are decoded from the resources and scaled once; checkers are
+ * rasterized once per radius. Painting then only blits pixmaps. Everything
+ * is rebuilt when ensure() sees a different device pixel ratio, e.g. after
+ * the window moved to another screen.
+ */
+class SpriteAtlas {
+public:
+    /// Logical size of a die face in pixels
+    static constexpr int DICE_SIZE = 48;
+
+    /**
+     * @brief Constructor creating an empty atlas; call ensure() before use.
+     */
+    SpriteAtlas();
+
+    /**
+     * @brief Builds the sprites for a device pixel ratio unless they already match it.
+     * @param devicePixelRatio Ratio of the screen the sprites are drawn on
+     */
+    void ensure(qreal devicePixelRatio);
+
+    /**
+     * @brief Gets the device pixel ratio the sprites were built for.
+     * @return Device pixel ratio (0 before the first ensure())
+     */
+    qreal devicePixelRatio() const;
+
+    /**
+     * @brief Gets a die face.
+     * @param value Die value (1-6)
+     * @return Face of DICE_SIZE logical pixels, or a null pixmap for other values
+     */
+    const QPixmap& die(int value) const;
+
+    /**
+     * @brief Gets a checker, rasterizing it on first use of the radius.
+     * @param color Checker color
+     * @param radius Radius in logical pixels
+     * @return Square checker image of checkerSize(radius) logical pixels
+     */
+    const QPixmap& checker(Color color, int radius);
+
+    /**
+     * @brief Gets the logical edge length of a checker image, including its border.
+     * @param radius Radius in logical pixels
+     * @return Edge length
+     */
+    static int checkerSize(int radius);
+
+private:
+    /**
+     * @struct CheckerSprites
+     * @brief Both checker colors at one radius.
+     */
+    struct CheckerSprites {
+        int radius = 0;   ///< Radius in logical pixels
+        QPixmap white;    ///< White checker
+        QPixmap black;    ///< Black checker
+    };
+
+    /**
+     * @brief Rasterizes one checker.
+     * @param color Checker color
+     * @param radius Radius in logical pixels
+     * @return Checker image
+     */
+    QPixmap renderChecker(Color color, int radius) const;
+
+    qreal m_devicePixelRatio;                ///< Ratio the sprites were built for
+    std::array<QPixmap, 6> m_dice;           ///< Die faces 1-6
+    std::vector<CheckerSprites> m_checkers;  ///< Checkers by radius
+};
@@ -0,0 +1,77 @@
+/**
+ * @file AutoplayRunner.cpp
+ * @brief Implementation of the background bot-vs-bot games.
+ */
+
+#include "AutoplayRunner.hpp"
+
+#include <random>
+
+#include "Game.hpp"
+#include "HeuristicEvaluator.hpp"
+
+AutoplayRunner::AutoplayRunner() : m_stop(false), m_games(0), m_publisher(m_game) {
+}
+
+AutoplayRunner::~AutoplayRunner() {
+    stop();
+}
+
+void AutoplayRunner::start() {
+    if (m_thread.joinable()) return;
+    m_stop = false;
+    m_games = 0;
+    m_thread = std::thread([this]() { run(); });
+}
+
+void AutoplayRunner::stop() {
+    if (!m_thread.joinable()) return;
+    m_stop = true;
+    m_thread.join();
+}
+
+bool AutoplayRunner::isRunning() const {
+    return m_thread.joinable();
+}
+
+std::uint64_t AutoplayRunner::gamesPlayed() const {
+    return m_games.load(std::memory_order_relaxed);
+}
+
+bool AutoplayRunner::latest(std::uint64_t& version, GameStateDTO& state) const {
+    const std::shared_ptr<const GameSnapshot> snapshot = m_publisher.current();
+    if (!snapshot || snapshot->version == version) return false;
+    version = snapshot->version;
+    state = snapshot->state;
+    return true;
+}
+
+void AutoplayRunner::run() {
+    // One generator for the whole run; rollDice() would open the random device on every roll
+    std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<int> die(1, 6);
+    HeadlessGame& game = m_game;
+
+    while (!m_stop.load(std::memory_order_relaxed)) {
+        do {
+            game.start();
+            game.rollOpeningDice(die(rng));
+            game.rollOpeningDice(die(rng));
+        } while (game.getOpeningDiceWhite() == game.getOpeningDiceBlack());
+        game.startGameAfterOpening();
+
+        while (game.getPhase() == GamePhase::IN_PROGRESS && !m_stop.load(std::memory_order_relaxed)) {
+            game.rollDice(die(rng), die(rng));
+            m_publisher.publish();
+
+            Play play;
+            float equity = 0.0f;
+            // The whole turn in one step; an empty play passes
+            if (!HeuristicEvaluator::bestPlay(game, play, equity) || game.makePlay(play) != MoveResult::SUCCESS) {
+                game.passTurn();
+            }
+            m_publisher.publish();
+        }
+        if (game.getPhase() == GamePhase::FINISHED) m_games.fetch_add(1, std::memory_order_relaxed);
+    }
+}
@@ -12,17 +12,21 @@
 #include <QLabel>
 #include <QMenuBar>
 #include <QPushButton>
+#include <QScreen>
+#include <QTimer>
 #include <QVBoxLayout>
 #include <QWidget>
 
 #include "BoardWidget.hpp"
 #include "Game.hpp"
+#include "SpriteAtlas.hpp"
 
 namespace {
     constexpr int WINDOW_WIDTH = 1000;     ///< Default window width
     constexpr int WINDOW_HEIGHT = 650;     ///< Default window height
-    constexpr int DICE_SIZE = 48;          ///< Size of dice images in pixels
     constexpr int DICE_SPACING = 8;        ///< Spacing between dice images
+    constexpr qreal DEFAULT_REFRESH_RATE = 60.0;  ///< Frame rate when the screen reports none
+    constexpr qint64 RATE_INTERVAL_MS = 500;      ///< Period of the games per second update
 
     /// Stylesheet for the player label
     const QString PLAYER_LABEL_STYLE = "font-size: 14pt; font-weight: bold; padding: 5px;";
@@ -32,9 +36,6 @@ namespace {
 
     /// Stylesheet for the status message label
     const QString STATUS_LABEL_STYLE = "font-size: 11pt; padding: 5px; background-color: #000000; color: white;";
-
-    /// Template for dice image resource paths
-    const QString DICE_PATH_TEMPLATE = ":/BackgammonUI/assets/assets/dice%1.png";
 }
 
 BackgammonUI::BackgammonUI(QWidget *parent)
@@ -47,7 +48,11 @@ BackgammonUI::BackgammonUI(QWidget *parent)
       , m_diceImg1(nullptr)
       , m_diceImg2(nullptr)
       , m_openingDiceWhiteLabel(nullptr)
-      , m_openingDiceBlackLabel(nullptr) {
+      , m_openingDiceBlackLabel(nullptr)
+      , m_autoplayAction(nullptr)
+      , m_frameTimer(nullptr)
+      , m_snapshotVersion(0)
+      , m_rateGames(0) {
 
     m_game->start();
 
@@ -60,23 +65,14 @@ BackgammonUI::BackgammonUI(QWidget *parent)
 }
 
 BackgammonUI::~BackgammonUI() {
+    m_autoplay.stop();
+
     // Remove observer before game is destroyed
     if (m_boardWidget && m_game) {
         m_game->removeObserver(m_boardWidget);
     }
 }
 
-QPixmap BackgammonUI::dicePixmap(int value) const
-{
-	if (value >= 1 && value <= 6) {
-		qDebug() << "Loading dice:" << value;
-		QString path = QString(":/BackgammonUI/assets/dice%1.png").arg(value);
-		QPixmap pixmap(path);
-		return pixmap;
-	}
-	return QPixmap();
-}
-
 void BackgammonUI::setupUi() {
     resize(WINDOW_WIDTH, WINDOW_HEIGHT);
     setWindowTitle("Backgammon");
@@ -116,10 +112,9 @@ void BackgammonUI::setupUi() {
     m_diceImg1 = new QLabel(diceBox);
     m_diceImg2 = new QLabel(diceBox);
 
-    m_diceImg1->setFixedSize(DICE_SIZE, DICE_SIZE);
-    m_diceImg2->setFixedSize(DICE_SIZE, DICE_SIZE);
-    m_diceImg1->setScaledContents(true);
-    m_diceImg2->setScaledContents(true);
+    // The sprites already have the label size at the screen's pixel ratio
+    m_diceImg1->setFixedSize(SpriteAtlas::DICE_SIZE, SpriteAtlas::DICE_SIZE);
+    m_diceImg2->setFixedSize(SpriteAtlas::DICE_SIZE, SpriteAtlas::DICE_SIZE);
 
     diceLayout->addWidget(m_diceImg1);
     diceLayout->addWidget(m_diceImg2);
@@ -157,10 +152,19 @@ void BackgammonUI::setupMenu() {
     auto *newGameAction = new QAction("New Game", this);
     connect(newGameAction, &QAction::triggered, this, &BackgammonUI::onNewGame);
     gameMenu->addAction(newGameAction);
+
+    m_autoplayAction = new QAction("Autoplay (Bot vs Bot)", this);
+    m_autoplayAction->setCheckable(true);
+    connect(m_autoplayAction, &QAction::toggled, this, &BackgammonUI::onAutoplayToggled);
+    gameMenu->addAction(m_autoplayAction);
+
+    m_frameTimer = new QTimer(this);
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_frameTimer, &QTimer::timeout, this, &BackgammonUI::onAutoplayFrame);
 }
 
 void BackgammonUI::updateUI() {
-    if (!m_game) {
+    if (!m_game || m_autoplay.isRunning()) {
         return;
     }
 
@@ -231,18 +235,19 @@ void BackgammonUI::updateUI() {
 }
 
 void BackgammonUI::updateDiceDisplay(int dice1, int dice2) const {
-    if (!m_diceImg1 || !m_diceImg2) {
+    if (!m_diceImg1 || !m_diceImg2 || !m_boardWidget) {
         return;
     }
 
+    const SpriteAtlas& sprites = m_boardWidget->sprites();
     if (dice1 > 0) {
-        m_diceImg1->setPixmap(dicePixmap(dice1));
+        m_diceImg1->setPixmap(sprites.die(dice1));
     } else {
         m_diceImg1->clear();
     }
 
     if (dice2 > 0) {
-        m_diceImg2->setPixmap(dicePixmap(dice2));
+        m_diceImg2->setPixmap(sprites.die(dice2));
     } else {
         m_diceImg2->clear();
     }
@@ -297,7 +302,7 @@ void BackgammonUI::updateOpeningRollDisplay() const {
 }
 
 void BackgammonUI::onRollDice() {
-    if (!m_game) {
+    if (!m_game || m_autoplay.isRunning()) {
         return;
     }
 
@@ -349,6 +354,9 @@ void BackgammonUI::onNewGame() {
         return;
     }
 
+    if (m_autoplayAction && m_autoplayAction->isChecked()) {
+        m_autoplayAction->setChecked(false);
+    }
 
     if (m_openingDiceWhiteLabel) m_openingDiceWhiteLabel->show();
     if (m_openingDiceBlackLabel) m_openingDiceBlackLabel->show();
@@ -356,3 +364,52 @@ void BackgammonUI::onNewGame() {
     m_game->start();
     updateUI();
 }
+
+void BackgammonUI::onAutoplayToggled(bool enabled) {
+    if (enabled) {
+        m_boardWidget->setDisplayOnly(true);
+        m_rollButton->setEnabled(false);
+        if (m_openingDiceWhiteLabel) m_openingDiceWhiteLabel->hide();
+        if (m_openingDiceBlackLabel) m_openingDiceBlackLabel->hide();
+        m_statusLabel->setText("Autoplay: starting");
+
+        m_snapshotVersion = 0;
+        m_rateGames = 0;
+        m_rateClock.start();
+        m_autoplay.start();
+
+        // Frames faster than the screen shows them would only be thrown away
+        const qreal refreshRate = (screen() && screen()->refreshRate() > 0) ? screen()->refreshRate() : DEFAULT_REFRESH_RATE;
+        m_frameTimer->start(qMax(1, qRound(1000.0 / refreshRate)));
+        return;
+    }
+
+    m_frameTimer->stop();
+    m_autoplay.stop();
+    m_boardWidget->setDisplayOnly(false);
+    if (m_game && (m_game->getPhase() == GamePhase::OPENING_ROLL_WHITE || m_game->getPhase() == GamePhase::OPENING_ROLL_BLACK)) {
+        if (m_openingDiceWhiteLabel) m_openingDiceWhiteLabel->show();
+        if (m_openingDiceBlackLabel) m_openingDiceBlackLabel->show();
+    }
+    updateUI();
+}
+
+void BackgammonUI::onAutoplayFrame() {
+    GameStateDTO state;
+    if (m_autoplay.latest(m_snapshotVersion, state)) {
+        m_boardWidget->showSnapshot(state);
+        updateDiceDisplay(state.dice1, state.dice2);
+        updatePlayerDisplay(state.currentPlayer);
+    }
+
+    const qint64 elapsed = m_rateClock.elapsed();
+    if (elapsed < RATE_INTERVAL_MS) {
+        return;
+    }
+    const std::uint64_t games = m_autoplay.gamesPlayed();
+    const double rate = static_cast<double>(games - m_rateGames) * 1000.0 / static_cast<double>(elapsed);
+    m_rateGames = games;
+    m_rateClock.restart();
+    m_statusLabel->setText("Autoplay: " + QString::number(static_cast<unsigned long long>(games)) + " games, " +
+                           QString::number(rate, 'f', 1) + " games/s");
+}
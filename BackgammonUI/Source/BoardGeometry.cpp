@@ -0,0 +1,180 @@
+/**
+ * @file BoardGeometry.cpp
+ * @brief Implementation of the board layout tables.
+ */
+
+#include "BoardGeometry.hpp"
+
+#include <algorithm>
+
+namespace {
+    /// Largest radius of checkers on the points
+    constexpr int MAX_CHECKER_RADIUS = 22;
+
+    /// Gap between a checker and the sides of its point
+    constexpr int CHECKER_MARGIN = 5;
+
+    /// Gap between the board edge and the first borne-off checker
+    constexpr int BORNE_OFF_MARGIN = 10;
+
+    /// Distance between the middle of the board and the first checker on the bar
+    constexpr int BAR_OFFSET = 50;
+
+    /// Distance between checkers stacked on the bar
+    constexpr int BAR_SPACING = 20;
+
+    /// Gap left at the tip of each triangle before the middle of the board
+    constexpr int TRIANGLE_GAP = 20;
+
+    /// Stacks taller than this are compressed into the same height
+    constexpr int UNCOMPRESSED_STACK = 5;
+}
+
+BoardGeometry::BoardGeometry() : BoardGeometry(QSize(0, 0)) {
+}
+
+BoardGeometry::BoardGeometry(const QSize& size) : m_size(size) {
+    const int w = std::max(size.width() - BEAR_OFF_WIDTH, 0);
+    const int h = size.height();
+    const int barX = w / 2 - BAR_WIDTH / 2;
+    const int rightX = barX + BAR_WIDTH;
+    const int leftTriangleWidth = std::max(barX / 6, 0);
+    const int rightTriangleWidth = std::max((w - rightX) / 6, 0);
+    const int triangleHeight = h / 2 - TRIANGLE_GAP;
+
+    m_barRect = QRect(barX, 0, BAR_WIDTH, h);
+    m_bearOffRect = QRect(w, 0, BEAR_OFF_WIDTH, h);
+    m_checkerRadius = std::min(leftTriangleWidth / 2 - CHECKER_MARGIN, MAX_CHECKER_RADIUS);
+
+    for (int col = 0; col < 6; ++col) {
+        // Left half: top 11..6, bottom 12..17; right half: top 5..0, bottom 18..23
+        const int columns[4][3] = {
+            { 11 - col, col * leftTriangleWidth, leftTriangleWidth },
+            { 12 + col, col * leftTriangleWidth, leftTriangleWidth },
+            { 5 - col, rightX + col * rightTriangleWidth, rightTriangleWidth },
+            { 18 + col, rightX + col * rightTriangleWidth, rightTriangleWidth },
+        };
+        for (const auto& column : columns) {
+            const int point = column[0];
+            const int x = column[1];
+            const int triangleWidth = column[2];
+            const bool top = isTopRow(point);
+            m_pointRects[point] = QRect(x, top ? 0 : h / 2, triangleWidth, h / 2);
+            m_triangleRects[point] = QRect(x, top ? 0 : h - triangleHeight, triangleWidth, triangleHeight);
+            m_firstCheckers[point] = QPoint(x + triangleWidth / 2,
+                                            top ? m_checkerRadius + CHECKER_MARGIN : h - m_checkerRadius - CHECKER_MARGIN);
+        }
+    }
+
+    for (int count = 0; count <= MAX_VISIBLE_CHECKERS; ++count) {
+        m_pointSpacing[count] = stackSpacing(m_checkerRadius, count);
+    }
+
+    // Same bounds as the former per-click arithmetic: the bar includes both
+    // of its edges and pixels left over by the integer point widths hit nothing
+    m_columnAtX.assign(static_cast<std::size_t>(std::max(size.width(), 0)), COLUMN_NONE);
+    for (int x = 0; x < static_cast<int>(m_columnAtX.size()); ++x) {
+        std::int8_t column = COLUMN_NONE;
+        if (x > w) {
+            column = COLUMN_BEAR_OFF;
+        }
+        else if (x >= barX && x <= rightX) {
+            column = COLUMN_BAR;
+        }
+        else if (x < barX) {
+            if (leftTriangleWidth > 0 && x / leftTriangleWidth < 6) {
+                column = static_cast<std::int8_t>(x / leftTriangleWidth);
+            }
+        }
+        else if (x < w) {
+            if (rightTriangleWidth > 0 && (x - rightX) / rightTriangleWidth < 6) {
+                column = static_cast<std::int8_t>(6 + (x - rightX) / rightTriangleWidth);
+            }
+        }
+        m_columnAtX[x] = column;
+    }
+}
+
+QSize BoardGeometry::size() const {
+    return m_size;
+}
+
+QRect BoardGeometry::pointRect(int pointIndex) const {
+    if (pointIndex < 0 || pointIndex >= 24) return QRect();
+    return m_pointRects[pointIndex];
+}
+
+QRect BoardGeometry::triangleRect(int pointIndex) const {
+    if (pointIndex < 0 || pointIndex >= 24) return QRect();
+    return m_triangleRects[pointIndex];
+}
+
+bool BoardGeometry::isTopRow(int pointIndex) {
+    return pointIndex < 12;
+}
+
+QRect BoardGeometry::barRect() const {
+    return m_barRect;
+}
+
+QRect BoardGeometry::bearOffRect() const {
+    return m_bearOffRect;
+}
+
+int BoardGeometry::checkerRadius() const {
+    return m_checkerRadius;
+}
+
+QPoint BoardGeometry::checkerCenter(int pointIndex, int slot, int count) const {
+    const int spacing = count <= MAX_VISIBLE_CHECKERS ? m_pointSpacing[count] : stackSpacing(m_checkerRadius, count);
+    const int offset = slot * spacing;
+    const QPoint& first = m_firstCheckers[pointIndex];
+    return QPoint(first.x(), isTopRow(pointIndex) ? first.y() + offset : first.y() - offset);
+}
+
+QPoint BoardGeometry::barCheckerCenter(Color color, int slot) const {
+    const int x = m_barRect.x() + BAR_WIDTH / 2;
+    const int middle = m_size.height() / 2;
+    if (color == Color::WHITE) return QPoint(x, middle - BAR_OFFSET - slot * BAR_SPACING);
+    return QPoint(x, middle + BAR_OFFSET + slot * BAR_SPACING);
+}
+
+QPoint BoardGeometry::borneOffCheckerCenter(Color color, int slot, int count) const {
+    const int x = m_bearOffRect.x() + BEAR_OFF_WIDTH / 2;
+    const int offset = slot * stackSpacing(BORNE_OFF_CHECKER_RADIUS, count);
+    // Aligned with the point checkers, whose radius sets the distance from the edge
+    if (color == Color::WHITE) return QPoint(x, m_checkerRadius + BORNE_OFF_MARGIN + offset);
+    return QPoint(x, m_size.height() - m_checkerRadius - BORNE_OFF_MARGIN - offset);
+}
+
+BoardHit BoardGeometry::hitTest(const QPoint& pos) const {
+    BoardHit hit;
+    if (pos.x() < 0) return hit;
+    if (pos.x() >= static_cast<int>(m_columnAtX.size())) {
+        // Clicks past the right edge, e.g. while the mouse is grabbed
+        if (pos.x() > m_bearOffRect.x()) hit.area = BoardArea::BEAR_OFF;
+        return hit;
+    }
+
+    const std::int8_t column = m_columnAtX[pos.x()];
+    if (column == COLUMN_NONE) return hit;
+    if (column == COLUMN_BAR) {
+        hit.area = BoardArea::BAR;
+        return hit;
+    }
+    if (column == COLUMN_BEAR_OFF) {
+        hit.area = BoardArea::BEAR_OFF;
+        return hit;
+    }
+
+    const bool top = pos.y() < m_size.height() / 2;
+    hit.area = BoardArea::POINT;
+    if (column < 6) hit.point = top ? 11 - column : 12 + column;
+    else hit.point = top ? 5 - (column - 6) : 18 + (column - 6);
+    return hit;
+}
+
+int BoardGeometry::stackSpacing(int radius, int count) {
+    if (count > UNCOMPRESSED_STACK) return (radius * 2 * UNCOMPRESSED_STACK) / count;
+    return radius * 2 + 2;
+}
@@ -6,6 +6,7 @@
  * - Drawing the 24 triangular points
  * - Rendering pieces with correct colors and stacking
  * - Highlighting selected pieces and legal moves
+ * - Showing the best plays found by the background analysis
  * - Converting mouse clicks to board coordinates
  * - Handling game-over display
  */
@@ -13,92 +14,221 @@
 #include "BoardWidget.hpp"
 #include "BackgammonUI.hpp"
 #include "Game.hpp"
+#include "Tracing.hpp"
 #include <QPainter>
 #include <QMouseEvent>
 #include <QMessageBox> 
+#include <QMetaObject>
+#include <QPaintEvent>
 #include <algorithm>
-
-/// Width of the bear-off area on each side of the board
-constexpr int BEAR_OFF_WIDTH = 60;
+#include <cstdlib>
+
+namespace {
+    /// Pending work of the next flush(), collected from the observer callbacks
+    enum FlushFlags : unsigned {
+        FLUSH_STATE = 1u << 0,         ///< Pull the game state and repaint what changed
+        FLUSH_FULL_REPAINT = 1u << 1,  ///< Repaint the whole board (game-over panel shown or removed)
+        FLUSH_ANALYSIS = 1u << 2,      ///< Analyze the rolled position
+        FLUSH_MAIN_WINDOW = 1u << 3,   ///< Refresh the main window's labels and dice
+        FLUSH_GAME_OVER = 1u << 4      ///< Announce the winner
+    };
+
+    /// Width of the arrow drawn for the best play
+    constexpr int HINT_PEN_WIDTH = 4;
+
+    /// Radius of the dot marking where a hinted checker lands
+    constexpr int HINT_MARKER_RADIUS = 5;
+}
 
 BoardWidget::BoardWidget(QWidget* parent, IGame* game, BackgammonUI* mainWindow)
     : QWidget(parent),
     m_game(game),
     m_mainWindow(mainWindow),
     m_selectedPoint(-1),
-    m_winner(Color::NONE)
+    m_winner(Color::NONE),
+    m_geometry(size()),
+    m_pendingFlush(0),
+    m_flushQueued(false),
+    m_displayOnly(false)
 {
     setMinimumSize(960, 500);
+    // paintEvent covers every pixel, so Qt need not clear the background first
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    m_sprites.ensure(devicePixelRatioF());
+    connect(&m_analyzer, &MoveAnalyzer::analysisReady, this, &BoardWidget::showAnalysis);
     if (m_game) {
         m_state = m_game->getState();
     }
 }
 
-void BoardWidget::refreshState() {
-    if (m_game) {
-        m_state = m_game->getState();
-    }
+const SpriteAtlas& BoardWidget::sprites() {
+    m_sprites.ensure(devicePixelRatioF());
+    return m_sprites;
+}
+
+void BoardWidget::setDisplayOnly(bool displayOnly) {
+    if (displayOnly == m_displayOnly) return;
+    clearHints();
+    clearSelection();
+    m_displayOnly = displayOnly;
+    // The game-over panel appears or disappears with the mode
     update();
+    if (!displayOnly) refreshState();
+}
+
+void BoardWidget::showSnapshot(const GameStateDTO& state) {
+    const GameStateDTO previous = m_state;
+    m_state = state;
+    const QRegion dirty = changedRegion(previous, m_state);
+    if (!dirty.isEmpty()) update(dirty);
+}
+
+void BoardWidget::refreshState() {
+    if (!m_game) return;
+    const GameStateDTO previous = m_state;
+    m_state = m_game->getState();
+    const QRegion dirty = changedRegion(previous, m_state);
+    if (!dirty.isEmpty()) update(dirty);
 }
 
 void BoardWidget::clearSelection() {
+    if (m_selectedPoint == -1 && m_legalTargets.empty()) return;
+    const QRegion previous = highlightRegion();
     m_selectedPoint = -1;
     m_legalTargets.clear();
-    update();
+    update(previous);
 }
 
 void BoardWidget::selectPoint(int index) {
     if (!m_game) return;
     if (m_winner != Color::NONE) return;
 
+    const QRegion previous = highlightRegion();
     m_selectedPoint = index;
     m_legalTargets = m_game->getLegalTargets(index);
-    update();
+    update(previous | highlightRegion());
 }
 
 void BoardWidget::onGameStarted() {
+    // Removing the game-over panel touches the whole board
+    const unsigned repaint = (m_winner != Color::NONE) ? FLUSH_FULL_REPAINT : 0u;
     m_winner = Color::NONE; 
+    clearHints();
     clearSelection();
-    refreshState();
+    scheduleFlush(FLUSH_STATE | repaint);
 }
 
-void BoardWidget::onDiceRolled(Color, int, int) { refreshState(); }
+void BoardWidget::onDiceRolled(Color, int, int) {
+    clearHints();
+    scheduleFlush(FLUSH_STATE | FLUSH_ANALYSIS);
+}
 
 void BoardWidget::onMoveMade(Color, int, int, MoveResult) {
-    refreshState();
-    if (m_mainWindow) m_mainWindow->updateUI();
+    clearHints();
+    scheduleFlush(FLUSH_STATE | FLUSH_MAIN_WINDOW);
+}
+
+void BoardWidget::onPlayMade(Color, const Play&) {
+    clearHints();
+    scheduleFlush(FLUSH_STATE | FLUSH_MAIN_WINDOW);
 }
 
 void BoardWidget::onTurnChanged(Color) {
+    clearHints();
+    clearSelection();
+    scheduleFlush(FLUSH_STATE | FLUSH_MAIN_WINDOW);
+}
+
+void BoardWidget::onStateRestored() {
+    // Undoing the winning move removes the game-over panel
+    unsigned repaint = 0u;
+    if (m_winner != Color::NONE && m_game->getPhase() != GamePhase::FINISHED) {
+        m_winner = Color::NONE;
+        repaint = FLUSH_FULL_REPAINT;
+    }
+    clearHints();
     clearSelection();
-    refreshState();
-    if (m_mainWindow) m_mainWindow->updateUI();
+    scheduleFlush(FLUSH_STATE | FLUSH_MAIN_WINDOW | repaint);
 }
 
 void BoardWidget::onGameFinished(Color winner) {
     m_winner = winner;
+    clearHints();
     clearSelection();
-    refreshState();
+    scheduleFlush(FLUSH_STATE | FLUSH_FULL_REPAINT | FLUSH_GAME_OVER);
+}
 
-    QString winnerName = (winner == Color::WHITE) ? "Color::WHITE" : "BLACK";
-    QMessageBox::information(this, "Game Over",
-        "Congratulations! Player " + winnerName + " has won the game!");
+void BoardWidget::scheduleFlush(unsigned flags) {
+    // A move and the turn change it causes can leave an earlier roll unanalyzed
+    if (flags & FLUSH_STATE) m_pendingFlush &= ~FLUSH_ANALYSIS;
+    m_pendingFlush |= flags;
+    if (m_flushQueued) return;
+    m_flushQueued = true;
+    QMetaObject::invokeMethod(this, [this]() { flush(); }, Qt::QueuedConnection);
+}
+
+void BoardWidget::flush() {
+    BG_TRACE_SCOPE("BoardWidget::flush");
+    const unsigned flags = m_pendingFlush;
+    m_pendingFlush = 0;
+    m_flushQueued = false;
+
+    if ((flags & FLUSH_STATE) && !m_displayOnly) refreshState();
+    if (flags & FLUSH_FULL_REPAINT) update();
+    if ((flags & FLUSH_ANALYSIS) && !m_displayOnly) m_analyzer.analyze(m_state);
+    if ((flags & FLUSH_MAIN_WINDOW) && m_mainWindow) m_mainWindow->updateUI();
+
+    // Last, since the message box runs a nested event loop
+    if ((flags & FLUSH_GAME_OVER) && m_winner != Color::NONE) {
+        QString winnerName = (m_winner == Color::WHITE) ? "Color::WHITE" : "BLACK";
+        QMessageBox::information(this, "Game Over",
+            "Congratulations! Player " + winnerName + " has won the game!");
+    }
 }
 
-void BoardWidget::paintEvent(QPaintEvent*) {
+void BoardWidget::paintEvent(QPaintEvent* event) {
+    BG_TRACE_SCOPE("BoardWidget::paintEvent");
+    ensureStaticLayer();
+    m_sprites.ensure(devicePixelRatioF());
+
     QPainter p(this);
-    p.setRenderHint(QPainter::Antialiasing, true);
-    p.fillRect(rect(), QColor(30, 90, 50));
+    const qreal dpr = m_staticLayer.devicePixelRatio();
+    for (const QRect& r : event->region()) {
+        p.drawPixmap(QRectF(r), m_staticLayer, QRectF(r.x() * dpr, r.y() * dpr, r.width() * dpr, r.height() * dpr));
+    }
 
-    drawBoard(p);
-    drawPieces(p);
+    p.setRenderHint(QPainter::Antialiasing, true);
+    drawPieces(p, event->region());
+    drawHints(p);
     drawHighlights(p);
 
-    if (m_winner != Color::NONE) {
+    if (m_winner != Color::NONE && !m_displayOnly) {
         drawGameOverPanel(p);
     }
 }
 
+void BoardWidget::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    m_geometry = BoardGeometry(size());
+    m_staticLayer = QPixmap();
+}
+
+void BoardWidget::ensureStaticLayer() {
+    const qreal dpr = devicePixelRatioF();
+    const QSize pixelSize = size() * dpr;
+    if (!m_staticLayer.isNull() && m_staticLayer.size() == pixelSize && m_staticLayer.devicePixelRatio() == dpr) {
+        return;
+    }
+
+    m_staticLayer = QPixmap(pixelSize);
+    m_staticLayer.setDevicePixelRatio(dpr);
+
+    QPainter p(&m_staticLayer);
+    p.setRenderHint(QPainter::Antialiasing, true);
+    p.fillRect(rect(), QColor(30, 90, 50));
+    drawBoard(p);
+}
+
 void BoardWidget::drawGameOverPanel(QPainter& p) {
     p.fillRect(rect(), QColor(0, 0, 0, 180));
     p.setPen(Qt::white);
@@ -118,17 +248,8 @@ void BoardWidget::drawGameOverPanel(QPainter& p) {
 }
 
 void BoardWidget::drawBoard(QPainter& p) {
-    const int w = width() - BEAR_OFF_WIDTH;
-    const int h = height();
-    int barWidth = 40;
-    int barX = w / 2 - barWidth / 2;
-    int leftSideWidth = barX;
-    int rightSideWidth = w - (barX + barWidth);
-    int triangleWidth = leftSideWidth / 6;
-    int triangleHeight = h / 2 - 20;
-
-    QRect barRect(barX, 0, barWidth, h);
-    QLinearGradient barGradient(barX, 0, barX + barWidth, 0);
+    const QRect barRect = m_geometry.barRect();
+    QLinearGradient barGradient(barRect.left(), 0, barRect.left() + barRect.width(), 0);
     barGradient.setColorAt(0, QColor(101, 67, 33));
     barGradient.setColorAt(0.5, QColor(139, 69, 19));
     barGradient.setColorAt(1, QColor(101, 67, 33));
@@ -136,31 +257,23 @@ void BoardWidget::drawBoard(QPainter& p) {
 
     // TOP ROW (left to right visually): 11 10 9 8 7 6   |   5 4 3 2 1 0
     // BOTTOM ROW (left to right visually): 12 13 14 15 16 17   |   18 19 20 21 22 23
-    for (int i = 0; i < 6; i++) {
-        // Left half: top -> indices 11..6 (reversed), bottom -> 12..17
-        int topLeftIndex = 11 - i;
-        int bottomLeftIndex = 12 + i;
-        drawTriangle(p, i * triangleWidth, 0, triangleWidth, triangleHeight, false, topLeftIndex);
-        drawTriangle(p, i * triangleWidth, h, triangleWidth, triangleHeight, true, bottomLeftIndex);
-    }
-
-    int rightStartX = barX + barWidth;
-    triangleWidth = rightSideWidth / 6;
-    for (int i = 0; i < 6; i++) {
-        // Right half: top -> indices 5..0 (reversed), bottom -> 18..23
-        int topRightIndex = 5 - i;
-        int bottomRightIndex = 18 + i;
-        drawTriangle(p, rightStartX + i * triangleWidth, 0, triangleWidth, triangleHeight, false, topRightIndex);
-        drawTriangle(p, rightStartX + i * triangleWidth, h, triangleWidth, triangleHeight, true, bottomRightIndex);
+    for (int pointIndex = 0; pointIndex < 24; pointIndex++) {
+        const QRect triangle = m_geometry.triangleRect(pointIndex);
+        if (BoardGeometry::isTopRow(pointIndex)) {
+            drawTriangle(p, triangle.x(), 0, triangle.width(), triangle.height(), false, pointIndex);
+        }
+        else {
+            drawTriangle(p, triangle.x(), height(), triangle.width(), triangle.height(), true, pointIndex);
+        }
     }
 
-    QRect bearOffRect(w, 0, BEAR_OFF_WIDTH, h);
+    const QRect bearOffRect = m_geometry.bearOffRect();
     p.fillRect(bearOffRect, QColor(60, 30, 10));
     p.setPen(QPen(QColor(100, 70, 30), 2));
     p.drawRect(bearOffRect);
 
     p.setPen(QPen(Qt::black, 2));
-    p.drawLine(w, 0, w, h);
+    p.drawLine(bearOffRect.left(), 0, bearOffRect.left(), height());
 }
 
 void BoardWidget::drawTriangle(QPainter& p, int x, int y, int width, int height, bool pointUp, int pointIndex) {
@@ -177,254 +290,177 @@ void BoardWidget::drawTriangle(QPainter& p, int x, int y, int width, int height,
     p.drawPolygon(triangle);
 }
 
-void BoardWidget::drawPieces(QPainter& painter) {
-    int boardWidth = width() - BEAR_OFF_WIDTH;
-    int boardHeight = height();
-    int barWidth = 40;
-    int barX = boardWidth / 2 - barWidth / 2;
-    int leftSideWidth = barX;
-    int rightSideWidth = boardWidth - (barX + barWidth);
-    int leftTriangleWidth = leftSideWidth / 6;
-    int rightTriangleWidth = rightSideWidth / 6;
-
-    int pieceRadius = leftTriangleWidth / 2 - 5;
-    if (pieceRadius > 22) pieceRadius = 22;
-
+void BoardWidget::drawPieces(QPainter& painter, const QRegion& region) {
     const GameStateDTO& state = m_state;
+    const int pieceRadius = m_geometry.checkerRadius();
 
     for (int pointIndex = 0; pointIndex < 24; pointIndex++) {
         int pieceCount = state.pieceCounts[pointIndex];
         Color color = state.colors[pointIndex];
 
-        if (pieceCount > 0 && color != Color::NONE) {
-            int x, y;
-            bool isTopRow;
-
-            // Mapping to match visual layout:
-            // Top row: 11 10 9 8 7 6  |  5 4 3 2 1 0
-            // Bottom row: 12 13 14 15 16 17  |  18 19 20 21 22 23
-            if (pointIndex >= 6 && pointIndex <= 11) {
-                // Top-left half: indices 11..6
-                int col = 11 - pointIndex; // 0..5
-                x = col * leftTriangleWidth + leftTriangleWidth / 2;
-                y = pieceRadius + 5;
-                isTopRow = true;
-            }
-            else if (pointIndex >= 0 && pointIndex <= 5) {
-                // Top-right half: indices 5..0
-                int col = 5 - pointIndex; // 0..5
-                x = barX + barWidth + col * rightTriangleWidth + rightTriangleWidth / 2;
-                y = pieceRadius + 5;
-                isTopRow = true;
-            }
-            else if (pointIndex >= 12 && pointIndex <= 17) {
-                // Bottom-left half: indices 12..17
-                int col = pointIndex - 12; // 0..5
-                x = col * leftTriangleWidth + leftTriangleWidth / 2;
-                y = boardHeight - pieceRadius - 5;
-                isTopRow = false;
-            }
-            else if (pointIndex >= 18 && pointIndex <= 23) {
-                // Bottom-right half: indices 18..23
-                int col = pointIndex - 18; // 0..5
-                x = barX + barWidth + col * rightTriangleWidth + rightTriangleWidth / 2;
-                y = boardHeight - pieceRadius - 5;
-                isTopRow = false;
+        if (pieceCount > 0 && color != Color::NONE && region.intersects(m_geometry.pointRect(pointIndex))) {
+            const QPixmap& sprite = m_sprites.checker(color, pieceRadius);
+            for (int i = 0; i < std::min(pieceCount, BoardGeometry::MAX_VISIBLE_CHECKERS); i++) {
+                drawChecker(painter, sprite, pieceRadius, m_geometry.checkerCenter(pointIndex, i, pieceCount));
             }
-            else {
-                continue;
-            }
-            drawPiecesAtPoint(painter, x, y, pieceCount, color, pieceRadius, isTopRow);
         }
     }
 
-    drawBarPieces(painter, state);
+    if (region.intersects(m_geometry.barRect())) drawBarPieces(painter, state);
+    if (!region.intersects(m_geometry.bearOffRect())) return;
 
-    int bearOffX = boardWidth + BEAR_OFF_WIDTH / 2;
-    if (state.borneOffWhite > 0) {
-        drawPiecesAtPoint(painter, bearOffX, pieceRadius + 10, state.borneOffWhite, Color::WHITE, 12, true);
+    const int radius = BoardGeometry::BORNE_OFF_CHECKER_RADIUS;
+    const int whiteCount = std::min(state.borneOffWhite, BoardGeometry::MAX_VISIBLE_CHECKERS);
+    for (int i = 0; i < whiteCount; i++) {
+        drawChecker(painter, m_sprites.checker(Color::WHITE, radius), radius,
+                    m_geometry.borneOffCheckerCenter(Color::WHITE, i, state.borneOffWhite));
     }
-    if (state.borneOffBlack > 0) {
-        drawPiecesAtPoint(painter, bearOffX, boardHeight - pieceRadius - 10, state.borneOffBlack, Color::BLACK, 12, false);
+    const int blackCount = std::min(state.borneOffBlack, BoardGeometry::MAX_VISIBLE_CHECKERS);
+    for (int i = 0; i < blackCount; i++) {
+        drawChecker(painter, m_sprites.checker(Color::BLACK, radius), radius,
+                    m_geometry.borneOffCheckerCenter(Color::BLACK, i, state.borneOffBlack));
     }
 }
 
-void BoardWidget::drawPiecesAtPoint(QPainter& painter, int centerX, int centerY,
-    int count, Color color, int radius, bool isTopRow) {
-    QColor pieceColor = (color == Color::WHITE) ? QColor(255, 255, 255) : QColor(0, 0, 0);
-    QColor borderColor = (color == Color::WHITE) ? QColor(200, 200, 200) : QColor(50, 50, 50);
-    painter.setBrush(pieceColor);
-    painter.setPen(QPen(borderColor, 2));
-
-    int spacing = radius * 2 + 2;
-    if (count > 5) spacing = (radius * 2 * 5) / count;
-
-    int maxVisible = 15;
-
-    for (int i = 0; i < std::min(count, maxVisible); i++) {
-        int yOffset = isTopRow ? (i * spacing) : -(i * spacing);
-        int pieceY = centerY + yOffset;
-        painter.drawEllipse(QPoint(centerX, pieceY), radius, radius);
-    }
+void BoardWidget::drawChecker(QPainter& painter, const QPixmap& sprite, int radius, const QPoint& center) {
+    const qreal half = SpriteAtlas::checkerSize(radius) / 2.0;
+    painter.drawPixmap(QPointF(center.x() - half, center.y() - half), sprite);
 }
 
 void BoardWidget::drawBarPieces(QPainter& painter, const GameStateDTO& state) {
-    int boardWidth = width() - BEAR_OFF_WIDTH;
-    int boardHeight = height();
-    int barWidth = 40;
-    int barX = boardWidth / 2 - barWidth / 2;
-    int pieceRadius = 18;
-    int centerX = barX + barWidth / 2;
-
-    if (state.barWhite > 0) {
-        int startY = boardHeight / 2 - 50;
-        for (int i = 0; i < state.barWhite; i++) {
-            painter.setBrush(Qt::white);
-            painter.setPen(QPen(QColor(200, 200, 200), 2));
-            painter.drawEllipse(QPoint(centerX, startY - i * 20), pieceRadius, pieceRadius);
-        }
+    const int radius = BoardGeometry::BAR_CHECKER_RADIUS;
+    for (int i = 0; i < state.barWhite; i++) {
+        drawChecker(painter, m_sprites.checker(Color::WHITE, radius), radius, m_geometry.barCheckerCenter(Color::WHITE, i));
     }
-    if (state.barBlack > 0) {
-        int startY = boardHeight / 2 + 50;
-        for (int i = 0; i < state.barBlack; i++) {
-            painter.setBrush(Qt::black);
-            painter.setPen(QPen(QColor(50, 50, 50), 2));
-            painter.drawEllipse(QPoint(centerX, startY + i * 20), pieceRadius, pieceRadius);
-        }
+    for (int i = 0; i < state.barBlack; i++) {
+        drawChecker(painter, m_sprites.checker(Color::BLACK, radius), radius, m_geometry.barCheckerCenter(Color::BLACK, i));
     }
 }
 
 void BoardWidget::drawHighlights(QPainter& p) {
     if (m_winner != Color::NONE) return;
 
-    auto getPointRect = [&](int pointIndex) -> QRect {
-        if (pointIndex == Game::BAR_INDEX) {
-            int barW = 40;
-            int barX = (width() - BEAR_OFF_WIDTH) / 2 - barW / 2;
-            return QRect(barX, 0, barW, height());
-        }
-
-        const int w = width() - BEAR_OFF_WIDTH;
-        const int h = height();
-        const int barWidth = 40;
-        const int barX = w / 2 - barWidth / 2;
-        const int leftTriangleWidth = barX / 6;
-        const int rightTriangleWidth = (w - (barX + barWidth)) / 6;
-
-        bool top = (pointIndex < 12);
-        int x = 0;
-        int triangleWidth = 0;
-
-        // Match the same visual mapping as drawBoard/drawPieces:
-        // Top: 11 10 9 8 7 6 | 5 4 3 2 1 0
-        // Bottom: 12 13 14 15 16 17 | 18 19 20 21 22 23
-        if (pointIndex >= 6 && pointIndex <= 11) {
-            // Top-left
-            int col = 11 - pointIndex; // 0..5
-            x = col * leftTriangleWidth;
-            triangleWidth = leftTriangleWidth;
-        }
-        else if (pointIndex >= 0 && pointIndex <= 5) {
-            // Top-right
-            int col = 5 - pointIndex; // 0..5
-            x = barX + barWidth + col * rightTriangleWidth;
-            triangleWidth = rightTriangleWidth;
-        }
-        else if (pointIndex >= 12 && pointIndex <= 17) {
-            // Bottom-left
-            int col = pointIndex - 12; // 0..5
-            x = col * leftTriangleWidth;
-            triangleWidth = leftTriangleWidth;
-        }
-        else if (pointIndex >= 18 && pointIndex <= 23) {
-            // Bottom-right
-            int col = pointIndex - 18; // 0..5
-            x = barX + barWidth + col * rightTriangleWidth;
-            triangleWidth = rightTriangleWidth;
-        }
-        else {
-            return QRect();
-        }
-
-        return QRect(x, top ? 0 : h / 2, triangleWidth, h / 2);
-        };
 
     if (m_selectedPoint != -1) {
         p.setBrush(QColor(255, 255, 0, 80));
         p.setPen(Qt::NoPen);
-        p.drawRect(getPointRect(m_selectedPoint));
+        p.drawRect(pointRect(m_selectedPoint));
 
         p.setBrush(QColor(0, 255, 0, 80));
         for (int targetPoint : m_legalTargets) {
             if (targetPoint == 24 || targetPoint == -1) {
-                QRect bearOffZone(width() - BEAR_OFF_WIDTH, 0, BEAR_OFF_WIDTH, height());
-                p.drawRect(bearOffZone);
+                p.drawRect(m_geometry.bearOffRect());
             }
             else {
-                p.drawRect(getPointRect(targetPoint));
+                p.drawRect(pointRect(targetPoint));
             }
         }
     }
 }
 
-int BoardWidget::pointIndexFromPosition(const QPoint& pos) const {
-    const int w = width() - BEAR_OFF_WIDTH;
-    const int h = height();
-    const int barWidth = 40;
-    const int barX = w / 2 - barWidth / 2;
-    const int leftTriangleWidth = barX / 6;
-    const int rightTriangleWidth = (w - (barX + barWidth)) / 6;
-
-    if (pos.x() > w) {
-        if (m_state.currentPlayer == Color::WHITE) return 24;
-        if (m_state.currentPlayer == Color::BLACK) return -1;
-    }
+void BoardWidget::drawHints(QPainter& p) {
+    if (m_winner != Color::NONE) return;
 
-    if (pos.x() >= barX && pos.x() <= barX + barWidth) {
-        if (m_state.currentPlayer == Color::WHITE && m_state.barWhite > 0) return Game::BAR_INDEX;
-        if (m_state.currentPlayer == Color::BLACK && m_state.barBlack > 0) return Game::BAR_INDEX;
-        return -1;
+    // Weaker plays first, so the best one ends up on top
+    for (int rank = static_cast<int>(m_hints.size()) - 1; rank >= 0; --rank) {
+        const Play& play = m_hints[rank].play;
+        const QColor color = (rank == 0) ? QColor(0, 170, 255, 220) : QColor(0, 170, 255, 110);
+        p.setPen(QPen(color, rank == 0 ? HINT_PEN_WIDTH : HINT_PEN_WIDTH / 2));
+        p.setBrush(color);
+        for (int i = 0; i < play.count; i++) {
+            const QPoint from = hintAnchor(play.moves[i].fromIndex);
+            const QPoint to = hintAnchor(play.moves[i].toIndex);
+            p.drawLine(from, to);
+            p.drawEllipse(to, HINT_MARKER_RADIUS, HINT_MARKER_RADIUS);
+        }
     }
+}
 
-    bool top = (pos.y() < h / 2);
-    int pointIndex = -1;
+QRect BoardWidget::pointRect(int pointIndex) const {
+    if (pointIndex == Game::BAR_INDEX) return m_geometry.barRect();
+    return m_geometry.pointRect(pointIndex);
+}
 
-    if (pos.x() < barX) {
-        int col = pos.x() / leftTriangleWidth;
-        if (col >= 0 && col < 6) {
-            if (top) {
-                // Top-left: 11 10 9 8 7 6
-                pointIndex = 11 - col;
-            }
-            else {
-                // Bottom-left: 12 13 14 15 16 17
-                pointIndex = 12 + col;
-            }
+QRegion BoardWidget::highlightRegion() const {
+    if (m_selectedPoint == -1) return QRegion();
+    QRegion region(pointRect(m_selectedPoint));
+    for (int targetPoint : m_legalTargets) {
+        region += (targetPoint == 24 || targetPoint == -1) ? m_geometry.bearOffRect() : pointRect(targetPoint);
+    }
+    return region;
+}
+
+QRegion BoardWidget::hintRegion() const {
+    QRegion region;
+    const int margin = HINT_MARKER_RADIUS + HINT_PEN_WIDTH;
+    for (const RankedPlay& hint : m_hints) {
+        for (int i = 0; i < hint.play.count; i++) {
+            const QPoint from = hintAnchor(hint.play.moves[i].fromIndex);
+            const QPoint to = hintAnchor(hint.play.moves[i].toIndex);
+            const QRect span(std::min(from.x(), to.x()), std::min(from.y(), to.y()),
+                             std::abs(to.x() - from.x()) + 1, std::abs(to.y() - from.y()) + 1);
+            region += span.adjusted(-margin, -margin, margin, margin);
         }
     }
-    else if (pos.x() > barX + barWidth && pos.x() < w) {
-        int col = (pos.x() - (barX + barWidth)) / rightTriangleWidth;
-        if (col >= 0 && col < 6) {
-            if (top) {
-                // Top-right: 5 4 3 2 1 0
-                pointIndex = 5 - col;
-            }
-            else {
-                // Bottom-right: 18 19 20 21 22 23
-                pointIndex = 18 + col;
-            }
+    return region;
+}
+
+QPoint BoardWidget::hintAnchor(int index) const {
+    if (index == 24 || index == -1) return m_geometry.bearOffRect().center();
+    return pointRect(index).center();
+}
+
+void BoardWidget::showAnalysis(const MoveAnalysis& analysis) {
+    const QRegion previous = hintRegion();
+    m_hints = analysis.plays;
+    update(previous | hintRegion());
+}
+
+void BoardWidget::clearHints() {
+    m_analyzer.cancel();
+    if (m_hints.empty()) return;
+    update(hintRegion());
+    m_hints.clear();
+}
+
+QRegion BoardWidget::changedRegion(const GameStateDTO& before, const GameStateDTO& after) const {
+    QRegion region;
+    for (int i = 0; i < 24; ++i) {
+        if (before.pieceCounts[i] != after.pieceCounts[i] || before.colors[i] != after.colors[i]) {
+            region += pointRect(i);
         }
     }
-    return pointIndex;
+    if (before.barWhite != after.barWhite || before.barBlack != after.barBlack) region += m_geometry.barRect();
+    if (before.borneOffWhite != after.borneOffWhite || before.borneOffBlack != after.borneOffBlack) {
+        region += m_geometry.bearOffRect();
+    }
+    return region;
+}
+
+int BoardWidget::pointIndexFromPosition(const QPoint& pos) const {
+    const BoardHit hit = m_geometry.hitTest(pos);
+    switch (hit.area) {
+    case BoardArea::BEAR_OFF:
+        if (m_state.currentPlayer == Color::WHITE) return 24;
+        return -1;
+    case BoardArea::BAR:
+        if (m_state.currentPlayer == Color::WHITE && m_state.barWhite > 0) return Game::BAR_INDEX;
+        if (m_state.currentPlayer == Color::BLACK && m_state.barBlack > 0) return Game::BAR_INDEX;
+        return -1;
+    case BoardArea::POINT:
+        return hit.point;
+    default:
+        return -1;
+    }
 }
 
 void BoardWidget::mousePressEvent(QMouseEvent* event) {
-    if (!m_game) return;
+    if (!m_game || m_displayOnly) return;
     if (m_winner != Color::NONE) return; 
 
     int index = pointIndexFromPosition(event->pos());
 
-    if (index == -1 && (event->pos().x() <= width() - BEAR_OFF_WIDTH)) {
+    if (index == -1 && (event->pos().x() <= m_geometry.bearOffRect().left())) {
         clearSelection();
         return;
     }
@@ -0,0 +1,71 @@
+/**
+ * @file MoveAnalyzer.cpp
+ * @brief Implementation of the background move analysis.
+ */
+
+#include "MoveAnalyzer.hpp"
+
+#include <QMetaObject>
+
+#include "Game.hpp"
+#include "Tracing.hpp"
+
+void AnalysisWorker::analyze(quint64 request, const GameStateDTO& state,
+                             const std::shared_ptr<std::atomic<bool>>& cancel) {
+    // Requests superseded while they waited in the queue are skipped outright
+    if (cancel->load(std::memory_order_relaxed)) return;
+    BG_TRACE_SCOPE("AnalysisWorker::analyze");
+
+    HeadlessGame game;
+    game.loadState(state, GamePhase::IN_PROGRESS);
+    MoveAnalysis analysis;
+    analysis.request = request;
+    if (HeuristicEvaluator::rankPlays(game, MoveAnalyzer::MAX_PLAYS, analysis.plays, cancel.get())) {
+        emit finished(analysis);
+    }
+}
+
+MoveAnalyzer::MoveAnalyzer(QObject* parent)
+    : QObject(parent),
+    m_worker(new AnalysisWorker),
+    m_request(0)
+{
+    qRegisterMetaType<MoveAnalysis>();
+    m_worker->moveToThread(&m_thread);
+    // Delivered on this object's thread, after the worker's thread emitted it
+    connect(m_worker, &AnalysisWorker::finished, this, &MoveAnalyzer::onFinished, Qt::QueuedConnection);
+    m_thread.start();
+}
+
+MoveAnalyzer::~MoveAnalyzer() {
+    cancel();
+    m_thread.quit();
+    m_thread.wait();
+    delete m_worker;
+}
+
+void MoveAnalyzer::analyze(const GameStateDTO& state) {
+    cancel();
+    m_cancel = std::make_shared<std::atomic<bool>>(false);
+
+    AnalysisWorker* worker = m_worker;
+    const quint64 request = m_request;
+    const std::shared_ptr<std::atomic<bool>> flag = m_cancel;
+    QMetaObject::invokeMethod(worker, [worker, request, state, flag]() { worker->analyze(request, state, flag); },
+                              Qt::QueuedConnection);
+}
+
+void MoveAnalyzer::cancel() {
+    if (m_cancel) {
+        m_cancel->store(true, std::memory_order_relaxed);
+        m_cancel.reset();
+    }
+    // A result already queued back to us carries the old number and is dropped
+    ++m_request;
+}
+
+void MoveAnalyzer::onFinished(const MoveAnalysis& analysis) {
+    if (analysis.request != m_request || !m_cancel) return;
+    m_cancel.reset();
+    emit analysisReady(analysis);
+}
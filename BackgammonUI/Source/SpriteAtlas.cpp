@@ -0,0 +1,88 @@
+/**
+ * @file SpriteAtlas.cpp
+ * @brief Implementation of the dice and checker sprites.
+ */
+
+#include "SpriteAtlas.hpp"
+
+#include <QPainter>
+#include <QString>
+
+namespace {
+    /// Resource path of the die faces
+    const QString DICE_PATH_TEMPLATE = ":/BackgammonUI/assets/dice%1.png";
+
+    /// Radii used by the bar and bear-off areas, rendered up front
+    constexpr int FIXED_RADII[] = { 12, 18 };
+
+    /// Radii kept before the cache is cleared (the board radius changes on resize)
+    constexpr std::size_t MAX_CACHED_RADII = 8;
+
+    /// Width of the checker border in logical pixels
+    constexpr int BORDER_WIDTH = 2;
+}
+
+SpriteAtlas::SpriteAtlas() : m_devicePixelRatio(0.0) {
+}
+
+void SpriteAtlas::ensure(qreal devicePixelRatio) {
+    if (devicePixelRatio == m_devicePixelRatio) return;
+    m_devicePixelRatio = devicePixelRatio;
+
+    const QSize pixelSize(qRound(DICE_SIZE * devicePixelRatio), qRound(DICE_SIZE * devicePixelRatio));
+    for (int value = 1; value <= 6; ++value) {
+        QPixmap face(DICE_PATH_TEMPLATE.arg(value));
+        if (!face.isNull()) {
+            face = face.scaled(pixelSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+            face.setDevicePixelRatio(devicePixelRatio);
+        }
+        m_dice[value - 1] = face;
+    }
+
+    m_checkers.clear();
+    for (int radius : FIXED_RADII) checker(Color::WHITE, radius);
+}
+
+qreal SpriteAtlas::devicePixelRatio() const {
+    return m_devicePixelRatio;
+}
+
+const QPixmap& SpriteAtlas::die(int value) const {
+    static const QPixmap none;
+    if (value < 1 || value > 6) return none;
+    return m_dice[value - 1];
+}
+
+const QPixmap& SpriteAtlas::checker(Color color, int radius) {
+    for (const CheckerSprites& sprites : m_checkers) {
+        if (sprites.radius == radius) return color == Color::WHITE ? sprites.white : sprites.black;
+    }
+
+    if (m_checkers.size() >= MAX_CACHED_RADII) m_checkers.clear();
+    CheckerSprites sprites;
+    sprites.radius = radius;
+    sprites.white = renderChecker(Color::WHITE, radius);
+    sprites.black = renderChecker(Color::BLACK, radius);
+    m_checkers.push_back(sprites);
+    return color == Color::WHITE ? m_checkers.back().white : m_checkers.back().black;
+}
+
+int SpriteAtlas::checkerSize(int radius) {
+    return 2 * radius + 2 * BORDER_WIDTH;
+}
+
+QPixmap SpriteAtlas::renderChecker(Color color, int radius) const {
+    const int size = checkerSize(radius);
+    QPixmap pixmap(QSize(size, size) * m_devicePixelRatio);
+    pixmap.setDevicePixelRatio(m_devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    const QColor pieceColor = (color == Color::WHITE) ? QColor(255, 255, 255) : QColor(0, 0, 0);
+    const QColor borderColor = (color == Color::WHITE) ? QColor(200, 200, 200) : QColor(50, 50, 50);
+    painter.setBrush(pieceColor);
+    painter.setPen(QPen(borderColor, BORDER_WIDTH));
+    painter.drawEllipse(QPointF(size / 2.0, size / 2.0), radius, radius);
+    return pixmap;
+}
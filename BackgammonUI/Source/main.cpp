@@ -4,10 +4,15 @@
  *
  * This file contains the main function that initializes the Qt application
  * and displays the main game window.
+ *
+ * Setting BACKGAMMON_TRACE_FILE records a Chrome trace of the session
+ * (requires a build with BACKGAMMON_TRACING) and writes it on exit.
  */
 
 #include "BackgammonUI.hpp"
+#include "Tracing.hpp"
 #include <QApplication>
+#include <cstdlib>
 
 /**
  * @brief Main entry point of the application.
@@ -18,7 +23,17 @@
 int main(int argc, char *argv[])
 {
     QApplication app(argc, argv);
+
+    const char* traceFile = std::getenv("BACKGAMMON_TRACE_FILE");
+    if (traceFile) {
+        Tracer::setThreadName("ui");
+        Tracer::setEnabled(true);
+    }
+
     BackgammonUI window;
     window.show();
-    return app.exec();
+    const int result = app.exec();
+
+    if (traceFile) Tracer::writeFile(traceFile);
+    return result;
 }